@@ -141,6 +141,7 @@ LOCAL_SRC_FILES := \
         profiling/client/src/Holder.cpp \
         profiling/client/src/IProfilingService.cpp \
         profiling/client/src/PacketBuffer.cpp \
+        profiling/client/src/PacketBufferQueue.cpp \
         profiling/client/src/PeriodicCounterCapture.cpp \
         profiling/client/src/PeriodicCounterSelectionCommandHandler.cpp \
         profiling/client/src/PerJobCounterSelectionCommandHandler.cpp \
@@ -173,6 +174,7 @@ LOCAL_SRC_FILES := \
         src/armnn/InternalTypes.cpp \
         src/armnn/JsonPrinter.cpp \
         src/armnn/Layer.cpp \
+        src/armnn/LayerSupportCache.cpp \
         src/armnn/LoadedNetwork.cpp \
         src/armnn/Logging.cpp \
         src/armnn/Network.cpp \
@@ -180,6 +182,7 @@ LOCAL_SRC_FILES := \
         src/armnn/Observable.cpp \
         src/armnn/Optimizer.cpp \
         src/armnn/OutputHandler.cpp \
+        src/armnn/PerfEventCounters.cpp \
         src/armnn/ProfilingEvent.cpp \
         src/armnn/Profiling.cpp \
         src/armnn/Runtime.cpp \
@@ -192,6 +195,7 @@ LOCAL_SRC_FILES := \
         src/armnn/Utils.cpp \
         src/armnn/WallClockTimer.cpp \
         src/armnn/WorkingMemHandle.cpp \
+        src/armnnUtils/ChromeTraceWriter.cpp \
         src/armnnUtils/CompatibleTypes.cpp \
         src/armnnUtils/DataLayoutIndexed.cpp \
         src/armnnUtils/DotSerializer.cpp \
@@ -112,10 +112,26 @@ private:
     ArmnnSubgraph(armnn::NetworkId networkId,
                   armnn::IRuntime* runtime,
                   std::vector<armnn::BindingPointInfo>& inputBindings,
-                  std::vector<armnn::BindingPointInfo>& outputBindings)
+                  std::vector<armnn::BindingPointInfo>& outputBindings,
+                  bool profilingEnabled)
         : m_NetworkId(networkId), m_Runtime(runtime), m_InputBindings(inputBindings), m_OutputBindings(outputBindings)
+        , m_ProfilingEnabled(profilingEnabled), m_ImportedInputs(inputBindings.size())
     {}
 
+    /// A TfLite buffer which has been imported into the loaded network, or which failed to import.
+    struct ImportedBuffer
+    {
+        const void* m_Buffer = nullptr;
+        bool m_Imported = false;
+        armnn::ImportedInputId m_ImportedId = 0;
+    };
+
+    /// Returns true if the input can run from its imported tensor handle, importing the buffer again if it moved.
+    bool ImportInput(size_t inputIndex, armnn::LayerBindingId bindingId, const armnn::ConstTensor& tensor);
+
+    /// Imports the outputs again if TfLite has moved any of their buffers.
+    void ImportOutputs(const armnn::OutputTensors& outputTensors);
+
     static TfLiteStatus AddInputLayer(DelegateData& delegateData,
                                       TfLiteContext* tfLiteContext,
                                       const TfLiteIntArray* inputs,
@@ -136,6 +152,13 @@ private:
     std::vector<armnn::BindingPointInfo> m_InputBindings;
     std::vector<armnn::BindingPointInfo> m_OutputBindings;
 
+    /// Whether the network was loaded with internal profiling, so there is a profiler to print after each run
+    bool m_ProfilingEnabled;
+
+    // Arena buffers imported into the network, kept across invocations until TfLite reallocates them
+    std::vector<ImportedBuffer> m_ImportedInputs;
+    std::vector<const void*> m_OutputBuffers;
+    std::vector<armnn::ImportedOutputId> m_ImportedOutputIds;
 };
 
 } // armnnDelegate namespace
\ No newline at end of file
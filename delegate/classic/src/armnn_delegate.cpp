@@ -5,6 +5,7 @@
 
 #include <armnn_delegate.hpp>
 
+#include "SubgraphCache.hpp"
 #include "Version.hpp"
 
 #include "Activation.hpp"
@@ -333,6 +334,82 @@ TfLiteStatus ArmnnSubgraph::AddOutputLayer(DelegateData& delegateData,
     return kTfLiteOk;
 }
 
+namespace
+{
+
+/// Hashes the delegated nodes together with their tensors, including constant data, and the delegate options which
+/// affect what the backends compile for them.
+SubgraphCacheKey GetSubgraphCacheKey(TfLiteContext* tfLiteContext,
+                                     const TfLiteDelegateParams* parameters,
+                                     const DelegateOptions& options)
+{
+    SubgraphCacheKey key;
+    key.AddOptions(options.GetBackends(), options.GetOptimizerOptions());
+
+    auto addTensors = [&](const TfLiteIntArray* tensorIds)
+    {
+        key.AddValue(tensorIds->size);
+        for (auto tensorId : tflite::TfLiteIntArrayView(tensorIds))
+        {
+            key.AddValue(tensorId);
+            if (tensorId < 0)
+            {
+                // Optional tensor which has not been given.
+                continue;
+            }
+            const TfLiteTensor& tensor = tfLiteContext->tensors[tensorId];
+            key.AddValue(tensor.type);
+            if (tensor.dims)
+            {
+                key.AddValue(tensor.dims->size);
+                key.AddBytes(tensor.dims->data, sizeof(int) * static_cast<size_t>(tensor.dims->size));
+            }
+            key.AddValue(tensor.params.scale);
+            key.AddValue(tensor.params.zero_point);
+            if (tensor.allocation_type == kTfLiteMmapRo && tensor.data.raw)
+            {
+                key.AddBytes(tensor.data.raw, tensor.bytes);
+            }
+        }
+    };
+
+    addTensors(parameters->input_tensors);
+    addTensors(parameters->output_tensors);
+    for (auto nodeIndex : tflite::TfLiteIntArrayView(parameters->nodes_to_replace))
+    {
+        TfLiteNode* tfLiteNode = nullptr;
+        TfLiteRegistration* tfLiteRegistration = nullptr;
+        if (tfLiteContext->GetNodeAndRegistration(
+            tfLiteContext, nodeIndex, &tfLiteNode, &tfLiteRegistration) != kTfLiteOk)
+        {
+            throw armnn::Exception("TfLiteArmnnDelegate: Unable to get node registration: " +
+                                   std::to_string(nodeIndex));
+        }
+        key.AddValue(tfLiteRegistration->builtin_code);
+        key.AddValue(tfLiteRegistration->version);
+        if (tfLiteRegistration->custom_name)
+        {
+            key.AddString(tfLiteRegistration->custom_name);
+        }
+        if (tfLiteNode->custom_initial_data)
+        {
+            key.AddBytes(tfLiteNode->custom_initial_data, static_cast<size_t>(tfLiteNode->custom_initial_data_size));
+        }
+        addTensors(tfLiteNode->inputs);
+        addTensors(tfLiteNode->outputs);
+    }
+    return key;
+}
+
+/// Buffers allocated in the TfLite arena stay at the same address between invocations until the interpreter
+/// reallocates its tensors, so they are worth importing once rather than copying on every run.
+bool IsArenaAllocated(const TfLiteTensor* tensor)
+{
+    return tensor->allocation_type == kTfLiteArenaRw || tensor->allocation_type == kTfLiteArenaRwPersistent;
+}
+
+} // anonymous namespace
+
 ArmnnSubgraph* ArmnnSubgraph::Create(TfLiteContext* tfLiteContext,
                                      const TfLiteDelegateParams* parameters,
                                      const Delegate* delegate)
@@ -395,28 +472,49 @@ ArmnnSubgraph* ArmnnSubgraph::Create(TfLiteContext* tfLiteContext,
         throw armnn::Exception("TfLiteArmnnDelegate: Unable to add Outputs to the network!");
     }
 
-    // Optimize ArmNN network
+    // Load the optimized network from the cache entry of this subgraph, if there is a cache directory
+    armnn::OptimizerOptionsOpaque optimizerOptions = delegate->m_Options.GetOptimizerOptions();
+    std::unique_ptr<SubgraphCacheEntry> cacheEntry;
     armnn::IOptimizedNetworkPtr optNet(nullptr, nullptr);
-    try
-    {
-        const auto optimizeStartTime = armnn::GetTimeNow();
-        optNet = armnn::Optimize(*(delegateData.m_Network.get()),
-                                 delegate->m_Options.GetBackends(),
-                                 delegate->m_Runtime->GetDeviceSpec(),
-                                 delegate->m_Options.GetOptimizerOptions());
-        ARMNN_LOG(info) << "Optimize ArmnnSubgraph time: " << std::setprecision(2)
-                        << std::fixed << armnn::GetTimeDuration(optimizeStartTime).count() << " ms";
-    }
-    catch (std::exception& ex)
+    if (!delegate->m_Options.GetSubgraphCacheDirectory().empty())
     {
-        std::stringstream exMessage;
-        exMessage << "TfLiteArmnnDelegate: Exception (" << ex.what() << ") caught from optimize.";
-        throw armnn::Exception(exMessage.str());
+        cacheEntry = std::make_unique<SubgraphCacheEntry>(
+            delegate->m_Options.GetSubgraphCacheDirectory(),
+            GetSubgraphCacheKey(tfLiteContext, parameters, delegate->m_Options),
+            delegate->m_Options.GetBackends());
+        cacheEntry->AddModelOptions(optimizerOptions);
+        optNet = cacheEntry->LoadOptimizedNetwork(optimizerOptions.GetModelOptions());
     }
+
+    // Optimize ArmNN network
     if (!optNet)
     {
-        // Optimize failed
-        throw armnn::Exception("TfLiteArmnnDelegate: Unable to optimize the network!");
+        try
+        {
+            const auto optimizeStartTime = armnn::GetTimeNow();
+            optNet = armnn::Optimize(*(delegateData.m_Network.get()),
+                                     delegate->m_Options.GetBackends(),
+                                     delegate->m_Runtime->GetDeviceSpec(),
+                                     optimizerOptions);
+            ARMNN_LOG(info) << "Optimize ArmnnSubgraph time: " << std::setprecision(2)
+                            << std::fixed << armnn::GetTimeDuration(optimizeStartTime).count() << " ms";
+        }
+        catch (std::exception& ex)
+        {
+            std::stringstream exMessage;
+            exMessage << "TfLiteArmnnDelegate: Exception (" << ex.what() << ") caught from optimize.";
+            throw armnn::Exception(exMessage.str());
+        }
+        if (!optNet)
+        {
+            // Optimize failed
+            throw armnn::Exception("TfLiteArmnnDelegate: Unable to optimize the network!");
+        }
+
+        if (cacheEntry)
+        {
+            cacheEntry->SaveOptimizedNetwork(*optNet);
+        }
     }
 
     // If set, we will serialize the optimized model into a dot file.
@@ -462,6 +560,11 @@ ArmnnSubgraph* ArmnnSubgraph::Create(TfLiteContext* tfLiteContext,
             throw armnn::Exception("TfLiteArmnnDelegate: Network could not be loaded: " + errorMessage);
         }
 
+        if (cacheEntry)
+        {
+            cacheEntry->Finish(true);
+        }
+
         ARMNN_LOG(info) << "Load ArmnnSubgraph time: " << std::setprecision(2)
                         << std::fixed << armnn::GetTimeDuration(loadStartTime).count() << " ms";
     }
@@ -482,7 +585,11 @@ ArmnnSubgraph* ArmnnSubgraph::Create(TfLiteContext* tfLiteContext,
                     << std::fixed << armnn::GetTimeDuration(startTime).count() << " ms\n";
 
     // Create a new SubGraph with networkId and runtime
-    return new ArmnnSubgraph(networkId, delegate->m_Runtime, inputBindings, outputBindings);
+    return new ArmnnSubgraph(networkId,
+                             delegate->m_Runtime,
+                             inputBindings,
+                             outputBindings,
+                             delegate->m_Options.GetInternalProfilingState());
 }
 
 TfLiteStatus ArmnnSubgraph::Prepare(TfLiteContext* tfLiteContext)
@@ -491,10 +598,65 @@ TfLiteStatus ArmnnSubgraph::Prepare(TfLiteContext* tfLiteContext)
     return kTfLiteOk;
 }
 
+bool ArmnnSubgraph::ImportInput(size_t inputIndex, armnn::LayerBindingId bindingId, const armnn::ConstTensor& tensor)
+{
+    ImportedBuffer& importedInput = m_ImportedInputs[inputIndex];
+    if (importedInput.m_Buffer == tensor.GetMemoryArea())
+    {
+        // A buffer which could not be imported is not retried until TfLite moves it.
+        return importedInput.m_Imported;
+    }
+
+    importedInput.m_Buffer = tensor.GetMemoryArea();
+    importedInput.m_Imported = false;
+    try
+    {
+        std::vector<armnn::ImportedInputId> importedIds =
+            m_Runtime->ImportInputs(m_NetworkId, { { bindingId, tensor } }, armnn::MemorySource::Malloc);
+        if (importedIds.size() == 1)
+        {
+            importedInput.m_Imported = true;
+            importedInput.m_ImportedId = importedIds[0];
+        }
+    }
+    catch (const armnn::Exception& ex)
+    {
+        ARMNN_LOG(debug) << "TfLiteArmnnDelegate: Input " << bindingId << " will be copied: " << ex.what();
+    }
+    return importedInput.m_Imported;
+}
+
+void ArmnnSubgraph::ImportOutputs(const armnn::OutputTensors& outputTensors)
+{
+    std::vector<const void*> outputBuffers;
+    outputBuffers.reserve(outputTensors.size());
+    for (const auto& outputTensor : outputTensors)
+    {
+        outputBuffers.push_back(outputTensor.second.GetMemoryArea());
+    }
+    if (outputBuffers == m_OutputBuffers)
+    {
+        return;
+    }
+
+    // Outputs which cannot be imported are left out of the returned ids and are copied as before.
+    m_OutputBuffers = std::move(outputBuffers);
+    m_ImportedOutputIds.clear();
+    try
+    {
+        m_ImportedOutputIds = m_Runtime->ImportOutputs(m_NetworkId, outputTensors, armnn::MemorySource::Malloc);
+    }
+    catch (const armnn::Exception& ex)
+    {
+        ARMNN_LOG(debug) << "TfLiteArmnnDelegate: Outputs will be copied: " << ex.what();
+    }
+}
+
 TfLiteStatus ArmnnSubgraph::Invoke(TfLiteContext* tfLiteContext, TfLiteNode* tfLiteNode)
 {
-    // Prepare inputs
+    // Prepare inputs. Arena buffers are bound to the network once and only passed by id afterwards.
     armnn::InputTensors inputTensors;
+    std::vector<armnn::ImportedInputId> importedInputIds;
     size_t inputIndex = 0;
     for (auto inputIdx : tflite::TfLiteIntArrayView(tfLiteNode->inputs))
     {
@@ -505,7 +667,14 @@ TfLiteStatus ArmnnSubgraph::Invoke(TfLiteContext* tfLiteContext, TfLiteNode* tfL
             armnn::TensorInfo inputTensorInfo = inputBinding.second;
             inputTensorInfo.SetConstant(true);
             const armnn::ConstTensor inputTensor(inputTensorInfo, tensor->data.data);
-            inputTensors.emplace_back(inputIdx, inputTensor);
+            if (IsArenaAllocated(tensor) && ImportInput(inputIndex, inputIdx, inputTensor))
+            {
+                importedInputIds.push_back(m_ImportedInputs[inputIndex].m_ImportedId);
+            }
+            else
+            {
+                inputTensors.emplace_back(inputIdx, inputTensor);
+            }
 
             ++inputIndex;
         }
@@ -514,23 +683,37 @@ TfLiteStatus ArmnnSubgraph::Invoke(TfLiteContext* tfLiteContext, TfLiteNode* tfL
     // Prepare outputs
     armnn::OutputTensors outputTensors;
     size_t outputIndex = 0;
+    bool outputsInArena = true;
     for (auto outputIdx : tflite::TfLiteIntArrayView(tfLiteNode->outputs))
     {
         const armnn::BindingPointInfo& outputBinding = m_OutputBindings[outputIndex];
         TfLiteTensor* tensor = &tfLiteContext->tensors[outputIdx];
         const armnn::Tensor outputTensor(outputBinding.second, tensor->data.data);
         outputTensors.emplace_back(outputIdx, outputTensor);
+        outputsInArena = outputsInArena && IsArenaAllocated(tensor);
 
         ++outputIndex;
     }
 
+    // The runtime can only import the outputs all together.
+    std::vector<armnn::ImportedOutputId> importedOutputIds;
+    if (outputsInArena)
+    {
+        ImportOutputs(outputTensors);
+        importedOutputIds = m_ImportedOutputIds;
+    }
+
     // Run graph
-    auto status = m_Runtime->EnqueueWorkload(m_NetworkId, inputTensors, outputTensors);
+    auto status = m_Runtime->EnqueueWorkload(m_NetworkId, inputTensors, outputTensors,
+                                             importedInputIds, importedOutputIds);
     // The delegate holds its own Arm NN runtime so this is our last chance to print internal profiling data.
-    std::shared_ptr<armnn::IProfiler> profiler = m_Runtime->GetProfiler(m_NetworkId);
-    if (profiler && profiler->IsProfilingEnabled())
+    if (m_ProfilingEnabled)
     {
-        profiler->Print(std::cout);
+        std::shared_ptr<armnn::IProfiler> profiler = m_Runtime->GetProfiler(m_NetworkId);
+        if (profiler && profiler->IsProfilingEnabled())
+        {
+            profiler->Print(std::cout);
+        }
     }
     return (status == armnn::Status::Success) ? kTfLiteOk : kTfLiteError;
 }
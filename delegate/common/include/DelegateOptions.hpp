@@ -175,6 +175,14 @@ public:
      *    Possible values: [filenameString] \n
      *    Description: Serialize the optimized network to the file specified in "dot" format.
      *
+     *    Option key: "subgraph-cache-dir" \n
+     *    Possible values: [directoryString] \n
+     *    Description: Directory in which the optimized network of each delegated subgraph is cached, keyed by the
+     *                 subgraph, its constant data, the backends and the optimizer options. Later interpreters
+     *                 created for the same model load it rather than optimizing the subgraph again. GpuAcc also
+     *                 caches the OpenCL programs it compiles, taking precedence over "cached-network-filepath".
+     *                 Optimized networks are only cached when Arm NN is built with its serializer.
+     *
      *    Option key: "disable-tflite-runtime-fallback" \n
      *    Possible values: ["true"/"false"] \n
      *    Description: Disable TfLite Runtime fallback in the Arm NN TfLite delegate.
@@ -235,6 +243,11 @@ public:
 
     const std::string& GetSerializeToDot() const;
 
+    /// Sets the directory in which optimized subgraphs are cached across interpreters and processes
+    void SetSubgraphCacheDirectory(const std::string& cacheDirectory);
+
+    const std::string& GetSubgraphCacheDirectory() const;
+
     /// @Note: This might overwrite options that were set with other setter functions of DelegateOptions
     void SetRuntimeOptions(const armnn::IRuntime::CreationOptions& runtimeOptions);
 
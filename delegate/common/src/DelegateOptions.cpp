@@ -86,6 +86,9 @@ struct DelegateOptionsImpl
     /// If not empty then the optimized model will be serialized to a file with this file name in "dot" format.
     std::string m_SerializeToDot = "";
 
+    /// If not empty then the optimized network of each subgraph is cached in this directory.
+    std::string m_SubgraphCacheDirectory = "";
+
     /// Option to disable TfLite Runtime fallback for unsupported operators.
     bool m_DisableTfLiteRuntimeFallback = false;
 
@@ -407,6 +410,11 @@ DelegateOptions::DelegateOptions(char const* const* options_keys,
         {
             SetSerializeToDot(options_values[i]);
         }
+        // Process subgraph-cache-dir
+        else if (std::string(options_keys[i]) == std::string("subgraph-cache-dir"))
+        {
+            SetSubgraphCacheDirectory(options_values[i]);
+        }
         // Process disable-tflite-runtime-fallback
         else if (std::string(options_keys[i]) == std::string("disable-tflite-runtime-fallback"))
         {
@@ -525,6 +533,16 @@ const std::string& DelegateOptions::GetSerializeToDot() const
     return p_DelegateOptionsImpl->m_SerializeToDot;
 }
 
+void DelegateOptions::SetSubgraphCacheDirectory(const std::string& cacheDirectory)
+{
+    p_DelegateOptionsImpl->m_SubgraphCacheDirectory = cacheDirectory;
+}
+
+const std::string& DelegateOptions::GetSubgraphCacheDirectory() const
+{
+    return p_DelegateOptionsImpl->m_SubgraphCacheDirectory;
+}
+
 void DelegateOptions::SetRuntimeOptions(const armnn::IRuntime::CreationOptions& runtimeOptions)
 {
     p_DelegateOptionsImpl->m_RuntimeOptions = runtimeOptions;
@@ -0,0 +1,300 @@
+//
+// Copyright © 2024 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include <armnn/BackendId.hpp>
+#include <armnn/BackendOptions.hpp>
+#include <armnn/INetwork.hpp>
+#include <armnn/Logging.hpp>
+#include <armnn/Version.hpp>
+#include <armnn/utility/IgnoreUnused.hpp>
+
+#include <armnnUtils/Filesystem.hpp>
+
+#if defined(ARMNN_SERIALIZER)
+#include <armnnDeserializer/IDeserializer.hpp>
+#include <armnnSerializer/ISerializer.hpp>
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// NOTE: the subgraph cache keeps the optimized network of each delegated subgraph in a directory given in the
+//       DelegateOptions, so that Optimize is not run again every time an interpreter is created for the same model.
+//       The GpuAcc backend also keeps the OpenCL programs it compiles when the network is loaded.
+//       Optimized networks are only cached when the Arm NN serializer has been built.
+
+namespace armnnDelegate
+{
+
+/// Hashes everything which determines the optimized network of a subgraph: its nodes, tensors and constant data, the
+/// backends, the optimizer options and the Arm NN version.
+class SubgraphCacheKey
+{
+public:
+    SubgraphCacheKey()
+    {
+        AddString(ARMNN_VERSION);
+    }
+
+    void AddBytes(const void* data, size_t size)
+    {
+        // FNV-1a, taking eight bytes at a time to keep up with large weight tensors.
+        const auto* bytes = static_cast<const uint8_t*>(data);
+        size_t offset = 0;
+        for (; offset + sizeof(uint64_t) <= size; offset += sizeof(uint64_t))
+        {
+            uint64_t word;
+            std::memcpy(&word, bytes + offset, sizeof(word));
+            m_Hash = (m_Hash ^ word) * Prime;
+        }
+        for (; offset < size; ++offset)
+        {
+            m_Hash = (m_Hash ^ bytes[offset]) * Prime;
+        }
+    }
+
+    template <typename T>
+    void AddValue(T value)
+    {
+        static_assert(std::is_arithmetic<T>::value || std::is_enum<T>::value, "Only plain values can be hashed");
+        AddBytes(&value, sizeof(value));
+    }
+
+    void AddString(const std::string& value)
+    {
+        AddValue(value.size());
+        AddBytes(value.data(), value.size());
+    }
+
+    void AddOptions(const std::vector<armnn::BackendId>& backends, const armnn::OptimizerOptionsOpaque& options)
+    {
+        for (const armnn::BackendId& backend : backends)
+        {
+            AddString(backend.Get());
+        }
+        AddString(options.ToString());
+    }
+
+    std::string ToString() const
+    {
+        std::stringstream ss;
+        ss << std::hex << std::setw(16) << std::setfill('0') << m_Hash;
+        return ss.str();
+    }
+
+private:
+    static constexpr uint64_t Prime = 1099511628211ull;
+    uint64_t m_Hash = 14695981039346656037ull;
+};
+
+/// A file of the cache directory. Files are written under a name of their own and only renamed into place once
+/// complete, so that other processes never read a partially written file.
+class SubgraphCacheFile
+{
+public:
+    SubgraphCacheFile() = default;
+
+    explicit SubgraphCacheFile(fs::path path)
+        : m_Path(std::move(path))
+    {}
+
+    const fs::path& GetPath() const
+    {
+        return m_Path;
+    }
+
+    bool IsCached() const
+    {
+        std::error_code error;
+        return !m_Path.empty() && fs::is_regular_file(m_Path, error) && fs::file_size(m_Path, error) > 0;
+    }
+
+    /// Creates the file the contents are written to before being kept, and returns its path, or an empty path if
+    /// it couldn't be created.
+    const fs::path& CreateTemporaryFile()
+    {
+        const size_t unique = std::hash<std::thread::id>()(std::this_thread::get_id()) ^
+            static_cast<size_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+        m_TempPath = m_Path;
+        m_TempPath += ".tmp" + std::to_string(unique);
+
+        std::ofstream file(m_TempPath, std::ios::out | std::ios::binary);
+        if (!file)
+        {
+            ARMNN_LOG(warning) << "Unable to write to the subgraph cache directory: " << m_Path.parent_path().string();
+            m_TempPath.clear();
+        }
+        return m_TempPath;
+    }
+
+    /// Renames the temporary file into place if asked to and it isn't empty, or removes it.
+    void Finish(bool keep)
+    {
+        if (m_TempPath.empty())
+        {
+            return;
+        }
+        std::error_code error;
+        if (keep && fs::file_size(m_TempPath, error) > 0 && !error)
+        {
+            fs::rename(m_TempPath, m_Path, error);
+        }
+        fs::remove(m_TempPath, error);
+        m_TempPath.clear();
+    }
+
+    ~SubgraphCacheFile()
+    {
+        Finish(false);
+    }
+
+    SubgraphCacheFile(const SubgraphCacheFile&) = delete;
+    SubgraphCacheFile& operator=(const SubgraphCacheFile&) = delete;
+    SubgraphCacheFile(SubgraphCacheFile&&) = default;
+    SubgraphCacheFile& operator=(SubgraphCacheFile&&) = default;
+
+private:
+    fs::path m_Path;
+    fs::path m_TempPath;
+};
+
+/// The entries of one subgraph in the cache directory: its optimized network, which is loaded instead of optimizing
+/// the subgraph again, and the OpenCL programs GpuAcc compiles for it.
+class SubgraphCacheEntry
+{
+public:
+    SubgraphCacheEntry(const std::string& cacheDirectory,
+                       const SubgraphCacheKey& key,
+                       const std::vector<armnn::BackendId>& backends)
+    {
+        std::error_code error;
+        fs::create_directories(cacheDirectory, error);
+        const fs::path path = fs::path(cacheDirectory) / ("armnn_subgraph_" + key.ToString());
+
+        m_OptimizedNetwork = SubgraphCacheFile(fs::path(path).replace_extension(".armnn"));
+        if (std::find(backends.begin(), backends.end(), armnn::BackendId("GpuAcc")) != backends.end())
+        {
+            m_ClPrograms = SubgraphCacheFile(fs::path(path).replace_extension(".bin"));
+        }
+    }
+
+    /// Points GpuAcc at the file of its OpenCL programs: it reloads them from it, or saves them if there are none
+    /// yet. These model options come last so they override a cached network file given in the delegate options.
+    void AddModelOptions(armnn::OptimizerOptionsOpaque& optimizerOptions)
+    {
+        if (m_ClPrograms.GetPath().empty())
+        {
+            return;
+        }
+        if (m_ClPrograms.IsCached())
+        {
+            optimizerOptions.AddModelOption(armnn::BackendOptions("GpuAcc",
+                                                                  {{"CachedNetworkFilePath",
+                                                                    m_ClPrograms.GetPath().string()}}));
+            ARMNN_LOG(info) << "Loading subgraph programs from cache: " << m_ClPrograms.GetPath().string();
+        }
+        else
+        {
+            // The backend only saves into a file which already exists.
+            const fs::path& tempPath = m_ClPrograms.CreateTemporaryFile();
+            if (!tempPath.empty())
+            {
+                optimizerOptions.AddModelOption(armnn::BackendOptions("GpuAcc",
+                                                                      {{"SaveCachedNetwork", true},
+                                                                       {"CachedNetworkFilePath", tempPath.string()}}));
+                ARMNN_LOG(info) << "Saving subgraph programs to cache: " << m_ClPrograms.GetPath().string();
+            }
+        }
+    }
+
+    /// Returns the cached optimized network of the subgraph, or nullptr if there is none.
+    /// @param modelOptions The model options of the optimizer options, as they are not cached.
+    armnn::IOptimizedNetworkPtr LoadOptimizedNetwork(const armnn::ModelOptions& modelOptions) const
+    {
+#if defined(ARMNN_SERIALIZER)
+        if (m_OptimizedNetwork.IsCached())
+        {
+            try
+            {
+                std::ifstream file(m_OptimizedNetwork.GetPath(), std::ios::in | std::ios::binary);
+                std::vector<uint8_t> content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+                armnn::IOptimizedNetworkPtr optimizedNetwork =
+                    armnnDeserializer::IDeserializer::Create()->CreateOptimizedNetworkFromBinary(content, modelOptions);
+                ARMNN_LOG(info) << "Loaded optimized subgraph from cache: " << m_OptimizedNetwork.GetPath().string();
+                return optimizedNetwork;
+            }
+            catch (const armnn::Exception& e)
+            {
+                ARMNN_LOG(warning) << "Unable to load optimized subgraph from cache ("
+                                   << m_OptimizedNetwork.GetPath().string() << "): " << e.what();
+            }
+        }
+#else
+        armnn::IgnoreUnused(modelOptions);
+#endif
+        return armnn::IOptimizedNetworkPtr(nullptr, nullptr);
+    }
+
+    /// Writes the optimized network of the subgraph, to be kept in the cache once it has been loaded. Networks which
+    /// can't be serialized, e.g. as they contain pre-compiled layers, aren't cached.
+    void SaveOptimizedNetwork(const armnn::IOptimizedNetwork& optimizedNetwork)
+    {
+#if defined(ARMNN_SERIALIZER)
+        try
+        {
+            armnnSerializer::ISerializerPtr serializer = armnnSerializer::ISerializer::Create();
+            serializer->Serialize(optimizedNetwork);
+
+            const fs::path& tempPath = m_OptimizedNetwork.CreateTemporaryFile();
+            if (tempPath.empty())
+            {
+                return;
+            }
+            std::ofstream file(tempPath, std::ios::out | std::ios::binary);
+            if (!serializer->SaveSerializedToStream(file))
+            {
+                m_OptimizedNetwork.Finish(false);
+                return;
+            }
+            ARMNN_LOG(info) << "Saving optimized subgraph to cache: " << m_OptimizedNetwork.GetPath().string();
+        }
+        catch (const armnn::Exception& e)
+        {
+            ARMNN_LOG(debug) << "The optimized subgraph is not cached: " << e.what();
+            m_OptimizedNetwork.Finish(false);
+        }
+#else
+        armnn::IgnoreUnused(optimizedNetwork);
+#endif
+    }
+
+    /// To be called once the network has been loaded, which is when GpuAcc writes its programs.
+    /// A failed load leaves nothing behind in the cache directory.
+    void Finish(bool loaded)
+    {
+        m_OptimizedNetwork.Finish(loaded);
+        m_ClPrograms.Finish(loaded);
+    }
+
+private:
+    SubgraphCacheFile m_OptimizedNetwork;
+    SubgraphCacheFile m_ClPrograms;
+};
+
+} // namespace armnnDelegate
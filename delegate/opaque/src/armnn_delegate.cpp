@@ -5,6 +5,7 @@
 
 #include <armnn_delegate.hpp>
 #include <OpaqueDelegateUtils.hpp>
+#include <SubgraphCache.hpp>
 
 #include "Activation.hpp"
 #include "ArgMinMax.hpp"
@@ -447,6 +448,91 @@ TfLiteStatus ArmnnSubgraph::AddOutputLayer(DelegateData& delegateData,
     return kTfLiteOk;
 }
 
+namespace
+{
+
+/// Hashes the delegated nodes together with their tensors, including constant data, and the delegate options which
+/// affect what the backends compile for them.
+armnnDelegate::SubgraphCacheKey GetSubgraphCacheKey(TfLiteOpaqueContext* tfLiteContext,
+                                                    const TfLiteOpaqueDelegateParams* parameters,
+                                                    const armnnDelegate::DelegateOptions& options)
+{
+    armnnDelegate::SubgraphCacheKey key;
+    key.AddOptions(options.GetBackends(), options.GetOptimizerOptions());
+
+    auto addTensors = [&](const int* tensorIds, int numTensors)
+    {
+        key.AddValue(numTensors);
+        for (int i = 0; i < numTensors; ++i)
+        {
+            key.AddValue(tensorIds[i]);
+            if (tensorIds[i] < 0)
+            {
+                // Optional tensor which has not been given.
+                continue;
+            }
+            const TfLiteOpaqueTensor* tensor = TfLiteOpaqueContextGetOpaqueTensor(tfLiteContext, tensorIds[i]);
+            key.AddValue(TfLiteOpaqueTensorType(tensor));
+            const int32_t numDims = TfLiteOpaqueTensorNumDims(tensor);
+            key.AddValue(numDims);
+            for (int32_t dim = 0; dim < numDims; ++dim)
+            {
+                key.AddValue(TfLiteOpaqueTensorDim(tensor, dim));
+            }
+            const TfLiteQuantizationParams quantization = TfLiteOpaqueTensorGetQuantizationParams(tensor);
+            key.AddValue(quantization.scale);
+            key.AddValue(quantization.zero_point);
+            if (TfLiteOpaqueTensorGetAllocationType(tensor) == kTfLiteMmapRo && TfLiteOpaqueTensorData(tensor))
+            {
+                key.AddBytes(TfLiteOpaqueTensorData(tensor), TfLiteOpaqueTensorByteSize(tensor));
+            }
+        }
+    };
+
+    addTensors(parameters->input_tensors->data, parameters->input_tensors->size);
+    addTensors(parameters->output_tensors->data, parameters->output_tensors->size);
+    for (int i = 0; i < parameters->nodes_to_replace->size; ++i)
+    {
+        const int nodeIndex = parameters->nodes_to_replace->data[i];
+
+        TfLiteOpaqueNode* tfLiteNode = nullptr;
+        TfLiteRegistrationExternal* tfLiteRegistration = nullptr;
+        if (TfLiteOpaqueContextGetNodeAndRegistration(
+            tfLiteContext, nodeIndex, &tfLiteNode, &tfLiteRegistration) != kTfLiteOk)
+        {
+            throw armnn::Exception("TfLiteArmnnOpaqueDelegate: Unable to get node registration: " +
+                                   std::to_string(nodeIndex));
+        }
+        key.AddValue(TfLiteRegistrationExternalGetBuiltInCode(tfLiteRegistration));
+        if (const char* customName = TfLiteRegistrationExternalGetCustomName(tfLiteRegistration))
+        {
+            key.AddString(customName);
+        }
+
+        const int* tensorIds;
+        int numTensors;
+        if (TfLiteOpaqueNodeInputs(tfLiteNode, &tensorIds, &numTensors) == kTfLiteOk)
+        {
+            addTensors(tensorIds, numTensors);
+        }
+        if (TfLiteOpaqueNodeOutputs(tfLiteNode, &tensorIds, &numTensors) == kTfLiteOk)
+        {
+            addTensors(tensorIds, numTensors);
+        }
+    }
+    return key;
+}
+
+/// Buffers allocated in the TfLite arena stay at the same address between invocations until the interpreter
+/// reallocates its tensors, so they are worth importing once rather than copying on every run.
+bool IsArenaAllocated(const TfLiteOpaqueTensor* tensor)
+{
+    const TfLiteAllocationType allocationType = TfLiteOpaqueTensorGetAllocationType(tensor);
+    return allocationType == kTfLiteArenaRw || allocationType == kTfLiteArenaRwPersistent;
+}
+
+} // anonymous namespace
+
 ArmnnSubgraph* ArmnnSubgraph::Create(TfLiteOpaqueContext* tfLiteContext,
                                      const TfLiteOpaqueDelegateParams* parameters,
                                      const ArmnnOpaqueDelegate* delegate)
@@ -508,28 +594,49 @@ ArmnnSubgraph* ArmnnSubgraph::Create(TfLiteOpaqueContext* tfLiteContext,
         throw armnn::Exception("TfLiteArmnnOpaqueDelegate: Unable to add Outputs to the network!");
     }
 
-    // Optimize ArmNN network
+    // Load the optimized network from the cache entry of this subgraph, if there is a cache directory
+    armnn::OptimizerOptionsOpaque optimizerOptions = delegate->m_Options.GetOptimizerOptions();
+    std::unique_ptr<armnnDelegate::SubgraphCacheEntry> cacheEntry;
     armnn::IOptimizedNetworkPtr optNet(nullptr, nullptr);
-    try
-    {
-        const auto optimizeStartTime = armnn::GetTimeNow();
-        optNet = armnn::Optimize(*(delegateData.m_Network.get()),
-                                 delegate->m_Options.GetBackends(),
-                                 delegate->m_Runtime->GetDeviceSpec(),
-                                 delegate->m_Options.GetOptimizerOptions());
-        ARMNN_LOG(info) << "Optimize ArmnnSubgraph time: " << std::setprecision(2)
-                        << std::fixed << armnn::GetTimeDuration(optimizeStartTime).count() << " ms";
-    }
-    catch (std::exception& ex)
+    if (!delegate->m_Options.GetSubgraphCacheDirectory().empty())
     {
-        std::stringstream exMessage;
-        exMessage << "TfLiteArmnnOpaqueDelegate: Exception (" << ex.what() << ") caught from optimize.";
-        throw armnn::Exception(exMessage.str());
+        cacheEntry = std::make_unique<armnnDelegate::SubgraphCacheEntry>(
+            delegate->m_Options.GetSubgraphCacheDirectory(),
+            GetSubgraphCacheKey(tfLiteContext, parameters, delegate->m_Options),
+            delegate->m_Options.GetBackends());
+        cacheEntry->AddModelOptions(optimizerOptions);
+        optNet = cacheEntry->LoadOptimizedNetwork(optimizerOptions.GetModelOptions());
     }
+
+    // Optimize ArmNN network
     if (!optNet)
     {
-        // Optimize failed
-        throw armnn::Exception("TfLiteArmnnOpaqueDelegate: Unable to optimize the network!");
+        try
+        {
+            const auto optimizeStartTime = armnn::GetTimeNow();
+            optNet = armnn::Optimize(*(delegateData.m_Network.get()),
+                                     delegate->m_Options.GetBackends(),
+                                     delegate->m_Runtime->GetDeviceSpec(),
+                                     optimizerOptions);
+            ARMNN_LOG(info) << "Optimize ArmnnSubgraph time: " << std::setprecision(2)
+                            << std::fixed << armnn::GetTimeDuration(optimizeStartTime).count() << " ms";
+        }
+        catch (std::exception& ex)
+        {
+            std::stringstream exMessage;
+            exMessage << "TfLiteArmnnOpaqueDelegate: Exception (" << ex.what() << ") caught from optimize.";
+            throw armnn::Exception(exMessage.str());
+        }
+        if (!optNet)
+        {
+            // Optimize failed
+            throw armnn::Exception("TfLiteArmnnOpaqueDelegate: Unable to optimize the network!");
+        }
+
+        if (cacheEntry)
+        {
+            cacheEntry->SaveOptimizedNetwork(*optNet);
+        }
     }
 
     // If set, we will serialize the optimized model into a dot file.
@@ -575,6 +682,11 @@ ArmnnSubgraph* ArmnnSubgraph::Create(TfLiteOpaqueContext* tfLiteContext,
             throw armnn::Exception("TfLiteArmnnOpaqueDelegate: Network could not be loaded: " + errorMessage);
         }
 
+        if (cacheEntry)
+        {
+            cacheEntry->Finish(true);
+        }
+
         ARMNN_LOG(info) << "Load ArmnnSubgraph time: " << std::setprecision(2)
                         << std::fixed << armnn::GetTimeDuration(loadStartTime).count() << " ms";
     }
@@ -595,7 +707,11 @@ ArmnnSubgraph* ArmnnSubgraph::Create(TfLiteOpaqueContext* tfLiteContext,
                     << std::fixed << armnn::GetTimeDuration(startTime).count() << " ms\n";
 
     // Create a new SubGraph with networkId and runtime
-    return new ArmnnSubgraph(networkId, delegate->m_Runtime, inputBindings, outputBindings);
+    return new ArmnnSubgraph(networkId,
+                             delegate->m_Runtime,
+                             inputBindings,
+                             outputBindings,
+                             delegate->m_Options.GetInternalProfilingState());
 }
 
 TfLiteStatus ArmnnSubgraph::Prepare(TfLiteOpaqueContext* tfLiteContext)
@@ -604,6 +720,60 @@ TfLiteStatus ArmnnSubgraph::Prepare(TfLiteOpaqueContext* tfLiteContext)
     return kTfLiteOk;
 }
 
+bool ArmnnSubgraph::ImportInput(size_t inputIndex, armnn::LayerBindingId bindingId, const armnn::ConstTensor& tensor)
+{
+    ImportedBuffer& importedInput = m_ImportedInputs[inputIndex];
+    if (importedInput.m_Buffer == tensor.GetMemoryArea())
+    {
+        // A buffer which could not be imported is not retried until TfLite moves it.
+        return importedInput.m_Imported;
+    }
+
+    importedInput.m_Buffer = tensor.GetMemoryArea();
+    importedInput.m_Imported = false;
+    try
+    {
+        std::vector<armnn::ImportedInputId> importedIds =
+            m_Runtime->ImportInputs(m_NetworkId, { { bindingId, tensor } }, armnn::MemorySource::Malloc);
+        if (importedIds.size() == 1)
+        {
+            importedInput.m_Imported = true;
+            importedInput.m_ImportedId = importedIds[0];
+        }
+    }
+    catch (const armnn::Exception& ex)
+    {
+        ARMNN_LOG(debug) << "TfLiteArmnnOpaqueDelegate: Input " << bindingId << " will be copied: " << ex.what();
+    }
+    return importedInput.m_Imported;
+}
+
+void ArmnnSubgraph::ImportOutputs(const armnn::OutputTensors& outputTensors)
+{
+    std::vector<const void*> outputBuffers;
+    outputBuffers.reserve(outputTensors.size());
+    for (const auto& outputTensor : outputTensors)
+    {
+        outputBuffers.push_back(outputTensor.second.GetMemoryArea());
+    }
+    if (outputBuffers == m_OutputBuffers)
+    {
+        return;
+    }
+
+    // Outputs which cannot be imported are left out of the returned ids and are copied as before.
+    m_OutputBuffers = std::move(outputBuffers);
+    m_ImportedOutputIds.clear();
+    try
+    {
+        m_ImportedOutputIds = m_Runtime->ImportOutputs(m_NetworkId, outputTensors, armnn::MemorySource::Malloc);
+    }
+    catch (const armnn::Exception& ex)
+    {
+        ARMNN_LOG(debug) << "TfLiteArmnnOpaqueDelegate: Outputs will be copied: " << ex.what();
+    }
+}
+
 TfLiteStatus ArmnnSubgraph::Invoke(TfLiteOpaqueContext* tfLiteContext, TfLiteOpaqueNode* tfLiteNode)
 {
     // Get array of input indices, inputIndexArray is set from the TfLiteOpaqueNodeInputs function
@@ -615,8 +785,9 @@ TfLiteStatus ArmnnSubgraph::Invoke(TfLiteOpaqueContext* tfLiteContext, TfLiteOpa
     {
         throw armnn::Exception("TfLiteArmnnOpaqueDelegate: Unable to load subgraph inputs!");
     }
-    // Prepare inputs
+    // Prepare inputs. Arena buffers are bound to the network once and only passed by id afterwards.
     armnn::InputTensors inputTensors;
+    std::vector<armnn::ImportedInputId> importedInputIds;
     size_t inputIndex = 0;
     for (int inputIdx = 0; inputIdx < numInputs; inputIdx++)
     {
@@ -633,7 +804,14 @@ TfLiteStatus ArmnnSubgraph::Invoke(TfLiteOpaqueContext* tfLiteContext, TfLiteOpa
             armnn::TensorInfo inputTensorInfo = inputBinding.second;
             inputTensorInfo.SetConstant(true);
             const armnn::ConstTensor inputTensor(inputTensorInfo, TfLiteOpaqueTensorData(tensor));
-            inputTensors.emplace_back(inputIndexArray[inputIdx], inputTensor);
+            if (IsArenaAllocated(tensor) && ImportInput(inputIndex, inputIndexArray[inputIdx], inputTensor))
+            {
+                importedInputIds.push_back(m_ImportedInputs[inputIndex].m_ImportedId);
+            }
+            else
+            {
+                inputTensors.emplace_back(inputIndexArray[inputIdx], inputTensor);
+            }
 
             ++inputIndex;
         }
@@ -650,6 +828,7 @@ TfLiteStatus ArmnnSubgraph::Invoke(TfLiteOpaqueContext* tfLiteContext, TfLiteOpa
     }
     // Assign the tensors from the outputIndexArray to the armnn BindingPointInfo
     armnn::OutputTensors outputTensors;
+    bool outputsInArena = true;
     for (int outputIdx = 0; outputIdx < numOutputs; outputIdx++)
     {
         const armnn::BindingPointInfo& outputBinding = m_OutputBindings[outputIdx];
@@ -662,17 +841,30 @@ TfLiteStatus ArmnnSubgraph::Invoke(TfLiteOpaqueContext* tfLiteContext, TfLiteOpa
         const armnn::Tensor outputTensor(outputBinding.second, reinterpret_cast<TfLiteTensor*>(tensor)->data
         .data);
         outputTensors.emplace_back(outputIndexArray[outputIdx], outputTensor);
+        outputsInArena = outputsInArena && IsArenaAllocated(tensor);
+    }
+
+    // The runtime can only import the outputs all together.
+    std::vector<armnn::ImportedOutputId> importedOutputIds;
+    if (outputsInArena)
+    {
+        ImportOutputs(outputTensors);
+        importedOutputIds = m_ImportedOutputIds;
     }
 
     // Run graph
     try
     {
-        auto status = m_Runtime->EnqueueWorkload(m_NetworkId, inputTensors, outputTensors);
+        auto status = m_Runtime->EnqueueWorkload(m_NetworkId, inputTensors, outputTensors,
+                                                 importedInputIds, importedOutputIds);
         // The delegate holds its own Arm NN runtime so this is our last chance to print internal profiling data.
-        std::shared_ptr<armnn::IProfiler> profiler = m_Runtime->GetProfiler(m_NetworkId);
-        if (profiler && profiler->IsProfilingEnabled())
+        if (m_ProfilingEnabled)
         {
-            profiler->Print(std::cout);
+            std::shared_ptr<armnn::IProfiler> profiler = m_Runtime->GetProfiler(m_NetworkId);
+            if (profiler && profiler->IsProfilingEnabled())
+            {
+                profiler->Print(std::cout);
+            }
         }
         return (status == armnn::Status::Success) ? kTfLiteOk : kTfLiteError;
     }
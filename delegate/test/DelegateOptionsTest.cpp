@@ -9,6 +9,8 @@
 
 #include <doctest/doctest.h>
 
+#include <algorithm>
+
 namespace armnnDelegate
 {
 
@@ -206,6 +208,65 @@ TEST_CASE ("ArmnnDelegateStringParsingOptionEnableTfLiteRuntimeFallback")
                                                                                                  == std::string::npos);
 }
 
+TEST_CASE ("ArmnnDelegateSubgraphCache")
+{
+    std::vector<armnn::BackendId> backends = { armnn::Compute::CpuRef };
+    std::vector<int32_t> tensorShape { 1, 2, 2, 1 };
+    std::vector<float> inputData = { 1, 2, 3, 4 };
+    std::vector<float> divData = { 2, 2, 3, 4 };
+    std::vector<float> expectedResult = { 1, 2, 2, 2 };
+
+    const fs::path cacheDirectory(fs::temp_directory_path() / "ArmnnDelegateSubgraphCacheCpuRef");
+    fs::remove_all(cacheDirectory);
+
+    auto getCacheFiles = [&cacheDirectory]()
+    {
+        std::vector<fs::path> files;
+        for (const auto& entry : fs::directory_iterator(cacheDirectory))
+        {
+            files.push_back(entry.path());
+        }
+        return files;
+    };
+
+    armnn::OptimizerOptionsOpaque optimizerOptions(false, false, false, false);
+    armnnDelegate::DelegateOptions delegateOptions(backends, optimizerOptions);
+    delegateOptions.SetSubgraphCacheDirectory(cacheDirectory.string());
+
+    // The first interpreter saves the optimized subgraph, the second one loads it back rather than optimizing it.
+    DelegateOptionTest<float>(::tflite::TensorType_FLOAT32,
+                              tensorShape,
+                              inputData,
+                              inputData,
+                              divData,
+                              expectedResult,
+                              delegateOptions);
+    std::vector<fs::path> cacheFiles = getCacheFiles();
+#if defined(ARMNN_SERIALIZER)
+    REQUIRE(cacheFiles.size() == 1);
+    CHECK(cacheFiles[0].extension() == ".armnn");
+    CHECK(fs::file_size(cacheFiles[0]) > 0);
+    const auto lastWriteTime = fs::last_write_time(cacheFiles[0]);
+#else
+    CHECK(cacheFiles.empty());
+#endif
+
+    DelegateOptionTest<float>(::tflite::TensorType_FLOAT32,
+                              tensorShape,
+                              inputData,
+                              inputData,
+                              divData,
+                              expectedResult,
+                              delegateOptions);
+    CHECK(getCacheFiles() == cacheFiles);
+#if defined(ARMNN_SERIALIZER)
+    CHECK(fs::last_write_time(cacheFiles[0]) == lastWriteTime);
+#endif
+
+    // Clean up.
+    fs::remove_all(cacheDirectory);
+}
+
 }
 
 TEST_SUITE("DelegateOptions_CpuAccTests")
@@ -371,4 +432,70 @@ TEST_CASE ("ArmnnDelegateStringParsingOptionReduceFp32ToFp16")
 
 }
 
+TEST_SUITE("DelegateOptions_GpuAccTests")
+{
+
+TEST_CASE ("ArmnnDelegateSubgraphCacheGpuAccPrograms")
+{
+    std::vector<armnn::BackendId> backends = { armnn::Compute::GpuAcc };
+    std::vector<int32_t> tensorShape { 1, 2, 2, 1 };
+    std::vector<float> inputData = { 1, 2, 3, 4 };
+    std::vector<float> divData = { 2, 2, 3, 4 };
+    std::vector<float> expectedResult = { 1, 2, 2, 2 };
+
+    std::vector<armnn::BackendId> availableBackends = CaptureAvailableBackends(backends);
+    // It's possible that GpuAcc isn't supported. In that case availableBackends will be empty.
+    if (availableBackends.empty())
+    {
+        return;
+    }
+
+    const fs::path cacheDirectory(fs::temp_directory_path() / "ArmnnDelegateSubgraphCache");
+    fs::remove_all(cacheDirectory);
+
+    auto getCacheFiles = [&cacheDirectory]()
+    {
+        std::vector<fs::path> files;
+        for (const auto& entry : fs::directory_iterator(cacheDirectory))
+        {
+            files.push_back(entry.path());
+        }
+        return files;
+    };
+
+    armnn::OptimizerOptionsOpaque optimizerOptions(false, false, false, false);
+    armnnDelegate::DelegateOptions delegateOptions(availableBackends, optimizerOptions);
+    delegateOptions.SetSubgraphCacheDirectory(cacheDirectory.string());
+
+    // The first interpreter saves the compiled subgraph, the second one loads it back.
+    DelegateOptionTest<float>(::tflite::TensorType_FLOAT32,
+                              tensorShape,
+                              inputData,
+                              inputData,
+                              divData,
+                              expectedResult,
+                              delegateOptions);
+    std::vector<fs::path> cacheFiles = getCacheFiles();
+    auto programsFile = std::find_if(cacheFiles.begin(), cacheFiles.end(),
+                                     [](const fs::path& file) { return file.extension() == ".bin"; });
+    REQUIRE(programsFile != cacheFiles.end());
+    CHECK(fs::file_size(*programsFile) > 0);
+    const auto lastWriteTime = fs::last_write_time(*programsFile);
+
+    DelegateOptionTest<float>(::tflite::TensorType_FLOAT32,
+                              tensorShape,
+                              inputData,
+                              inputData,
+                              divData,
+                              expectedResult,
+                              delegateOptions);
+    CHECK(getCacheFiles() == cacheFiles);
+    CHECK(fs::last_write_time(*programsFile) == lastWriteTime);
+
+    // Clean up.
+    fs::remove_all(cacheDirectory);
+}
+
+}
+
 } // namespace armnnDelegate
@@ -1,5 +1,5 @@
 //
-// Copyright © 2017-2023 Arm Ltd and Contributors. All rights reserved.
+// Copyright © 2017-2024 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 #pragma once
@@ -51,7 +51,7 @@ struct ActivationDescriptor : BaseDescriptor
 
     bool operator ==(const ActivationDescriptor &rhs) const
     {
-        return m_Function == rhs.m_Function && m_A == rhs.m_B && m_B == rhs.m_B;
+        return m_Function == rhs.m_Function && m_A == rhs.m_A && m_B == rhs.m_B;
     }
 
     /// @brief The activation function to use
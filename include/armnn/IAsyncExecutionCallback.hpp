@@ -1,5 +1,5 @@
 //
-// Copyright © 2021 Arm Ltd and Contributors. All rights reserved.
+// Copyright © 2021, 2024 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 
@@ -7,6 +7,8 @@
 
 #include "Types.hpp"
 
+#include <armnn/utility/IgnoreUnused.hpp>
+
 namespace armnn
 {
 
@@ -23,6 +25,20 @@ public:
 
     // Notify the AsyncExecutionCallback object of the armnn execution status
     virtual void Notify(armnn::Status status, InferenceTimingPair timeTaken) = 0;
+
+    // Notify the AsyncExecutionCallback object of the time the execution was scheduled at and the time it started at,
+    // i.e. of the time it waited in the queue, which isn't part of the time taken given to Notify. Called before Notify
+    virtual void NotifyQueueingTime(InferenceTimingPair queueingTime)
+    {
+        IgnoreUnused(queueingTime);
+    }
+
+    // Notify the AsyncExecutionCallback object that the execution was rejected without being run, as it can't complete
+    // before its deadline. Called instead of Notify, and notifies a failure by default
+    virtual void NotifyRejected(HighResolutionClock time)
+    {
+        Notify(armnn::Status::Failure, std::make_pair(time, time));
+    }
 };
 
 } // experimental
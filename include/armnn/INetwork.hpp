@@ -1,5 +1,5 @@
 //
-// Copyright © 2017-2023 Arm Ltd and Contributors. All rights reserved.
+// Copyright © 2017-2024 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 #pragma once
@@ -12,9 +12,11 @@
 #include <armnn/Optional.hpp>
 #include <armnn/TensorFwd.hpp>
 #include <armnn/Logging.hpp>
+#include <armnn/backends/ITensorHandleFactory.hpp>
 #include <armnn/backends/TensorHandle.hpp>
 
 #include <memory>
+#include <unordered_map>
 #include <vector>
 
 namespace armnn
@@ -304,8 +306,16 @@ public:
 
     bool GetDebugToFileEnabled() const;
 
+    bool GetDebugToNpyFileEnabled() const;
+
+    std::vector<std::string> GetDebugToFileLayers() const;
+
     bool GetAllowExpandedDims() const;
 
+    bool GetFoldConstantLayersEnabled() const;
+
+    size_t GetMaxFoldedTensorBytes() const;
+
     armnn::ModelOptions GetModelOptions() const;
 
     armnn::ShapeInferenceMethod GetShapeInferenceMethod() const;
@@ -320,6 +330,15 @@ public:
 
     void SetDebugToFileEnabled(bool DebugFileState);
 
+    /// Writes the intermediate tensors of debug to file as binary NumPy .npy files, from a background thread, rather
+    /// than as text. Has no effect unless debug to file is enabled. The files of an inference may still be in the
+    /// process of being written when it returns; they have all been written once the network is unloaded.
+    void SetDebugToNpyFileEnabled(bool DebugNpyFileState);
+
+    /// Restricts debug to file to the outputs of the layers with the given names or GUIDs. All layers are written when
+    /// the list is empty, which is the default.
+    void SetDebugToFileLayers(const std::vector<std::string>& DebugFileLayers);
+
     void SetReduceFp32ToFp16(bool ReduceFp32ToFp16State);
 
     void SetShapeInferenceMethod(armnn::ShapeInferenceMethod ShapeInferenceMethodType);
@@ -328,6 +347,14 @@ public:
 
     void SetAllowExpandedDims(bool ExpandedDimsAllowed);
 
+    /// Evaluates the layers whose inputs are all constant once, at optimize time, replacing them with constant
+    /// layers holding their outputs. Enabled by default.
+    void SetFoldConstantLayersEnabled(bool FoldConstantLayersState);
+
+    /// Largest output, in bytes, a layer is folded into when folding it grows the model, i.e. when its constant inputs
+    /// are used by other layers as well. 1 MiB by default.
+    void SetMaxFoldedTensorBytes(size_t MaxFoldedTensorBytes);
+
 private:
 
     std::unique_ptr<armnn::OptimizerOptionsOpaqueImpl> p_OptimizerOptionsImpl;
@@ -342,6 +369,24 @@ using IOptimizedNetworkPtr = std::unique_ptr<IOptimizedNetwork, void(*)(IOptimiz
 using CompiledBlobDeleter = std::function<void(const void*)>;
 using CompiledBlobPtr = std::unique_ptr<void, CompiledBlobDeleter>;
 
+/// The choices Optimize made for a layer which an INetwork has no way to express: the backend the layer runs on and
+/// how its tensors are handed over from one layer to the next.
+struct OptimizedLayerPlacement
+{
+    BackendId m_BackendId;
+
+    /// For each output slot, the id of the tensor handle factory which creates its tensor.
+    std::vector<ITensorHandleFactory::FactoryId> m_OutputTensorHandleFactoryIds;
+
+    /// For each input slot, the strategy of the connection to it.
+    std::vector<EdgeStrategy> m_InputEdgeStrategies;
+
+    /// The activation a backend fused into the layer, kept by the layer as its additional information, or null.
+    std::shared_ptr<ActivationDescriptor> m_FusedActivation;
+};
+
+using OptimizedLayerPlacements = std::unordered_map<LayerGuid, OptimizedLayerPlacement>;
+
 /// Main network class which provides the interface for building up a neural network.
 /// This object is subsequently required by the IRuntime::Load() method.
 class INetwork
@@ -864,6 +909,27 @@ public:
     IConnectableLayer* AddBroadcastToLayer(const BroadcastToDescriptor& descriptor,
                                            const char* name = nullptr);
 
+    /// Adds a layer which copies its input to its output. Optimize adds these between layers whose tensors can't be
+    /// shared; they are only needed when rebuilding a network which has already been optimized.
+    /// @param name - Optional name for the layer
+    /// @return - Interface for configuring the layer
+    IConnectableLayer* AddMemCopyLayer(const char* name = nullptr);
+
+    /// Adds a layer which imports its input into its output. See AddMemCopyLayer.
+    /// @param name - Optional name for the layer
+    /// @return - Interface for configuring the layer
+    IConnectableLayer* AddMemImportLayer(const char* name = nullptr);
+
+    /// Adds a layer which converts its input from Float16 to Float32. See AddMemCopyLayer.
+    /// @param name - Optional name for the layer
+    /// @return - Interface for configuring the layer
+    IConnectableLayer* AddConvertFp16ToFp32Layer(const char* name = nullptr);
+
+    /// Adds a layer which converts its input from Float32 to Float16. See AddMemCopyLayer.
+    /// @param name - Optional name for the layer
+    /// @return - Interface for configuring the layer
+    IConnectableLayer* AddConvertFp32ToFp16Layer(const char* name = nullptr);
+
     void ExecuteStrategy(IStrategy& strategy) const;
 
 protected:
@@ -882,6 +948,9 @@ protected:
                                          const IDeviceSpec& deviceSpec,
                                          const OptimizerOptionsOpaque& options,
                                          Optional<std::vector<std::string>&> messages);
+    friend IOptimizedNetworkPtr CreateOptimizedNetwork(const INetwork& network,
+                                                       const OptimizedLayerPlacements& placements,
+                                                       const ModelOptions& modelOptions);
 
     INetwork(NetworkOptions networkOptions = {});
 
@@ -913,6 +982,9 @@ public:
 
     void ExecuteStrategy(IStrategy& strategy) const;
 
+    /// Returns the choices Optimize made for a layer of this network, such as one passed to ExecuteStrategy.
+    OptimizedLayerPlacement GetLayerPlacement(const IConnectableLayer& layer) const;
+
     /// Creates a copy of the IOptimizedNetwork. The IOptimizedNetwork will not be reoptimized,
     /// the provided ModelOptions will only be used when creating a LoadedNetwork.
     IOptimizedNetwork(const IOptimizedNetwork& other, const ModelOptions& modelOptions);
@@ -940,6 +1012,9 @@ protected:
                                          const IDeviceSpec& deviceSpec,
                                          const OptimizerOptionsOpaque& options,
                                          Optional<std::vector<std::string>&> messages);
+    friend IOptimizedNetworkPtr CreateOptimizedNetwork(const INetwork& network,
+                                                       const OptimizedLayerPlacements& placements,
+                                                       const ModelOptions& modelOptions);
 
     IOptimizedNetwork(std::unique_ptr<Graph> graph, const ModelOptions& modelOptions);
 
@@ -990,4 +1065,14 @@ IOptimizedNetworkPtr Optimize(const INetwork& network,
                               const OptimizerOptions& options,
                               Optional<std::vector<std::string>&> messages = EmptyOptional());
 
+/// Rebuilds a network which has already been optimized, e.g. one that has been serialized, without optimizing it again.
+/// @param network INetwork holding the layers of the optimized network, including the ones Optimize added.
+/// @param placements The placement of each layer of network, by layer guid. See IOptimizedNetwork::GetLayerPlacement.
+/// @param modelOptions The ModelOptions used when creating a LoadedNetwork.
+/// @return An IOptimizedNetworkPtr interface to the optimized network, throws an InvalidArgumentException if a layer
+/// has no placement or one which doesn't match its slots.
+IOptimizedNetworkPtr CreateOptimizedNetwork(const INetwork& network,
+                                            const OptimizedLayerPlacements& placements,
+                                            const ModelOptions& modelOptions = {});
+
 } //namespace armnn
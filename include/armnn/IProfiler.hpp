@@ -1,5 +1,5 @@
 //
-// Copyright © 2017 Arm Ltd. All rights reserved.
+// Copyright © 2017, 2024 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 
@@ -39,10 +39,23 @@ public:
     /// @param [out] outStream The stream where to write the profiling results to.
     void Print(std::ostream& outStream) const;
 
+    /// Print the events in the Chrome Trace Event format to the given output stream, which chrome://tracing and
+    /// Perfetto load. Events are drawn on the track of the thread which ran them, along with their backend, GUID and
+    /// measurements, and each inference is drawn as a span of its own so that concurrent inferences can be told apart.
+    /// @param [out] outStream The stream where to write the trace to.
+    void PrintChromeTrace(std::ostream& outStream) const;
+
     /// Print out details of each layer within the network that possesses a descriptor.
     /// Also outputs tensor info. This will be part of the profiling json output
     void EnableNetworkDetailsToStdOut(ProfilingDetailsMethod detailsMethod);
 
+    /// Enables/disables counting the cycles, instructions, cache misses and branch misses of each profiling event,
+    /// along with its CPU time and page faults, using the Linux perf events of the thread it runs on.
+    /// The counts are added to the measurements of each event. Counters which aren't available, e.g. hardware
+    /// counters inside a virtual machine, are left out. Has no effect on other platforms.
+    /// @param [in] enableHardwareCounters A flag that indicates whether the counters should be recorded or not.
+    void EnableHardwareCounters(bool enableHardwareCounters);
+
     ~IProfiler();
     IProfiler();
 
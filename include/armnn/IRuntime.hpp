@@ -1,5 +1,5 @@
 //
-// Copyright © 2017-2023 Arm Ltd and Contributors. All rights reserved.
+// Copyright © 2017-2024 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 #pragma once
@@ -248,6 +248,12 @@ public:
     void ClearImportedOutputs(NetworkId networkId, const std::vector<ImportedOutputId> outputIds);
 
     /// Evaluates a network using input in inputTensors and outputs filled into outputTensors
+    /// When the network was optimized with the model option BackendOptions("Global", {{"ShapeCacheSize", n}}) and n
+    /// is not 0, the inputs may have shapes other than the ones the network was optimized with. The workloads and
+    /// working memory are prepared again for each new set of input shapes, with the shapes of every other tensor
+    /// inferred from them as with ShapeInferenceMethod::InferAndValidate. n of them are kept for reuse, the least
+    /// recently used being dropped first. The layers of the network keep their constant tensors, such as weights,
+    /// rather than releasing them once the workloads are created.
     Status EnqueueWorkload(NetworkId networkId,
                            const InputTensors& inputTensors,
                            const OutputTensors& outputTensors,
@@ -1,5 +1,5 @@
 //
-// Copyright © 2021-2022 Arm Ltd and Contributors. All rights reserved.
+// Copyright © 2021-2022, 2024 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 #if !defined(ARMNN_DISABLE_THREADS)
@@ -7,9 +7,11 @@
 #pragma once
 
 #include "IRuntime.hpp"
+#include <armnn/Optional.hpp>
 #include <armnn/Tensor.hpp>
 #include <armnn/Types.hpp>
 #include <stdint.h>
+#include <atomic>
 #include <thread>
 #include <mutex>
 #include <condition_variable>
@@ -27,21 +29,62 @@ namespace experimental
 class IAsyncExecutionCallback;
 class IWorkingMemHandle;
 
+/// The order in which the Threadpool runs the inferences scheduled on it.
+enum class SchedulingPolicy
+{
+    /// Inferences with a higher QosExecPriority first, with lower priorities run after EXPIRE_RATE higher priority
+    /// inferences in a row so that they don't starve.
+    Priority = 0,
+    /// Inferences with an earlier deadline first. Inferences scheduled without a deadline run last.
+    EarliestDeadlineFirst = 1,
+    /// Inferences of each network in turn, giving each network a share of the threads proportional to its weight, see
+    /// Threadpool::SetNetworkWeight(). Self-clocked fair queuing, costing inferences with their estimated duration.
+    WeightedFairQueuing = 2
+};
+
+/// Runs the inferences scheduled on it on a pool of threads.
+/// Each thread has a queue of its own, and threads which run out of work steal from the others, taking the work which
+/// comes first according to the scheduling policy. Inferences borrow a working memory handle from the pool of handles
+/// of their network for as long as they run, preferring the handle the thread used last, so networks need as many
+/// handles as inferences which may run on them at once rather than one per thread. Threads only take inferences whose
+/// network has a free handle, passing over the others, so that a network running out of handles doesn't hold up the
+/// inferences of the other networks.
+///
+/// Inferences scheduled with a deadline are rejected straight away, through IAsyncExecutionCallback::NotifyRejected(),
+/// when the work ahead of them and their own estimated duration would take them past it. The work ahead, queued or
+/// left of the inferences running, is shared between the threads, except for the inferences of the same network which
+/// can't run on more threads at once than it has handles. The duration of the inferences of each network is estimated
+/// from the ones which ran before, so nothing is rejected until the network has run at least once, unless its deadline
+/// has already passed.
 class Threadpool
 {
 public:
+    /// @param numThreads Number of threads running the inferences.
+    /// @param runtimePtr Runtime the networks are loaded in.
+    /// @param memHandles Working memory handles of a network, see LoadMemHandles().
+    /// @param cpuIds CPUs the threads are pinned to, in turn, e.g. { 4, 5, 6, 7 } for the big cores of a big.LITTLE
+    ///               CPU. The threads aren't pinned if empty, nor on platforms other than Linux.
+    /// @param policy Order in which the inferences are run.
     Threadpool(std::size_t numThreads,
                IRuntime* runtimePtr,
-               std::vector<std::shared_ptr<IWorkingMemHandle>> memHandles);
+               std::vector<std::shared_ptr<IWorkingMemHandle>> memHandles,
+               std::vector<unsigned int> cpuIds = {},
+               SchedulingPolicy policy = SchedulingPolicy::Priority);
 
-    ~Threadpool()
-    {
-        TerminateThreadPool();
-    }
+    ~Threadpool();
 
+    /// Adds working memory handles to the pool of handles of their network. The handles must all belong to the same
+    /// network, and there must be at least one.
     void LoadMemHandles(std::vector<std::shared_ptr<IWorkingMemHandle>> memHandles);
+
+    /// Removes the pool of handles of the network. Inferences still running on the network keep their handle until
+    /// they are done.
     void UnloadMemHandles(NetworkId networkId);
 
+    /// Sets the share of the threads the inferences of the network get relative to the other networks under the
+    /// WeightedFairQueuing policy. Networks have a weight of 1 by default.
+    void SetNetworkWeight(NetworkId networkId, unsigned int weight);
+
     /// Schedule an asynchronous execution on the loaded network
     void Schedule(NetworkId networkId,
                   const InputTensors &inputTensors,
@@ -49,23 +92,82 @@ public:
                   const QosExecPriority priority,
                   std::shared_ptr<IAsyncExecutionCallback> cb);
 
+    /// Schedule an asynchronous execution on the loaded network which must complete before the deadline, or be
+    /// rejected if it can't. It has a Medium priority under the Priority policy.
+    void Schedule(NetworkId networkId,
+                  const InputTensors &inputTensors,
+                  const OutputTensors &outputTensors,
+                  HighResolutionClock deadline,
+                  std::shared_ptr<IAsyncExecutionCallback> cb);
+
     void TerminateThreadPool() noexcept;
 
 private:
-    using ExecutionTuple = std::tuple<NetworkId,
-                                      InputTensors,
-                                      OutputTensors,
-                                      std::shared_ptr<IAsyncExecutionCallback>>;
+    struct Execution;
+    class WorkerQueues;
+    class NetworkState;
 
-    using ExecutionQueue = std::queue<std::shared_ptr<ExecutionTuple>>;
+    using ExecutionPtr = std::unique_ptr<Execution>;
+
+    /// The working memory handle a thread used last for each network.
+    using LastMemHandles = std::unordered_map<NetworkId, const IWorkingMemHandle*>;
 
     void ProcessExecPriorities(uint32_t index);
 
+    void ScheduleExecution(NetworkId networkId,
+                           const InputTensors& inputTensors,
+                           const OutputTensors& outputTensors,
+                           QosExecPriority priority,
+                           Optional<HighResolutionClock> deadline,
+                           std::shared_ptr<IAsyncExecutionCallback> cb);
+
+    /// Takes the next execution which can start from the queues of the thread, or steals one from the other threads.
+    ExecutionPtr TakeExecution(uint32_t index,
+                               unsigned int& highPriorityCount,
+                               unsigned int& mediumPriorityCount,
+                               LastMemHandles& lastMemHandles);
+
+    /// Takes the execution which can start which comes first in all the queues, under the EarliestDeadlineFirst and
+    /// WeightedFairQueuing policies.
+    ExecutionPtr TakeFirstExecution(LastMemHandles& lastMemHandles);
+
+    /// Whether the network of the execution has a free working memory handle, or has been unloaded.
+    bool CanStartExecution(const Execution& execution);
+
+    /// Acquires a free working memory handle of the network of the execution for it to run with, preferring the one
+    /// the thread used last. Returns false, leaving the execution as it is, if all the handles are in use. Executions
+    /// of networks which have been unloaded can always start, to be failed.
+    bool TryStartExecution(Execution& execution, LastMemHandles& lastMemHandles);
+
+    /// Wakes up a worker waiting for executions which can start.
+    void NotifyWorkers();
+
+    std::shared_ptr<NetworkState> GetNetworkState(NetworkId networkId);
+
     IRuntime* m_RuntimePtr;
 
-    ExecutionQueue m_HighPriorityQueue;
-    ExecutionQueue m_MediumPriorityQueue;
-    ExecutionQueue m_LowPriorityQueue;
+    std::vector<unsigned int> m_CpuIds;
+
+    SchedulingPolicy m_Policy;
+
+    /// Time the deadlines and fair queuing tags are measured from.
+    HighResolutionClock m_Epoch;
+
+    /// Virtual time of the fair queuing, the tag of the last execution taken from the queues.
+    std::mutex m_FairQueuingMutex;
+    double m_VirtualTime;
+
+    std::vector<std::unique_ptr<WorkerQueues>> m_WorkerQueues;
+
+    /// Queue the next execution scheduled from outside of the pool is added to, in turn.
+    std::atomic<uint32_t> m_NextQueue;
+
+    /// Number of executions in the queues.
+    std::atomic<std::size_t> m_NumPendingExecutions;
+
+    /// Number of times executions were scheduled, working memory handles released or loaded, or networks unloaded,
+    /// which threads wait on when none of the executions in the queues can start.
+    std::atomic<uint64_t> m_NumWorkEvents;
 
     // Condition Variables require mutex which will guard the shared state.
     // Has an event happened? Stop signal for example
@@ -73,9 +175,10 @@ private:
     std::mutex m_ThreadPoolMutex;
 
     // The shared state for conditional variable
-    bool m_TerminatePool = false;
+    std::atomic<bool> m_TerminatePool;
 
-    std::unordered_map<NetworkId, std::vector<std::shared_ptr<IWorkingMemHandle>>> m_WorkingMemHandleMap;
+    std::mutex m_NetworkStatesMutex;
+    std::unordered_map<NetworkId, std::shared_ptr<NetworkState>> m_NetworkStates;
     std::vector<std::unique_ptr<std::thread>> m_Threads;
 };
 
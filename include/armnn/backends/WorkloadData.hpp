@@ -492,6 +492,7 @@ struct DebugQueueDescriptor : QueueDescriptor
     unsigned int m_SlotIndex;
 
     bool m_LayerOutputToFile = false;
+    bool m_LayerOutputToNpyFile = false;
 };
 
 struct RsqrtQueueDescriptor : QueueDescriptor
@@ -16,6 +16,7 @@
 namespace armnn
 {
 
+class ILayerSupport;
 class Layer;
 
 // Workload factory interface for compute backends.
@@ -48,6 +49,14 @@ public:
                                  std::string& outReasonIfUnsupported,
                                  const ModelOptions& modelOptions);
 
+    /// Uses the given layer support object of the backend rather than creating the backend for the query, so that
+    /// callers asking about many layers can create it once.
+    static bool IsLayerSupported(const BackendId& backendId,
+                                 const std::shared_ptr<ILayerSupport>& layerSupport,
+                                 const IConnectableLayer& layer,
+                                 Optional<DataType> dataType,
+                                 std::string& outReasonIfUnsupported);
+
     virtual bool SupportsSubTensors() const = 0;
 
     ARMNN_DEPRECATED_MSG("Use ITensorHandleFactory::CreateSubTensorHandle instead")
@@ -78,6 +87,12 @@ private:
                                               Optional<DataType> dataType,
                                               std::string& outReasonIfUnsupported,
                                               const ModelOptions& modelOptions = {});
+
+    static bool IsLayerConfigurationSupported(const BackendId& backendId,
+                                              const std::shared_ptr<ILayerSupport>& layerSupport,
+                                              const IConnectableLayer& connectableLayer,
+                                              Optional<DataType> dataType,
+                                              std::string& outReasonIfUnsupported);
 };
 
 } // namespace armnn
@@ -37,6 +37,16 @@ public:
     /// Create an input network from a binary input stream
     armnn::INetworkPtr CreateNetworkFromBinary(std::istream& binaryContent);
 
+    /// Create an input network from a binary file. Where possible the file is memory mapped, so that the data of
+    /// constant tensors serialized as external data is copied into the network straight from the mapping.
+    armnn::INetworkPtr CreateNetworkFromBinaryFile(const char* graphFile);
+
+    /// Create an optimized network from binary file contents written by ISerializer::Serialize for an
+    /// IOptimizedNetwork. The network is not optimized again, so it can be passed straight to IRuntime::LoadNetwork.
+    /// @param modelOptions The ModelOptions used when creating the LoadedNetwork, as they are not serialized.
+    armnn::IOptimizedNetworkPtr CreateOptimizedNetworkFromBinary(const std::vector<uint8_t>& binaryContent,
+                                                                 const armnn::ModelOptions& modelOptions = {});
+
     /// Retrieve binding info (layer id and tensor info) for the network input identified by
     /// the given layer name and layers id
     BindingPointInfo GetNetworkInputBindingInfo(unsigned int layerId, const std::string& name) const;
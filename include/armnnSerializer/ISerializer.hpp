@@ -1,5 +1,5 @@
 //
-// Copyright © 2017 Arm Ltd. All rights reserved.
+// Copyright © 2017, 2024 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 #pragma once
@@ -21,10 +21,25 @@ public:
     static ISerializerPtr Create();
     static void Destroy(ISerializer* serializer);
 
-    /// Serializes the network to ArmNN SerializedGraph.
+    /// Serializes the network to ArmNN SerializedGraph. Each call replaces what was serialized before, so that a
+    /// serializer can be used for more than one network.
     /// @param [in] inNetwork The network to be serialized.
     void Serialize(const armnn::INetwork& inNetwork);
 
+    /// Serializes the network to ArmNN SerializedGraph.
+    /// @param [in] inNetwork The network to be serialized.
+    /// @param [in] externalConstantData If true the data of constant tensors is not stored in the SerializedGraph
+    ///             but in a page aligned section after it, each tensor starting on a 64 byte boundary. This lifts
+    ///             the 2 GB size limit of flatbuffers and lets the data be used straight from a memory mapped file.
+    void Serialize(const armnn::INetwork& inNetwork, bool externalConstantData);
+
+    /// Serializes the optimized network to ArmNN SerializedGraph. The backend each layer runs on, the layers
+    /// Optimize added and the tensor handle strategies are kept, so that
+    /// IDeserializer::CreateOptimizedNetworkFromBinary gives a network which can be loaded without optimizing it again.
+    /// @param [in] optimizedNetwork The optimized network to be serialized.
+    /// @param [in] externalConstantData See Serialize(const armnn::INetwork&, bool).
+    void Serialize(const armnn::IOptimizedNetwork& optimizedNetwork, bool externalConstantData = false);
+
     /// Serializes the SerializedGraph to the stream.
     /// @param [stream] the stream to save to
     /// @return true if graph is Serialized to the Stream, false otherwise
@@ -1,5 +1,5 @@
 //
-// Copyright © 2019 Arm Ltd. All rights reserved.
+// Copyright © 2019, 2024 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 
@@ -7,13 +7,9 @@
 
 #include "IBufferManager.hpp"
 #include "IConsumer.hpp"
+#include "PacketBufferQueue.hpp"
 
-#if !defined(ARMNN_DISABLE_THREADS)
-#include <mutex>
-#endif
-
-#include <vector>
-#include <queue>
+#include <atomic>
 
 namespace arm
 {
@@ -21,6 +17,8 @@ namespace arm
 namespace pipe
 {
 
+/// Hands out preallocated packet buffers and queues them up for the consumer once written. Both lists are lock-free
+/// queues, so threads reporting events at the same time, and the send thread reading them, don't wait on each other.
 class BufferManager : public IBufferManager
 {
 public:
@@ -50,26 +48,21 @@ public:
 private:
     void Initialize();
 
+    /// Puts a buffer back in the available list, or frees it if it is a surge buffer which isn't needed any more.
+    void MakeAvailable(IPacketBufferPtr& packetBuffer);
+
     // Maximum buffer size
     unsigned int m_MaxBufferSize;
     // Number of buffers
     const unsigned int m_NumberOfBuffers;
     const unsigned int m_MaxNumberOfBuffers;
-    unsigned int m_CurrentNumberOfBuffers;
+    std::atomic<unsigned int> m_CurrentNumberOfBuffers;
 
     // List of available packet buffers
-    std::vector<IPacketBufferPtr> m_AvailableList;
-
-    // List of readable packet buffers
-    std::queue<IPacketBufferPtr> m_ReadableList;
-
-#if !defined(ARMNN_DISABLE_THREADS)
-    // Mutex for available packet buffer list
-    std::mutex m_AvailableMutex;
+    PacketBufferQueue m_AvailableList;
 
-    // Mutex for readable packet buffer list
-    std::mutex m_ReadableMutex;
-#endif
+    // List of readable packet buffers, big enough for all the buffers there can be
+    PacketBufferQueue m_ReadableList;
 
     // Consumer thread to notify packet is ready to read
     IConsumer* m_Consumer = nullptr;
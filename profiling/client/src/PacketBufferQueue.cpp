@@ -0,0 +1,102 @@
+//
+// Copyright © 2024 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "PacketBufferQueue.hpp"
+
+namespace arm
+{
+
+namespace pipe
+{
+
+PacketBufferQueue::PacketBufferQueue(size_t capacity)
+    : m_Capacity(capacity > 0 ? capacity : 1)
+    , m_Slots(new Slot[m_Capacity])
+    , m_PushPosition(0)
+    , m_PopPosition(0)
+{
+    for (size_t i = 0; i < m_Capacity; ++i)
+    {
+        m_Slots[i].m_Sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+bool PacketBufferQueue::TryPush(IPacketBufferPtr& packetBuffer)
+{
+    size_t position = m_PushPosition.load(std::memory_order_relaxed);
+    Slot* slot = nullptr;
+    while (true)
+    {
+        slot = &m_Slots[position % m_Capacity];
+        const size_t sequence = slot->m_Sequence.load(std::memory_order_acquire);
+        if (sequence == position)
+        {
+            // The slot is free on this lap, claim it
+            if (m_PushPosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (sequence < position)
+        {
+            // The slot still holds the buffer pushed on the previous lap
+            return false;
+        }
+        else
+        {
+            // Another producer claimed the position first
+            position = m_PushPosition.load(std::memory_order_relaxed);
+        }
+    }
+
+    slot->m_PacketBuffer = std::move(packetBuffer);
+    slot->m_Sequence.store(position + 1, std::memory_order_release);
+    return true;
+}
+
+IPacketBufferPtr PacketBufferQueue::TryPop()
+{
+    size_t position = m_PopPosition.load(std::memory_order_relaxed);
+    Slot* slot = nullptr;
+    while (true)
+    {
+        slot = &m_Slots[position % m_Capacity];
+        const size_t sequence = slot->m_Sequence.load(std::memory_order_acquire);
+        if (sequence == position + 1)
+        {
+            // The slot has been pushed to on this lap, claim it
+            if (m_PopPosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (sequence < position + 1)
+        {
+            // Nothing has been pushed to the slot yet
+            return nullptr;
+        }
+        else
+        {
+            // Another consumer claimed the position first
+            position = m_PopPosition.load(std::memory_order_relaxed);
+        }
+    }
+
+    IPacketBufferPtr packetBuffer = std::move(slot->m_PacketBuffer);
+    // Free the slot for the next lap
+    slot->m_Sequence.store(position + m_Capacity, std::memory_order_release);
+    return packetBuffer;
+}
+
+void PacketBufferQueue::Clear()
+{
+    while (TryPop() != nullptr)
+    {
+    }
+}
+
+} // namespace pipe
+
+} // namespace arm
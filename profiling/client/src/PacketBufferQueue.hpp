@@ -0,0 +1,57 @@
+//
+// Copyright © 2024 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include "IPacketBuffer.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+namespace arm
+{
+
+namespace pipe
+{
+
+/// A bounded lock-free queue of packet buffers, which any number of threads can push to and pop from at once.
+/// It is a ring of slots, each with a sequence number telling whether the slot is ready to be pushed to or popped
+/// from for the current lap of the ring, so a thread only ever contends with others on the position it claims.
+class PacketBufferQueue
+{
+public:
+    explicit PacketBufferQueue(size_t capacity);
+
+    PacketBufferQueue(const PacketBufferQueue&) = delete;
+    PacketBufferQueue& operator=(const PacketBufferQueue&) = delete;
+
+    /// Moves the buffer into the queue. Returns false, leaving the buffer as it is, if the queue is full.
+    bool TryPush(IPacketBufferPtr& packetBuffer);
+
+    /// Returns nullptr if the queue is empty.
+    IPacketBufferPtr TryPop();
+
+    /// Drops all the buffers in the queue. Must not be called while other threads are using the queue.
+    void Clear();
+
+private:
+    struct Slot
+    {
+        std::atomic<size_t> m_Sequence;
+        IPacketBufferPtr m_PacketBuffer;
+    };
+
+    const size_t m_Capacity;
+    std::unique_ptr<Slot[]> m_Slots;
+
+    // Kept on separate cache lines, as producers only move one and consumers the other.
+    alignas(64) std::atomic<size_t> m_PushPosition;
+    alignas(64) std::atomic<size_t> m_PopPosition;
+};
+
+} // namespace pipe
+
+} // namespace arm
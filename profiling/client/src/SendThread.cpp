@@ -1,5 +1,5 @@
 //
-// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// Copyright © 2020, 2024 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 
@@ -31,6 +31,7 @@ SendThread::SendThread(ProfilingStateMachine& profilingStateMachine,
     , m_Timeout(timeout)
     , m_IsRunning(false)
     , m_KeepRunning(false)
+    , m_ReadyToRead(false)
     , m_SendThreadException(nullptr)
 {
     m_BufferManager.SetConsumer(this);
@@ -38,6 +39,15 @@ SendThread::SendThread(ProfilingStateMachine& profilingStateMachine,
 
 void SendThread::SetReadyToRead()
 {
+    // Commits made while the send thread has yet to wake up are all picked up by the same flush, so only the first
+    // of them needs to take the mutex and signal. The fence pairs with the one in FlushBuffer: either the send thread
+    // has reset the flag before this load, and is signalled again, or its flush sees the packet committed before it.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (m_ReadyToRead.load(std::memory_order_relaxed))
+    {
+        return;
+    }
+
     // We need to wait for the send thread to release its mutex
     {
 #if !defined(ARMNN_DISABLE_THREADS)
@@ -168,7 +178,7 @@ void SendThread::Send(IProfilingConnection& profilingConnection)
 
                 bool timeout = m_WaitCondition.wait_for(lock,
                                                         std::chrono::milliseconds(std::max(m_Timeout, 1000)),
-                                                        [&]{ return m_ReadyToRead; });
+                                                        [&]{ return m_ReadyToRead.load(); });
                 // If we get notified we need to flush the buffer again
                 if (timeout)
                 {
@@ -194,7 +204,7 @@ void SendThread::Send(IProfilingConnection& profilingConnection)
                 {
                     // Wait indefinitely until notified that something to read has become available in the buffer
 #if !defined(ARMNN_DISABLE_THREADS)
-                    m_WaitCondition.wait(lock, [&] { return m_ReadyToRead; });
+                    m_WaitCondition.wait(lock, [&] { return m_ReadyToRead.load(); });
 #endif
                 }
                 else
@@ -202,7 +212,9 @@ void SendThread::Send(IProfilingConnection& profilingConnection)
                     // Wait until the thread is notified of something to read from the buffer,
                     // or check anyway after the specified number of milliseconds
 #if !defined(ARMNN_DISABLE_THREADS)
-                    m_WaitCondition.wait_for(lock, std::chrono::milliseconds(m_Timeout), [&] { return m_ReadyToRead; });
+                    m_WaitCondition.wait_for(lock,
+                                             std::chrono::milliseconds(m_Timeout),
+                                             [&] { return m_ReadyToRead.load(); });
 #endif
                 }
 
@@ -227,6 +239,9 @@ void SendThread::Send(IProfilingConnection& profilingConnection)
 
 void SendThread::FlushBuffer(IProfilingConnection& profilingConnection, bool notifyWatchers)
 {
+    // Orders the reset of m_ReadyToRead before reading the buffers, see SetReadyToRead
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
     // Get the first available readable buffer
     IPacketBufferPtr packetBuffer = m_BufferManager.GetReadableBuffer();
 
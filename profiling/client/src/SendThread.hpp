@@ -1,5 +1,5 @@
 //
-// Copyright © 2020 Arm Ltd. All rights reserved.
+// Copyright © 2020, 2024 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 
@@ -66,8 +66,9 @@ private:
 #endif
     std::atomic<bool> m_IsRunning;
     std::atomic<bool> m_KeepRunning;
-    // m_ReadyToRead will be protected by m_WaitMutex
-    bool m_ReadyToRead;
+    // m_ReadyToRead is set under m_WaitMutex, but read without it to skip signalling the send thread again
+    // while it has yet to wake up
+    std::atomic<bool> m_ReadyToRead;
     // m_PacketSent will be protected by m_PacketSentWaitMutex
     bool m_PacketSent;
     std::exception_ptr m_SendThreadException;
@@ -62,6 +62,8 @@ from ._generated.pyarmnn import TensorInfo, TensorShape
 
 # Runtime
 from ._generated.pyarmnn import IRuntime, CreationOptions, INetworkProperties
+from ._generated.pyarmnn import IWorkingMemHandle, Threadpool
+from ._generated.pyarmnn import QosExecPriority_Low, QosExecPriority_Medium, QosExecPriority_High
 
 # Profiler
 from ._generated.pyarmnn import IProfiler
@@ -120,6 +122,7 @@ from ._tensor.workload_tensors import make_input_tensors, make_output_tensors, w
 
 # Utilities
 from ._utilities.profiling_helper import ProfilerData, get_profiling_data
+from ._utilities.async_execution import schedule_execution
 
 from ._version import __version__, __arm_ml_version__
 
@@ -165,7 +165,9 @@ class ConstTensor(AnnConstTensor):
 
         self.__check_size(data, num_bytes, num_elements)
 
-        self.__memory_area = data
+        # The tensor refers to the data in place. Arm NN needs it contiguous, which only costs a copy when it isn't.
+        # A read-only view is kept so the caller can still refill their own array between inferences.
+        self.__memory_area = np.ascontiguousarray(data).view()
         self.__memory_area.flags.writeable = False
 
     def get_memory_area(self) -> np.ndarray:
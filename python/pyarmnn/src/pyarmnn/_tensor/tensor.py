@@ -40,22 +40,37 @@ class Tensor(annTensor):
             Create tensor given tensor information
             >>> ann.Tensor(ann.TensorInfo(...))
 
+            Create tensor writing into an existing numpy array, without copying
+            >>> output_data = np.empty(...)
+            >>> ann.Tensor(ann.TensorInfo(...), output_data)
+
             Create tensor from another tensor i.e. copy a tensor
             >>> ann.Tensor(ann.Tensor())
 
         Args:
             tensor(Tensor, optional): Create Tensor from a Tensor i.e. copy.
             tensor_info (TensorInfo, optional): Tensor information.
+            output_data (ndarray, optional): Writable, C-contiguous array used as the tensor memory area, so results
+                                             are written to it directly. Its data type must correspond to the data
+                                             type returned by `TensorInfo.GetDataType`.
 
         Raises:
             TypeError: unsupported input data type.
-            ValueError: appropriate constructor could not be found with provided arguments.
+            ValueError: appropriate constructor could not be found with provided arguments, or output data which
+                        doesn't match the tensor information.
 
         """
         self.__memory_area = None
 
+        # TensorInfo and numpy array, the array is used as the memory area
+        if len(args) > 1 and isinstance(args[0], TensorInfo):
+            if not isinstance(args[1], np.ndarray):
+                raise TypeError('Data must be provided as a numpy array.')
+            self.__use_memory_area(args[0].GetDataType(), args[0].GetNumElements(), args[1])
+            super().__init__(args[0], self.__memory_area.data)
+
         # TensorInfo as first argument, we need to create memory area manually
-        if len(args) > 0 and isinstance(args[0], TensorInfo):
+        elif len(args) > 0 and isinstance(args[0], TensorInfo):
             self.__create_memory_area(args[0].GetDataType(), args[0].GetNumElements())
             super().__init__(args[0], self.__memory_area.data)
 
@@ -94,13 +109,15 @@ class Tensor(annTensor):
         """
         return Tensor(self)
 
-    def __create_memory_area(self, data_type: int, num_elements: int):
-        """ Create the memory area used by the tensor to output its results.
+    @staticmethod
+    def __get_numpy_data_type(data_type: int):
+        """ Get the numpy data type holding the elements of a tensor.
 
         Args:
-            data_type (int): The type of data that will be stored in the memory area.
-                             See DataType_*.
-            num_elements (int): Determines the size of the memory area that will be created.
+            data_type (int): The tensor data type. See DataType_*.
+
+        Raises:
+            ValueError: unsupported tensor data type.
 
         """
         np_data_type_mapping = {DataType_QAsymmU8: np.uint8,
@@ -114,7 +131,39 @@ class Tensor(annTensor):
         if data_type not in np_data_type_mapping:
             raise ValueError("The data type provided for this Tensor is not supported.")
 
-        self.__memory_area = np.empty(shape=(num_elements,), dtype=np_data_type_mapping[data_type])
+        return np_data_type_mapping[data_type]
+
+    def __create_memory_area(self, data_type: int, num_elements: int):
+        """ Create the memory area used by the tensor to output its results.
+
+        Args:
+            data_type (int): The type of data that will be stored in the memory area.
+                             See DataType_*.
+            num_elements (int): Determines the size of the memory area that will be created.
+
+        """
+        self.__memory_area = np.empty(shape=(num_elements,), dtype=self.__get_numpy_data_type(data_type))
+
+    def __use_memory_area(self, data_type: int, num_elements: int, data: np.ndarray):
+        """ Use an existing array as the memory area the tensor outputs its results to.
+
+        Args:
+            data_type (int): The type of data that will be stored in the memory area.
+                             See DataType_*.
+            num_elements (int): Number of elements the memory area must hold.
+            data (ndarray): The array to write the results to.
+
+        """
+        np_data_type = self.__get_numpy_data_type(data_type)
+        if data.dtype != np_data_type:
+            raise TypeError("Expected data to have type {} for type {} but instead got numpy.{}".format(
+                np_data_type, data_type, data.dtype))
+        if data.size != num_elements:
+            raise ValueError("Tensor requires {} elements, {} provided.".format(num_elements, data.size))
+        if not data.flags.c_contiguous or not data.flags.writeable:
+            raise ValueError("Tensor data must be a writable, C-contiguous array.")
+
+        self.__memory_area = data.reshape(-1)
 
     def get_memory_area(self) -> np.ndarray:
         """ Get values that are stored by the tensor.
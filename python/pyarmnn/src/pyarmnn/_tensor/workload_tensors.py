@@ -4,7 +4,7 @@
 This file contains functions relating to WorkloadTensors.
 WorkloadTensors are the inputTensors and outputTensors that are consumed by IRuntime.EnqueueWorkload.
 """
-from typing import Union, List, Tuple
+from typing import Union, List, Optional, Tuple
 import logging
 
 import numpy as np
@@ -60,7 +60,8 @@ def make_input_tensors(inputs_binding_info: List[Tuple],
     return input_tensors
 
 
-def make_output_tensors(outputs_binding_info: List[Tuple]) -> List[Tuple[int, Tensor]]:
+def make_output_tensors(outputs_binding_info: List[Tuple],
+                        output_data: Optional[List[np.ndarray]] = None) -> List[Tuple[int, Tensor]]:
     """Returns `outputTensors` to be used with `IRuntime.EnqueueWorkload`.
 
     This is the primary function to call when you want to produce `outputTensors` for `IRuntime.EnqueueWorkload`.
@@ -77,19 +78,34 @@ def make_output_tensors(outputs_binding_info: List[Tuple]) -> List[Tuple[int, Te
         >>>
         >>> output_tensors = ann.make_output_tensors([output_binding_info])
 
+        Writing results into preallocated arrays, which can be reused across inferences without copying.
+        >>> output_data = [np.empty(...)]
+        >>> output_tensors = ann.make_output_tensors([output_binding_info], output_data)
+
     Args:
         outputs_binding_info (list of tuples): (int, `TensorInfo`) Binding information for output tensors obtained from
                                                `GetNetworkOutputBindingInfo`.
+        output_data (list ndarrays, optional): Writable, C-contiguous arrays the results are written to. By default
+                                               new arrays are allocated.
 
     Returns:
         list: `outputTensors` - A list of tuples (`int`, `Tensor`).
+
+    Raises:
+        ValueError: If length of `outputs_binding_info` and `output_data` are not the same.
     """
+    if output_data is not None and len(outputs_binding_info) != len(output_data):
+        raise ValueError("Length of 'outputs_binding_info' does not match length of 'output_data'")
+
     output_tensors = []
 
-    for out_bind_info in outputs_binding_info:
+    for index, out_bind_info in enumerate(outputs_binding_info):
         out_tensor_id = out_bind_info[0]
         out_tensor_info = out_bind_info[1]
-        output_tensors.append((out_tensor_id, Tensor(out_tensor_info)))
+        if output_data is None:
+            output_tensors.append((out_tensor_id, Tensor(out_tensor_info)))
+        else:
+            output_tensors.append((out_tensor_id, Tensor(out_tensor_info, output_data[index])))
 
     return output_tensors
 
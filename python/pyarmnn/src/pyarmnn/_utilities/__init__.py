@@ -2,3 +2,4 @@
 # SPDX-License-Identifier: MIT
 
 from .profiling_helper import ProfilerData, get_profiling_data
+from .async_execution import schedule_execution
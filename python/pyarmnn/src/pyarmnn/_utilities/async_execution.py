@@ -0,0 +1,62 @@
+# Copyright © 2024 Arm Ltd and Contributors. All rights reserved.
+# SPDX-License-Identifier: MIT
+"""
+This file contains functions relating to asynchronous execution of networks on a `Threadpool`.
+"""
+from concurrent.futures import Future
+from typing import List, Tuple
+
+from .._generated.pyarmnn import Threadpool, QosExecPriority_Medium
+from .._tensor.const_tensor import ConstTensor
+from .._tensor.tensor import Tensor
+from .._tensor.workload_tensors import workload_tensors_to_ndarray
+
+
+def schedule_execution(threadpool: Threadpool, network_id: int,
+                       input_tensors: List[Tuple[int, ConstTensor]],
+                       output_tensors: List[Tuple[int, Tensor]],
+                       priority: int = QosExecPriority_Medium) -> Future:
+    """Queues an execution of a network on a `Threadpool` and returns a future for its results.
+
+    The tensors are used in place, without copying. They are kept alive until the execution has finished, but their
+    memory areas must not be modified until then.
+
+    Examples:
+        Running two inferences concurrently.
+        >>> import pyarmnn as ann
+        >>>
+        >>> ...
+        >>> properties = ann.INetworkProperties(True, ann.MemorySource_Undefined, ann.MemorySource_Undefined)
+        >>> net_id, _ = runtime.LoadNetwork(opt_network, properties)
+        >>> threadpool = ann.Threadpool(2, runtime, [net_id])
+        >>>
+        >>> futures = [ann.schedule_execution(threadpool, net_id, input_tensors, ann.make_output_tensors(...))
+        ...            for input_tensors in batches]
+        >>> results = [future.result() for future in futures]
+
+    Args:
+        threadpool (Threadpool): The thread pool the network was given to.
+        network_id (int): Unique ID of the network to run.
+        input_tensors (list): A list of tuples (int, `ConstTensor`), see `make_input_tensors`.
+        output_tensors (list): A list of tuples (int, `Tensor`), see `make_output_tensors`.
+        priority (int): Priority of the execution, one of QosExecPriority_*. Default: QosExecPriority_Medium.
+
+    Returns:
+        Future: Resolves to the list of output `ndarrays`, see `workload_tensors_to_ndarray`, or raises RuntimeError
+                if the execution failed.
+    """
+    future = Future()
+    future.set_running_or_notify_cancel()
+
+    # Referenced by the callback, which the thread pool holds until the execution has finished, so the tensors and
+    # their memory areas stay alive while Arm NN uses them.
+    tensors = (input_tensors, output_tensors)
+
+    def on_finished(succeeded: bool, _: float):
+        if succeeded:
+            future.set_result(workload_tensors_to_ndarray(tensors[1]))
+        else:
+            future.set_exception(RuntimeError("Failed to execute network {}.".format(network_id)))
+
+    threadpool.Schedule(network_id, input_tensors, output_tensors, on_finished, priority)
+    return future
@@ -1,13 +1,70 @@
 //
-// Copyright © 2020 Arm Ltd. All rights reserved.
+// Copyright © 2020, 2024 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 %{
 #include "armnn/IRuntime.hpp"
+#include "armnn/IAsyncExecutionCallback.hpp"
+#include "armnn/IWorkingMemHandle.hpp"
+#include "armnn/Threadpool.hpp"
 #include "armnn/Deprecated.hpp"
+#include <chrono>
 #include <iostream>
+#include <memory>
 #include <ostream>
 #include <sstream>
+
+/// Releases the GIL while in scope, so other Python threads can run while a long ArmNN call is in progress.
+/// Nothing may touch Python objects while the GIL is released.
+class ScopedGilRelease
+{
+public:
+    ScopedGilRelease() : m_State(PyEval_SaveThread()) {}
+    ~ScopedGilRelease() { PyEval_RestoreThread(m_State); }
+
+    ScopedGilRelease(const ScopedGilRelease&) = delete;
+    ScopedGilRelease& operator=(const ScopedGilRelease&) = delete;
+
+private:
+    PyThreadState* m_State;
+};
+
+/// Forwards the completion of an asynchronous execution to a Python callable, which is called from a Threadpool
+/// thread with whether the execution succeeded and how long it took in seconds.
+class PyExecutionCallback : public armnn::experimental::IAsyncExecutionCallback
+{
+public:
+    explicit PyExecutionCallback(PyObject* callable) : m_Callable(callable)
+    {
+        Py_INCREF(m_Callable);
+    }
+
+    ~PyExecutionCallback()
+    {
+        PyGILState_STATE state = PyGILState_Ensure();
+        Py_DECREF(m_Callable);
+        PyGILState_Release(state);
+    }
+
+    void Notify(armnn::Status status, armnn::InferenceTimingPair timeTaken) override
+    {
+        const double seconds = std::chrono::duration<double>(timeTaken.second - timeTaken.first).count();
+
+        PyGILState_STATE state = PyGILState_Ensure();
+        PyObject* result = PyObject_CallFunction(m_Callable, "Od",
+                                                 status == armnn::Status::Success ? Py_True : Py_False, seconds);
+        if (result == nullptr)
+        {
+            // There is no caller to raise to on this thread.
+            PyErr_WriteUnraisable(m_Callable);
+        }
+        Py_XDECREF(result);
+        PyGILState_Release(state);
+    }
+
+private:
+    PyObject* m_Callable;
+};
 %}
 
 namespace std {
@@ -226,10 +283,13 @@ public:
         std::string errorString;
         armnn::Status status;
 
-        if (networkProperties) {
-            status = $self->LoadNetwork(networkIdOut, std::move(netPtr), errorString, *networkProperties);
-        } else {
-            status = $self->LoadNetwork(networkIdOut, std::move(netPtr), errorString);
+        {
+            ScopedGilRelease release;
+            if (networkProperties) {
+                status = $self->LoadNetwork(networkIdOut, std::move(netPtr), errorString, *networkProperties);
+            } else {
+                status = $self->LoadNetwork(networkIdOut, std::move(netPtr), errorString);
+            }
         }
 
         if(status == armnn::Status::Failure)
@@ -246,6 +306,9 @@ public:
     "
     Calling this function will perform an inference on your network.
 
+    The GIL is released during the inference, so other Python threads keep running. The tensors are read and
+    written in place, so their memory areas must not be modified until the call returns.
+
     Args:
         networkId (int): Unique ID of the network to run.
         inputTensors (list): A list of tuples (int, `ConstTensor`), see `make_input_tensors`.
@@ -254,7 +317,11 @@ public:
     ") EnqueueWorkload;
     void EnqueueWorkload(int networkId, const std::vector<std::pair<int, armnn::ConstTensor>>& inputTensors,
                          const std::vector<std::pair<int, armnn::Tensor>>& outputTensors) {
-        armnn::Status status = $self->EnqueueWorkload(networkId, inputTensors, outputTensors);
+        armnn::Status status;
+        {
+            ScopedGilRelease release;
+            status = $self->EnqueueWorkload(networkId, inputTensors, outputTensors);
+        }
 
         if(status == armnn::Status::Failure)
         {
@@ -302,6 +369,52 @@ public:
         return profiler.get();
     };
 
+    %feature("docstring",
+    "
+    Creates the working memory needed to execute a network loaded with asynchronous execution enabled, see
+    `INetworkProperties`. Each concurrent execution of the network needs its own working memory handle.
+
+    Args:
+        networkId (int): Unique ID of the network the working memory is for.
+
+    Returns:
+        IWorkingMemHandle: The working memory handle.
+    ") CreateWorkingMemHandle;
+    %newobject CreateWorkingMemHandle;
+    armnn::experimental::IWorkingMemHandle* CreateWorkingMemHandle(int networkId) {
+        return $self->CreateWorkingMemHandle(networkId).release();
+    };
+
+    %feature("docstring",
+    "
+    Performs an inference on a network loaded with asynchronous execution enabled, using the given working memory.
+    Several threads can call this at the same time for the same network, each with its own working memory handle.
+
+    The GIL is released during the inference, so other Python threads keep running.
+
+    Args:
+        workingMemHandle (IWorkingMemHandle): Working memory created for the network, see `CreateWorkingMemHandle`.
+        inputTensors (list): A list of tuples (int, `ConstTensor`), see `make_input_tensors`.
+        outputTensors (list): A list of tuples (int, `Tensor`), see `make_output_tensors`.
+
+    Raises:
+        RuntimeError: If the inference fails.
+    ") Execute;
+    void Execute(armnn::experimental::IWorkingMemHandle& workingMemHandle,
+                 const std::vector<std::pair<int, armnn::ConstTensor>>& inputTensors,
+                 const std::vector<std::pair<int, armnn::Tensor>>& outputTensors) {
+        armnn::Status status;
+        {
+            ScopedGilRelease release;
+            status = $self->Execute(workingMemHandle, inputTensors, outputTensors);
+        }
+
+        if(status == armnn::Status::Failure)
+        {
+            throw armnn::Exception("Failed to execute network.");
+        }
+    };
+
     ~IRuntime() {
         armnn::IRuntime::Destroy($self);
     }
@@ -312,5 +425,137 @@ public:
 
 }
 
+namespace experimental
+{
+
+%feature("docstring",
+"
+Working memory for one execution of a network loaded with asynchronous execution enabled.
+
+Created by `IRuntime.CreateWorkingMemHandle`. The handle must not outlive the runtime it was created from.
+
+") IWorkingMemHandle;
+%nodefaultctor IWorkingMemHandle;
+class IWorkingMemHandle
+{
+public:
+    %feature("docstring",
+    "
+    Returns:
+        int: The ID of the network the working memory is for.
+    ") GetNetworkId;
+    int GetNetworkId();
+};
+
+%extend IWorkingMemHandle {
+    ~IWorkingMemHandle() {
+        delete $self;
+    }
+}
+
+%feature("docstring",
+"
+A pool of threads executing networks loaded with asynchronous execution enabled.
+
+Executions are queued by `Schedule` and run by the pool threads, in order of priority. The callback given to
+`Schedule` is called from a pool thread once the execution has finished. See `schedule_execution` for a wrapper
+returning a `concurrent.futures.Future`.
+
+The thread pool must be deleted before the runtime it uses.
+
+Args:
+    numThreads (int): Number of threads in the pool.
+    runtime (IRuntime): The runtime the networks are loaded in.
+    networkIds (list): IDs of the networks to be executed by the pool, at least one. A working memory handle is
+                       created for each thread and network.
+
+Raises:
+    RuntimeError: If no network is given.
+
+") Threadpool;
+%nodefaultctor Threadpool;
+class Threadpool
+{
+public:
+    %feature("docstring",
+    "
+    Deletes the working memory handles of a network, so it can no longer be scheduled on this pool.
+
+    Args:
+        networkId (int): Unique ID of the network.
+    ") UnloadMemHandles;
+    void UnloadMemHandles(int networkId);
+};
+
+%extend Threadpool {
+    Threadpool(size_t numThreads, armnn::IRuntime* runtime, const std::vector<int>& networkIds) {
+        if (networkIds.empty())
+        {
+            throw armnn::InvalidArgumentException("The thread pool needs at least one network.");
+        }
+
+        // The handles given at once must all belong to the same network, so the other networks are loaded in turn.
+        auto createMemHandles = [&](int networkId)
+        {
+            std::vector<std::shared_ptr<armnn::experimental::IWorkingMemHandle>> memHandles;
+            for (size_t thread = 0; thread < numThreads; ++thread)
+            {
+                memHandles.emplace_back(runtime->CreateWorkingMemHandle(networkId));
+            }
+            return memHandles;
+        };
+
+        auto threadpool = std::make_unique<armnn::experimental::Threadpool>(numThreads, runtime,
+                                                                             createMemHandles(networkIds[0]));
+        for (size_t i = 1; i < networkIds.size(); ++i)
+        {
+            threadpool->LoadMemHandles(createMemHandles(networkIds[i]));
+        }
+        return threadpool.release();
+    }
+
+    %feature("docstring",
+    "
+    Queues an execution of a network. The GIL is not held while the network executes.
+
+    The tensors are read and written in place, so they must be kept alive and their memory areas left untouched
+    until the callback has been called.
+
+    Args:
+        networkId (int): Unique ID of the network to run.
+        inputTensors (list): A list of tuples (int, `ConstTensor`), see `make_input_tensors`.
+        outputTensors (list): A list of tuples (int, `Tensor`), see `make_output_tensors`.
+        callback (callable): Called as callback(succeeded, seconds) once the execution has finished.
+        priority (int): Priority of the execution, one of QosExecPriority_*. Default: QosExecPriority_Medium.
+
+    Raises:
+        RuntimeError: If the callback isn't callable.
+    ") Schedule;
+    void Schedule(int networkId,
+                  const std::vector<std::pair<int, armnn::ConstTensor>>& inputTensors,
+                  const std::vector<std::pair<int, armnn::Tensor>>& outputTensors,
+                  PyObject* callback,
+                  armnn::QosExecPriority priority = armnn::QosExecPriority::Medium) {
+        if (!PyCallable_Check(callback))
+        {
+            throw armnn::InvalidArgumentException("The execution callback must be callable.");
+        }
+
+        // Destroyed after the GIL is taken back, the execution holds its own reference.
+        auto cb = std::make_shared<PyExecutionCallback>(callback);
+        {
+            ScopedGilRelease release;
+            $self->Schedule(networkId, inputTensors, outputTensors, priority, cb);
+        }
+    }
+
+    ~Threadpool() {
+        // Pending callbacks take the GIL, so it is released while the threads are joined.
+        ScopedGilRelease release;
+        delete $self;
+    }
+}
+
 }
 
+}
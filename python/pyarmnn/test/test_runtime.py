@@ -1,6 +1,7 @@
-# Copyright © 2020 Arm Ltd. All rights reserved.
+# Copyright © 2020, 2024 Arm Ltd and Contributors. All rights reserved.
 # SPDX-License-Identifier: MIT
 import os
+import threading
 
 import pytest
 import warnings
@@ -232,6 +233,129 @@ def test_enqueue_workload_fails_with_empty_input_tensors(random_runtime):
     assert expected_error_message in str(err.value)
 
 
+def test_enqueue_workload_releases_gil(mock_model_runtime):
+    runtime = mock_model_runtime[0]
+    net_id = mock_model_runtime[1]
+    input_tensors = mock_model_runtime[2]
+    output_tensors = mock_model_runtime[3]
+
+    errors = []
+
+    def run():
+        try:
+            for _ in range(5):
+                runtime.EnqueueWorkload(net_id, input_tensors, output_tensors)
+        except Exception as e:
+            errors.append(e)
+
+    threads = [threading.Thread(target=run) for _ in range(2)]
+    for thread in threads:
+        thread.start()
+    for thread in threads:
+        thread.join()
+
+    assert not errors
+
+
+def test_execute_with_working_mem_handle(shared_data_folder):
+    parser = ann.ITfLiteParser()
+    network = parser.CreateNetworkFromBinaryFile(os.path.join(shared_data_folder, 'mock_model.tflite'))
+    input_binding_info = parser.GetNetworkInputBindingInfo(0, "input_1")
+    input_tensor_data = np.load(os.path.join(shared_data_folder, 'tflite_parser/input_lite.npy'))
+    outputs_binding_info = [parser.GetNetworkOutputBindingInfo(0, name)
+                            for name in parser.GetSubgraphOutputTensorNames(0)]
+
+    runtime = ann.IRuntime(ann.CreationOptions())
+    opt_network, _ = ann.Optimize(network, [ann.BackendId('CpuRef')], runtime.GetDeviceSpec(),
+                                  ann.OptimizerOptions())
+    properties = ann.INetworkProperties(True, ann.MemorySource_Undefined, ann.MemorySource_Undefined)
+    net_id, _ = runtime.LoadNetwork(opt_network, properties)
+
+    input_tensors = ann.make_input_tensors([input_binding_info], [input_tensor_data])
+
+    handle = runtime.CreateWorkingMemHandle(net_id)
+    assert handle.GetNetworkId() == net_id
+    output_tensors = ann.make_output_tensors(outputs_binding_info)
+    runtime.Execute(handle, input_tensors, output_tensors)
+    expected = ann.workload_tensors_to_ndarray(output_tensors)
+
+    threadpool = ann.Threadpool(2, runtime, [net_id])
+    futures = [ann.schedule_execution(threadpool, net_id, input_tensors, ann.make_output_tensors(outputs_binding_info),
+                                      priority)
+               for priority in [ann.QosExecPriority_Low, ann.QosExecPriority_Medium, ann.QosExecPriority_High]]
+
+    for future in futures:
+        results = future.result(timeout=60)
+        for result, expected_result in zip(results, expected):
+            np.testing.assert_array_equal(result, expected_result)
+
+    del threadpool
+    del handle
+
+
+def test_threadpool_schedule_rejects_non_callable(shared_data_folder):
+    parser = ann.ITfLiteParser()
+    network = parser.CreateNetworkFromBinaryFile(os.path.join(shared_data_folder, 'mock_model.tflite'))
+
+    runtime = ann.IRuntime(ann.CreationOptions())
+    opt_network, _ = ann.Optimize(network, [ann.BackendId('CpuRef')], runtime.GetDeviceSpec(),
+                                  ann.OptimizerOptions())
+    properties = ann.INetworkProperties(True, ann.MemorySource_Undefined, ann.MemorySource_Undefined)
+    net_id, _ = runtime.LoadNetwork(opt_network, properties)
+
+    threadpool = ann.Threadpool(1, runtime, [net_id])
+    with pytest.raises(RuntimeError) as err:
+        threadpool.Schedule(net_id, [], [], None)
+
+    assert "The execution callback must be callable." in str(err.value)
+    del threadpool
+
+
+def test_threadpool_with_several_networks(shared_data_folder):
+    parser = ann.ITfLiteParser()
+    network = parser.CreateNetworkFromBinaryFile(os.path.join(shared_data_folder, 'mock_model.tflite'))
+    input_binding_info = parser.GetNetworkInputBindingInfo(0, "input_1")
+    input_tensor_data = np.load(os.path.join(shared_data_folder, 'tflite_parser/input_lite.npy'))
+    outputs_binding_info = [parser.GetNetworkOutputBindingInfo(0, name)
+                            for name in parser.GetSubgraphOutputTensorNames(0)]
+    input_tensors = ann.make_input_tensors([input_binding_info], [input_tensor_data])
+
+    runtime = ann.IRuntime(ann.CreationOptions())
+    properties = ann.INetworkProperties(True, ann.MemorySource_Undefined, ann.MemorySource_Undefined)
+    net_ids = []
+    for _ in range(2):
+        opt_network, _ = ann.Optimize(network, [ann.BackendId('CpuRef')], runtime.GetDeviceSpec(),
+                                      ann.OptimizerOptions())
+        net_id, _ = runtime.LoadNetwork(opt_network, properties)
+        net_ids.append(net_id)
+
+    handle = runtime.CreateWorkingMemHandle(net_ids[0])
+    output_tensors = ann.make_output_tensors(outputs_binding_info)
+    runtime.Execute(handle, input_tensors, output_tensors)
+    expected = ann.workload_tensors_to_ndarray(output_tensors)
+
+    threadpool = ann.Threadpool(2, runtime, net_ids)
+    futures = [ann.schedule_execution(threadpool, net_id, input_tensors, ann.make_output_tensors(outputs_binding_info))
+               for net_id in net_ids for _ in range(2)]
+
+    for future in futures:
+        results = future.result(timeout=60)
+        for result, expected_result in zip(results, expected):
+            np.testing.assert_array_equal(result, expected_result)
+
+    del threadpool
+    del handle
+
+
+def test_threadpool_needs_a_network(shared_data_folder):
+    runtime = ann.IRuntime(ann.CreationOptions())
+
+    with pytest.raises(RuntimeError) as err:
+        ann.Threadpool(1, runtime, [])
+
+    assert "The thread pool needs at least one network." in str(err.value)
+
+
 @pytest.mark.x86_64
 @pytest.mark.parametrize('count', [5])
 def test_multiple_inference_runs_yield_same_result(count, mock_model_runtime):
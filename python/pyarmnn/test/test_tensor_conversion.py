@@ -66,6 +66,26 @@ def test_make_output_tensors(get_tensor_info_output):
         assert str(tensor[1].GetInfo()) == str(tensor_info[1])
 
 
+def test_make_output_tensors_writes_into_provided_arrays(get_tensor_info_output):
+    output_binding_info = get_tensor_info_output
+    output_data = [np.empty(info.GetNumElements(), dtype=np.uint8) for _, info in output_binding_info]
+
+    output_tensors = ann.make_output_tensors(output_binding_info, output_data)
+
+    for (_, tensor), data in zip(output_tensors, output_data):
+        assert tensor.get_memory_area().ctypes.data == data.ctypes.data, "Same memory area"
+
+
+def test_make_output_tensors_rejects_non_contiguous_arrays(get_tensor_info_output):
+    output_binding_info = get_tensor_info_output
+    output_data = [np.empty(info.GetNumElements() * 2, dtype=np.uint8)[::2] for _, info in output_binding_info]
+
+    with pytest.raises(ValueError) as err:
+        ann.make_output_tensors(output_binding_info, output_data)
+
+    assert "Tensor data must be a writable, C-contiguous array." in str(err.value)
+
+
 def test_workload_tensors_to_ndarray(get_tensor_info_output):
     # Check shape and size of output from workload_tensors_to_ndarray matches expected.
     output_binding_info = get_tensor_info_output
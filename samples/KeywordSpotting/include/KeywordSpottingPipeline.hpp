@@ -1,5 +1,5 @@
 //
-// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// Copyright © 2020, 2024 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 
@@ -10,6 +10,8 @@
 #include "MFCC.hpp"
 #include "DsCNNPreprocessor.hpp"
 
+#include <functional>
+
 namespace kws
 {
 /**
@@ -51,6 +53,17 @@ public:
      */
     void Inference(const std::vector<int8_t>& preprocessedData, common::InferenceResults<int8_t>& result);
 
+    /**
+     * @brief Schedules inference and returns without waiting for it to finish.
+     *
+     * @param[in] preprocessedData - input inference data, which must stay valid until done is called.
+     * @param[out] result - raw inference results, which must stay valid until done is called.
+     * @param[in] done - a function to be called, possibly from another thread, once inference has finished.
+     */
+    void InferenceAsync(const std::vector<int8_t>& preprocessedData,
+                        common::InferenceResults<int8_t>& result,
+                        const std::function<void()>& done);
+
     /**
      * @brief Standard inference results post-processing implementation.
      *
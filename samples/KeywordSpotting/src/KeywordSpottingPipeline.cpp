@@ -1,5 +1,5 @@
 //
-// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// Copyright © 2020, 2024 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 
@@ -30,6 +30,14 @@ void KWSPipeline::Inference(const std::vector<int8_t>& preprocessedData,
     m_executor->Run(preprocessedData.data(), preprocessedData.size(), result);
 }
 
+void KWSPipeline::InferenceAsync(const std::vector<int8_t>& preprocessedData,
+                                 common::InferenceResults<int8_t>& result,
+                                 const std::function<void()>& done)
+{
+    m_executor->RunAsync(preprocessedData.data(), preprocessedData.size(), result,
+                         [done](bool) { done(); });
+}
+
 void KWSPipeline::PostProcessing(common::InferenceResults<int8_t>& inferenceResults,
                     std::map<int, std::string>& labels,
                     const std::function<void (int, std::string&, float)>& callback)
@@ -77,7 +85,7 @@ IPipelinePtr CreatePipeline(common::PipelineOptions& config)
             MFCC_WINDOW_LEN, MFCC_WINDOW_STRIDE, std::move(mfccInst));
 
         auto executor = std::make_unique<common::ArmnnNetworkExecutor<int8_t>>(
-            config.m_ModelFilePath, config.m_backends);
+            config.m_ModelFilePath, config.m_backends, config.m_ProfilingEnabled, config.m_NumInferenceThreads);
 
         auto decoder = std::make_unique<kws::Decoder>(executor->GetOutputQuantizationOffset(0),
                                                       executor->GetOutputQuantizationScale(0));
@@ -1,5 +1,5 @@
 //
-// Copyright © 2021 Arm Ltd and Contributors. All rights reserved.
+// Copyright © 2021, 2024 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 #include <iostream>
@@ -11,11 +11,16 @@
 #include "CmdArgsParser.hpp"
 #include "ArmnnNetworkExecutor.hpp"
 #include "AudioCapture.hpp"
+#include "PipelinedExecutor.hpp"
+
+#include <thread>
 
 const std::string AUDIO_FILE_PATH = "--audio-file-path";
 const std::string MODEL_FILE_PATH = "--model-file-path";
 const std::string LABEL_PATH = "--label-path";
 const std::string PREFERRED_BACKENDS = "--preferred-backends";
+const std::string PIPELINED = "--pipelined";
+const std::string NUM_INFERENCE_THREADS = "--num-inference-threads";
 const std::string HELP = "--help";
 
 /*
@@ -27,7 +32,12 @@ static std::map<std::string, std::string> CMD_OPTIONS =
         {MODEL_FILE_PATH,    "[REQUIRED] Path to the Speech Recognition model to use"},
         {PREFERRED_BACKENDS, "[OPTIONAL] Takes the preferred backends in preference order, separated by comma."
                              " For example: CpuAcc,GpuAcc,CpuRef. Accepted options: [CpuAcc, CpuRef, GpuAcc]."
-                             " Defaults to CpuAcc,CpuRef"}
+                             " Defaults to CpuAcc,CpuRef"},
+        {PIPELINED,          "[OPTIONAL] Enabling this option overlaps the pre-processing, inference and"
+                             " post-processing of consecutive audio windows on separate threads. By default, this"
+                             " option is disabled. Accepted options are true/false."},
+        {NUM_INFERENCE_THREADS, "[OPTIONAL] Number of inferences which can run at once in the pipelined mode."
+                                " Defaults to 1."}
 };
 
 /*
@@ -64,6 +74,68 @@ std::map<int, std::string> labels =
         {11, "go"}
 };
 
+/*
+ * The buffers used to process one audio window in the pipelined mode, reused for later windows
+ */
+struct PipelineFrame
+{
+    std::vector<float> m_AudioBlock;
+    std::vector<int8_t> m_PreprocessedData;
+    common::InferenceResults<int8_t> m_Results;
+};
+
+/*
+ * Processes the audio windows in pipelined mode: a window is pre-processed while the previous ones are being
+ * inferred and post-processed. The windows are independent of each other, and the keywords are printed in the
+ * order of the windows they were spotted in
+ */
+void RunPipelined(kws::KWSPipeline& kwsPipeline, audio::AudioCapture& capture, unsigned int numInferenceThreads)
+{
+    // One frame for each inference which can run at once, plus one for each other stage.
+    std::vector<std::unique_ptr<PipelineFrame>> frames;
+    for (unsigned int i = 0; i < numInferenceThreads + 3; ++i)
+    {
+        frames.emplace_back(std::make_unique<PipelineFrame>());
+    }
+
+    common::PipelinedExecutor<PipelineFrame> executor(
+        std::move(frames),
+        [&kwsPipeline](PipelineFrame& frame)
+        {
+            frame.m_PreprocessedData = kwsPipeline.PreProcessing(frame.m_AudioBlock);
+        },
+        [&kwsPipeline](PipelineFrame& frame, std::function<void()> done)
+        {
+            kwsPipeline.InferenceAsync(frame.m_PreprocessedData, frame.m_Results, done);
+        },
+        [&kwsPipeline](PipelineFrame& frame)
+        {
+            kwsPipeline.PostProcessing(frame.m_Results, labels,
+                                       [](int index, std::string& label, float prob) -> void {
+                                           printf("Keyword \"%s\", index %d:, probability %f\n",
+                                                  label.c_str(),
+                                                  index,
+                                                  prob);
+                                       });
+        });
+
+    std::thread audioReader([&executor, &capture]()
+    {
+        while (capture.HasNext())
+        {
+            std::unique_ptr<PipelineFrame> pipelineFrame = executor.AcquireFrame();
+            pipelineFrame->m_AudioBlock = capture.Next();
+            executor.Submit(std::move(pipelineFrame));
+        }
+        executor.Finish();
+    });
+
+    while (std::unique_ptr<PipelineFrame> pipelineFrame = executor.NextResult())
+    {
+        executor.ReleaseFrame(std::move(pipelineFrame));
+    }
+    audioReader.join();
+}
 
 int main(int argc, char* argv[]) 
 {
@@ -91,6 +163,19 @@ int main(int argc, char* argv[])
         pipelineOptions.m_backends = {"CpuAcc", "CpuRef"};
     }
 
+    const bool pipelined = CheckOptionSpecified(options, PIPELINED) &&
+                           GetSpecifiedOption(options, PIPELINED) == "true";
+    unsigned int numInferenceThreads = 1;
+    if (CheckOptionSpecified(options, NUM_INFERENCE_THREADS))
+    {
+        numInferenceThreads = static_cast<unsigned int>(
+            std::max(1, std::stoi(GetSpecifiedOption(options, NUM_INFERENCE_THREADS))));
+    }
+    if (pipelined)
+    {
+        pipelineOptions.m_NumInferenceThreads = numInferenceThreads;
+    }
+
     kws::IPipelinePtr kwsPipeline = kws::CreatePipeline(pipelineOptions);
 
     //Extract audio data from sound file
@@ -104,6 +189,12 @@ int main(int argc, char* argv[])
                               kwsPipeline->getInputSamplesSize(), 
                               kwsPipeline->getInputSamplesSize()/2);
 
+    if (pipelined)
+    {
+        RunPipelined(*kwsPipeline, capture, numInferenceThreads);
+        return 0;
+    }
+
     //Loop through audio data buffer
     while (capture.HasNext()) 
     {
@@ -48,7 +48,9 @@ ExternalProject_Add(yolo_v3
         INSTALL_COMMAND ""
         )
 
-add_executable("${TEST_TARGET_NAME}" ${SOURCES} ${TEST_SOURCES} ${CVUTILS_SOURCES} ${UTILS_SOURCES})
+file(GLOB TESTS_UTILS_COMMON "../common/test/Utils/*")
+
+add_executable("${TEST_TARGET_NAME}" ${SOURCES} ${TEST_SOURCES} ${TESTS_UTILS_COMMON} ${CVUTILS_SOURCES} ${UTILS_SOURCES})
 
 add_dependencies(
     "${TEST_TARGET_NAME}"
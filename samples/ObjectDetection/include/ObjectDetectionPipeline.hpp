@@ -50,6 +50,17 @@ public:
      */
     virtual void Inference(const cv::Mat& processed, common::InferenceResults<float>& result);
 
+    /**
+     * @brief Schedules inference and returns without waiting for it to finish.
+     *
+     * @param[in] processed - input inference data, which must stay valid until done is called.
+     * @param[out] result - raw floating point inference results, which must stay valid until done is called.
+     * @param[in] done - a function to be called, possibly from another thread, once inference has finished.
+     */
+    virtual void InferenceAsync(const cv::Mat& processed,
+                                common::InferenceResults<float>& result,
+                                const std::function<void()>& done);
+
     /**
      * @brief Standard inference results post-processing implementation.
      *
@@ -61,6 +72,20 @@ public:
     virtual void PostProcessing(common::InferenceResults<float>& inferenceResult,
                                 const std::function<void (DetectedObjects)>& callback);
 
+    /**
+     * @brief Inference results post-processing for a given original image size.
+     *
+     * Unlike the overload above, this does not depend on the last pre-processed frame, so it can run while
+     * the following frames are pre-processed.
+     *
+     * @param[in] inferenceResult - inference results to be decoded.
+     * @param[in] imageSize - size of the original image the results were inferred from.
+     * @param[in] callback - a function to be called after successful inference results decoding.
+     */
+    void PostProcessing(common::InferenceResults<float>& inferenceResult,
+                        const common::Size& imageSize,
+                        const std::function<void (DetectedObjects)>& callback);
+
 protected:
     std::unique_ptr<common::ArmnnNetworkExecutor<float>> m_executor;
     std::unique_ptr<IDetectionResultDecoder> m_decoder;
@@ -21,6 +21,7 @@
 #include <tensorflow/lite/interpreter.h>
 #include <tensorflow/lite/kernels/register.h>
 
+#include <functional>
 #include <string>
 #include <vector>
 
@@ -61,10 +62,12 @@ public:
     *
     *       * @param[in] modelPath - Relative path to the model file
     *       * @param[in] backends - The list of preferred backends to run inference on
+    *       * @param[in] numInferenceThreads - Unused, the interpreter always runs inference in the calling thread
     */
     ArmnnNetworkExecutor(std::string& modelPath,
                          std::vector<armnn::BackendId>& backends,
-                         bool isProfilingEnabled = false);
+                         bool isProfilingEnabled = false,
+                         unsigned int numInferenceThreads = 0);
 
     /**
     * @brief Returns the aspect ratio of the associated model in the order of width, height.
@@ -95,12 +98,26 @@ public:
     */
     bool Run(const void *inputData, const size_t dataBytes,
              InferenceResults<Tout> &outResults);
+
+    /**
+    * @brief Runs inference on the provided input data, then calls the callback with whether it succeeded.
+    * The TfLite interpreter is not thread safe, so this runs in the calling thread.
+    *
+    * @param[in] inputData - input frame data
+    * @param[in] dataBytes - input data size in bytes
+    * @param[out] outResults - Vector of DetectionResult objects used to store the output result.
+    * @param[in] callback - called with whether the inference succeeded
+    */
+    void RunAsync(const void *inputData, const size_t dataBytes,
+                  InferenceResults<Tout> &outResults,
+                  std::function<void(bool)> callback);
 };
 
 template <typename Tout>
 ArmnnNetworkExecutor<Tout>::ArmnnNetworkExecutor(std::string& modelPath,
                                            std::vector<armnn::BackendId>& preferredBackends,
-                                           bool isProfilingEnabled):
+                                           bool isProfilingEnabled,
+                                           unsigned int):
                                            m_profiling(isProfilingEnabled)
 {
     m_profiling.ProfilingStart();
@@ -216,6 +233,14 @@ bool ArmnnNetworkExecutor<Tout>::Run(const void *inputData, const size_t dataByt
     return ret;
 }
 
+template <typename Tout>
+void ArmnnNetworkExecutor<Tout>::RunAsync(const void *inputData, const size_t dataBytes,
+                                          InferenceResults<Tout>& outResults,
+                                          std::function<void(bool)> callback)
+{
+    callback(Run(inputData, dataBytes, outResults));
+}
+
 template <typename Tout>
 Size ArmnnNetworkExecutor<Tout>::GetImageAspectRatio()
 {
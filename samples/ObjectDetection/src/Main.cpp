@@ -8,11 +8,14 @@
 #include "CvVideoFileWriter.hpp"
 #include "ObjectDetectionPipeline.hpp"
 #include "CmdArgsParser.hpp"
+#include "PipelinedExecutor.hpp"
 
+#include <algorithm>
 #include <fstream>
 #include <iostream>
 #include <map>
 #include <random>
+#include <thread>
 
 const std::string MODEL_NAME = "--model-name";
 const std::string VIDEO_FILE_PATH = "--video-file-path";
@@ -21,6 +24,8 @@ const std::string OUTPUT_VIDEO_FILE_PATH = "--output-video-file-path";
 const std::string LABEL_PATH = "--label-path";
 const std::string PREFERRED_BACKENDS = "--preferred-backends";
 const std::string PROFILING_ENABLED = "--profiling_enabled";
+const std::string PIPELINED = "--pipelined";
+const std::string NUM_INFERENCE_THREADS = "--num-inference-threads";
 const std::string HELP = "--help";
 
 /*
@@ -39,7 +44,12 @@ static std::map<std::string, std::string> CMD_OPTIONS = {
                              " Defaults to CpuAcc,CpuRef"},
         {PROFILING_ENABLED, "[OPTIONAL] Enabling this option will print important ML related milestones timing"
                             "information in micro-seconds. By default, this option is disabled."
-                            "Accepted options are true/false."}
+                            "Accepted options are true/false."},
+        {PIPELINED, "[OPTIONAL] Enabling this option overlaps the pre-processing, inference and post-processing "
+                    "of consecutive frames on separate threads. By default, this option is disabled. "
+                    "Accepted options are true/false."},
+        {NUM_INFERENCE_THREADS, "[OPTIONAL] Number of inferences which can run at once in the pipelined mode. "
+                                "Defaults to 1."}
 };
 
 /*
@@ -88,6 +98,74 @@ std::vector<std::tuple<std::string, common::BBoxColor>> AssignColourToLabel(cons
     return labels;
 }
 
+/*
+ * The buffers used to process one frame in the pipelined mode, reused for later frames
+ */
+struct PipelineFrame
+{
+    std::shared_ptr<cv::Mat> m_Frame;
+    cv::Mat m_Processed;
+    common::InferenceResults<float> m_Results;
+};
+
+/*
+ * Processes the frames in pipelined mode: a frame is pre-processed while the previous ones are being inferred
+ * and post-processed. Frames are read on a separate thread, and written out on the calling thread
+ */
+void RunPipelined(od::ObjDetectionPipeline& objectDetectionPipeline,
+                  common::IFrameReader<cv::Mat>& reader,
+                  common::IFrameOutput<cv::Mat>& sink,
+                  std::vector<std::tuple<std::string, common::BBoxColor>>& labels,
+                  unsigned int numInferenceThreads)
+{
+    // One frame for each inference which can run at once, plus one for each other stage.
+    std::vector<std::unique_ptr<PipelineFrame>> frames;
+    for (unsigned int i = 0; i < numInferenceThreads + 3; ++i)
+    {
+        frames.emplace_back(std::make_unique<PipelineFrame>());
+    }
+
+    common::PipelinedExecutor<PipelineFrame> executor(
+        std::move(frames),
+        [&objectDetectionPipeline](PipelineFrame& frame)
+        {
+            objectDetectionPipeline.PreProcessing(*frame.m_Frame, frame.m_Processed);
+        },
+        [&objectDetectionPipeline](PipelineFrame& frame, std::function<void()> done)
+        {
+            objectDetectionPipeline.InferenceAsync(frame.m_Processed, frame.m_Results, done);
+        },
+        [&objectDetectionPipeline, &labels](PipelineFrame& frame)
+        {
+            const common::Size imageSize(frame.m_Frame->cols, frame.m_Frame->rows);
+            objectDetectionPipeline.PostProcessing(frame.m_Results, imageSize,
+                                                   [&frame, &labels](od::DetectedObjects detects) -> void {
+                AddInferenceOutputToFrame(detects, *frame.m_Frame, labels);
+            });
+        });
+
+    std::thread frameReader([&executor, &reader]()
+    {
+        std::shared_ptr<cv::Mat> frame = reader.ReadFrame();
+        while (!reader.IsExhausted(frame))
+        {
+            std::unique_ptr<PipelineFrame> pipelineFrame = executor.AcquireFrame();
+            pipelineFrame->m_Frame = frame;
+            executor.Submit(std::move(pipelineFrame));
+            frame = reader.ReadFrame();
+        }
+        executor.Finish();
+    });
+
+    while (std::unique_ptr<PipelineFrame> pipelineFrame = executor.NextResult())
+    {
+        sink.WriteFrame(pipelineFrame->m_Frame);
+        pipelineFrame->m_Frame.reset();
+        executor.ReleaseFrame(std::move(pipelineFrame));
+    }
+    frameReader.join();
+}
+
 std::tuple<std::unique_ptr<common::IFrameReader<cv::Mat>>,
            std::unique_ptr<common::IFrameOutput<cv::Mat>>>
            GetFrameSourceAndSink(const std::map<std::string, std::string>& options) {
@@ -154,6 +232,19 @@ int main(int argc, char *argv[])
         pipelineOptions.m_backends = {"CpuAcc", "CpuRef"};
     }
 
+    const bool pipelined = CheckOptionSpecified(options, PIPELINED) &&
+                           GetSpecifiedOption(options, PIPELINED) == "true";
+    unsigned int numInferenceThreads = 1;
+    if (CheckOptionSpecified(options, NUM_INFERENCE_THREADS))
+    {
+        numInferenceThreads = static_cast<unsigned int>(
+            std::max(1, std::stoi(GetSpecifiedOption(options, NUM_INFERENCE_THREADS))));
+    }
+    if (pipelined)
+    {
+        pipelineOptions.m_NumInferenceThreads = numInferenceThreads;
+    }
+
     auto labels = AssignColourToLabel(GetSpecifiedOption(options, LABEL_PATH));
 
     common::Profiling profiling(pipelineOptions.m_ProfilingEnabled);
@@ -170,6 +261,14 @@ int main(int argc, char *argv[])
         return 1;
     }
 
+    if (pipelined)
+    {
+        RunPipelined(*objectDetectionPipeline, *reader, *sink, labels, numInferenceThreads);
+        sink->Close();
+        profiling.ProfilingStopAndPrintUs("Overall compute time");
+        return 0;
+    }
+
     common::InferenceResults<float> results;
 
     std::shared_ptr<cv::Mat> frame = reader->ReadFrame();
@@ -19,10 +19,25 @@ void od::ObjDetectionPipeline::Inference(const cv::Mat& processed, common::Infer
     m_executor->Run(processed.data, processed.total() * processed.elemSize(), result);
 }
 
+void ObjDetectionPipeline::InferenceAsync(const cv::Mat& processed,
+                                          common::InferenceResults<float>& result,
+                                          const std::function<void()>& done)
+{
+    m_executor->RunAsync(processed.data, processed.total() * processed.elemSize(), result,
+                         [done](bool) { done(); });
+}
+
 void ObjDetectionPipeline::PostProcessing(common::InferenceResults<float>& inferenceResult,
         const std::function<void (DetectedObjects)>& callback)
 {
-    DetectedObjects detections = m_decoder->Decode(inferenceResult, m_inputImageSize,
+    PostProcessing(inferenceResult, m_inputImageSize, callback);
+}
+
+void ObjDetectionPipeline::PostProcessing(common::InferenceResults<float>& inferenceResult,
+                                          const common::Size& imageSize,
+                                          const std::function<void (DetectedObjects)>& callback)
+{
+    DetectedObjects detections = m_decoder->Decode(inferenceResult, imageSize,
                                            m_executor->GetImageAspectRatio(), {});
     if (callback)
     {
@@ -73,7 +88,8 @@ IPipelinePtr CreatePipeline(common::PipelineOptions& config)
 {
     auto executor = std::make_unique<common::ArmnnNetworkExecutor<float>>(config.m_ModelFilePath,
                                                                           config.m_backends,
-                                                                          config.m_ProfilingEnabled);
+                                                                          config.m_ProfilingEnabled,
+                                                                          config.m_NumInferenceThreads);
     if (config.m_ModelName == "SSD_MOBILE")
     {
         float detectionThreshold = 0.5;
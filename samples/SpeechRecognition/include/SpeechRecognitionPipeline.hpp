@@ -1,5 +1,5 @@
 //
-// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// Copyright © 2020, 2024 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 
@@ -10,6 +10,8 @@
 #include "MFCC.hpp"
 #include "Wav2LetterPreprocessor.hpp"
 
+#include <functional>
+
 namespace asr 
 {
 /**
@@ -62,6 +64,22 @@ public:
         m_executor->Run(preprocessedData.data(), data_bytes, result);
     }
 
+    /**
+     * @brief Schedules inference and returns without waiting for it to finish.
+     *
+     * @param[in] preprocessedData - input inference data, which must stay valid until done is called.
+     * @param[out] result - raw inference results, which must stay valid until done is called.
+     * @param[in] done - a function to be called, possibly from another thread, once inference has finished.
+     */
+    template<typename T>
+    void InferenceAsync(const std::vector<T>& preprocessedData,
+                        common::InferenceResults<int8_t>& result,
+                        const std::function<void()>& done)
+    {
+        size_t data_bytes = sizeof(T) * preprocessedData.size();
+        m_executor->RunAsync(preprocessedData.data(), data_bytes, result, [done](bool) { done(); });
+    }
+
     /**
      * @brief Standard inference results post-processing implementation.
      *
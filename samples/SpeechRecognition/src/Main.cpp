@@ -1,5 +1,5 @@
 //
-// Copyright © 2021 Arm Ltd and Contributors. All rights reserved.
+// Copyright © 2021, 2024 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 #include <iostream>
@@ -13,6 +13,9 @@
 #include "AudioCapture.hpp"
 #include "SpeechRecognitionPipeline.hpp"
 #include "Wav2LetterMFCC.hpp"
+#include "PipelinedExecutor.hpp"
+
+#include <thread>
 
 using InferenceResult = std::vector<int8_t>;
 using InferenceResults = std::vector<InferenceResult>;
@@ -21,6 +24,8 @@ const std::string AUDIO_FILE_PATH = "--audio-file-path";
 const std::string MODEL_FILE_PATH = "--model-file-path";
 const std::string LABEL_PATH = "--label-path";
 const std::string PREFERRED_BACKENDS = "--preferred-backends";
+const std::string PIPELINED = "--pipelined";
+const std::string NUM_INFERENCE_THREADS = "--num-inference-threads";
 const std::string HELP = "--help";
 
 std::map<int, std::string> labels = 
@@ -65,7 +70,12 @@ static std::map<std::string, std::string> CMD_OPTIONS =
     {MODEL_FILE_PATH,    "[REQUIRED] Path to the Speech Recognition model to use"},
     {PREFERRED_BACKENDS, "[OPTIONAL] Takes the preferred backends in preference order, separated by comma."
                          " For example: CpuAcc,GpuAcc,CpuRef. Accepted options: [CpuAcc, CpuRef, GpuAcc]."
-                         " Defaults to CpuAcc,CpuRef"}
+                         " Defaults to CpuAcc,CpuRef"},
+    {PIPELINED,          "[OPTIONAL] Enabling this option overlaps the pre-processing, inference and"
+                         " post-processing of consecutive audio windows on separate threads. By default, this"
+                         " option is disabled. Accepted options are true/false."},
+    {NUM_INFERENCE_THREADS, "[OPTIONAL] Number of inferences which can run at once in the pipelined mode."
+                            " Defaults to 1."}
 };
 
 /*
@@ -84,6 +94,68 @@ std::vector<armnn::BackendId> GetPreferredBackendList(const std::string& preferr
     }
     return backends;
 }
+/*
+ * The buffers used to process one audio window in the pipelined mode, reused for later windows
+ */
+struct PipelineFrame
+{
+    std::vector<float> m_AudioBlock;
+    bool m_IsLastWindow = false;
+    std::vector<int8_t> m_PreprocessedData;
+    InferenceResults m_Results;
+};
+
+/*
+ * Processes the audio windows in pipelined mode: a window is pre-processed while the previous ones are being
+ * inferred and post-processed. Each stage runs on a single thread and the windows go through the stages in order,
+ * so the text of consecutive windows is still stitched together in order by the post-processing
+ */
+void RunPipelined(asr::ASRPipeline& asrPipeline, audio::AudioCapture& capture, unsigned int numInferenceThreads)
+{
+    bool isFirstWindow = true;
+    std::string currentRContext = "";
+
+    // One frame for each inference which can run at once, plus one for each other stage.
+    std::vector<std::unique_ptr<PipelineFrame>> frames;
+    for (unsigned int i = 0; i < numInferenceThreads + 3; ++i)
+    {
+        frames.emplace_back(std::make_unique<PipelineFrame>());
+    }
+
+    common::PipelinedExecutor<PipelineFrame> executor(
+        std::move(frames),
+        [&asrPipeline](PipelineFrame& frame)
+        {
+            frame.m_PreprocessedData = asrPipeline.PreProcessing(frame.m_AudioBlock);
+        },
+        [&asrPipeline](PipelineFrame& frame, std::function<void()> done)
+        {
+            asrPipeline.InferenceAsync<int8_t>(frame.m_PreprocessedData, frame.m_Results, done);
+        },
+        [&asrPipeline, &isFirstWindow, &currentRContext](PipelineFrame& frame)
+        {
+            asrPipeline.PostProcessing<int8_t>(frame.m_Results, isFirstWindow, frame.m_IsLastWindow,
+                                               currentRContext);
+        });
+
+    std::thread audioReader([&executor, &capture]()
+    {
+        while (capture.HasNext())
+        {
+            std::unique_ptr<PipelineFrame> pipelineFrame = executor.AcquireFrame();
+            pipelineFrame->m_AudioBlock = capture.Next();
+            pipelineFrame->m_IsLastWindow = !capture.HasNext();
+            executor.Submit(std::move(pipelineFrame));
+        }
+        executor.Finish();
+    });
+
+    while (std::unique_ptr<PipelineFrame> pipelineFrame = executor.NextResult())
+    {
+        executor.ReleaseFrame(std::move(pipelineFrame));
+    }
+    audioReader.join();
+}
 
 int main(int argc, char* argv[]) 
 {
@@ -111,6 +183,19 @@ int main(int argc, char* argv[])
         pipelineOptions.m_backends = {"CpuAcc", "CpuRef"};
     }
 
+    const bool pipelined = CheckOptionSpecified(options, PIPELINED) &&
+                           GetSpecifiedOption(options, PIPELINED) == "true";
+    unsigned int numInferenceThreads = 1;
+    if (CheckOptionSpecified(options, NUM_INFERENCE_THREADS))
+    {
+        numInferenceThreads = static_cast<unsigned int>(
+            std::max(1, std::stoi(GetSpecifiedOption(options, NUM_INFERENCE_THREADS))));
+    }
+    if (pipelined)
+    {
+        pipelineOptions.m_NumInferenceThreads = numInferenceThreads;
+    }
+
     asr::IPipelinePtr asrPipeline = asr::CreatePipeline(pipelineOptions, labels);
 
     audio::AudioCapture capture;
@@ -118,6 +203,12 @@ int main(int argc, char* argv[])
     capture.InitSlidingWindow(audioData.data(), audioData.size(), asrPipeline->getInputSamplesSize(),
                               asrPipeline->getSlidingWindowOffset());
 
+    if (pipelined)
+    {
+        RunPipelined(*asrPipeline, capture, numInferenceThreads);
+        return 0;
+    }
+
     while (capture.HasNext()) 
     {
         std::vector<float> audioBlock = capture.Next();
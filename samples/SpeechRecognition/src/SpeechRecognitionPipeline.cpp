@@ -1,5 +1,5 @@
 //
-// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// Copyright © 2020, 2024 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 
@@ -68,7 +68,9 @@ IPipelinePtr CreatePipeline(common::PipelineOptions& config, std::map<int, std::
         std::unique_ptr<Wav2LetterMFCC> mfccInst = std::make_unique<Wav2LetterMFCC>(mfccParams);
 
         auto executor = std::make_unique<common::ArmnnNetworkExecutor<int8_t>>(config.m_ModelFilePath,
-                                                                               config.m_backends);
+                                                                               config.m_backends,
+                                                                               config.m_ProfilingEnabled,
+                                                                               config.m_NumInferenceThreads);
 
         auto decoder = std::make_unique<asr::Decoder>(labels);
 
@@ -1,5 +1,5 @@
 //
-// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// Copyright © 2020, 2024 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 
@@ -8,11 +8,15 @@
 #include "Types.hpp"
 
 #include "armnn/ArmNN.hpp"
+#include "armnn/IAsyncExecutionCallback.hpp"
+#include "armnn/Threadpool.hpp"
 #include "armnnTfLiteParser/ITfLiteParser.hpp"
 #include "armnnUtils/DataLayoutIndexed.hpp"
 #include <armnn/Logging.hpp>
 #include "Profiling.hpp"
 
+#include <functional>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -37,6 +41,29 @@ private:
 
     armnnTfLiteParser::BindingPointInfo m_inputBindingInfo;
 
+    std::vector<std::shared_ptr<armnn::experimental::IWorkingMemHandle>> m_WorkingMemHandles;
+    std::unique_ptr<armnn::experimental::Threadpool> m_Threadpool;
+    // Used by Run() when the network is loaded for asynchronous execution. It isn't given to the thread pool, so that
+    // Run() doesn't share working memory with inferences scheduled by RunAsync().
+    std::unique_ptr<armnn::experimental::IWorkingMemHandle> m_RunWorkingMemHandle;
+
+    /**
+    * @brief Calls a function once an execution scheduled on the thread pool has finished.
+    */
+    class ExecutionCallback : public armnn::experimental::IAsyncExecutionCallback
+    {
+    public:
+        explicit ExecutionCallback(std::function<void(bool)> callback) : m_Callback(std::move(callback)) {}
+
+        void Notify(armnn::Status status, armnn::InferenceTimingPair) override
+        {
+            m_Callback(status == armnn::Status::Success);
+        }
+
+    private:
+        std::function<void(bool)> m_Callback;
+    };
+
     void PrepareTensors(const void* inputData, const size_t dataBytes);
 
     template <typename Enumeration>
@@ -58,10 +85,13 @@ public:
     *
     *       * @param[in] modelPath - Relative path to the model file
     *       * @param[in] backends - The list of preferred backends to run inference on
+    *       * @param[in] numInferenceThreads - Number of threads, each with its own working memory, running
+    *                                        RunAsync() inferences. 0 runs RunAsync() in the calling thread.
     */
     ArmnnNetworkExecutor(std::string& modelPath,
                          std::vector<armnn::BackendId>& backends,
-                         bool isProfilingEnabled = false);
+                         bool isProfilingEnabled = false,
+                         unsigned int numInferenceThreads = 0);
 
     /**
     * @brief Returns the aspect ratio of the associated model in the order of width, height.
@@ -87,12 +117,30 @@ public:
     */
     bool Run(const void* inputData, const size_t dataBytes, common::InferenceResults<Tout>& outResults);
 
+    /**
+    * @brief Schedules inference on the provided input data and returns without waiting for it to finish.
+    *
+    * The results are written directly into outResults, which is resized on first use and can be reused between
+    * calls without further allocations. Several inferences can run at once, up to the number of inference threads.
+    *
+    * @param[in] inputData - input frame data, which must stay valid until the callback is called
+    * @param[in] dataBytes - input data size in bytes
+    * @param[out] outResults - Vector of DetectionResult objects used to store the output result. It must stay
+    *                          valid until the callback is called.
+    * @param[in] callback - called, possibly from another thread, with whether the inference succeeded
+    */
+    void RunAsync(const void* inputData,
+                  const size_t dataBytes,
+                  common::InferenceResults<Tout>& outResults,
+                  std::function<void(bool)> callback);
+
 };
 
 template <typename Tout>
 ArmnnNetworkExecutor<Tout>::ArmnnNetworkExecutor(std::string& modelPath,
                                            std::vector<armnn::BackendId>& preferredBackends,
-                                           bool isProfilingEnabled):
+                                           bool isProfilingEnabled,
+                                           unsigned int numInferenceThreads):
         m_profiling(isProfilingEnabled),
         m_Runtime(armnn::IRuntime::Create(armnn::IRuntime::CreationOptions()))
 {
@@ -127,14 +175,30 @@ ArmnnNetworkExecutor<Tout>::ArmnnNetworkExecutor(std::string& modelPath,
         throw armnn::Exception(errorMessage);
     }
 
-    // Load the optimized network onto the m_Runtime device
+    // Load the optimized network onto the m_Runtime device. Inference threads need the network to be loaded
+    // for asynchronous execution, with working memory for each thread.
     std::string errorMessage;
-    if (armnn::Status::Success != m_Runtime->LoadNetwork(m_NetId, std::move(optNet), errorMessage))
+    armnn::INetworkProperties networkProperties(numInferenceThreads > 0,
+                                                armnn::MemorySource::Undefined,
+                                                armnn::MemorySource::Undefined);
+    if (armnn::Status::Success != m_Runtime->LoadNetwork(m_NetId, std::move(optNet), errorMessage, networkProperties))
     {
         ARMNN_LOG(error) << errorMessage;
         throw armnn::Exception(errorMessage);
     }
 
+    if (numInferenceThreads > 0)
+    {
+        for (unsigned int i = 0; i < numInferenceThreads; ++i)
+        {
+            m_WorkingMemHandles.emplace_back(m_Runtime->CreateWorkingMemHandle(m_NetId));
+        }
+        m_Threadpool = std::make_unique<armnn::experimental::Threadpool>(numInferenceThreads,
+                                                                         m_Runtime.get(),
+                                                                         m_WorkingMemHandles);
+        m_RunWorkingMemHandle = m_Runtime->CreateWorkingMemHandle(m_NetId);
+    }
+
     //pre-allocate memory for output (the size of it never changes)
     for (int it = 0; it < m_outputLayerNamesList.size(); ++it)
     {
@@ -182,7 +246,10 @@ bool ArmnnNetworkExecutor<Tout>::Run(const void* inputData, const size_t dataByt
     this->PrepareTensors(inputData, dataBytes);
     ARMNN_LOG(trace) << "Running inference...";
 
-    armnn::Status ret = m_Runtime->EnqueueWorkload(m_NetId, m_InputTensors, m_OutputTensors);
+    // Networks loaded for asynchronous execution can only be run through working memory.
+    armnn::Status ret = m_RunWorkingMemHandle ?
+                        m_Runtime->Execute(*m_RunWorkingMemHandle, m_InputTensors, m_OutputTensors) :
+                        m_Runtime->EnqueueWorkload(m_NetId, m_InputTensors, m_OutputTensors);
 
     std::stringstream inferenceFinished;
     inferenceFinished << "Inference finished with code {" << log_as_int(ret) << "}\n";
@@ -200,6 +267,42 @@ bool ArmnnNetworkExecutor<Tout>::Run(const void* inputData, const size_t dataByt
     return (armnn::Status::Success == ret);
 }
 
+template <typename Tout>
+void ArmnnNetworkExecutor<Tout>::RunAsync(const void* inputData,
+                                          const size_t dataBytes,
+                                          InferenceResults<Tout>& outResults,
+                                          std::function<void(bool)> callback)
+{
+    if (!m_Threadpool)
+    {
+        callback(Run(inputData, dataBytes, outResults));
+        return;
+    }
+
+    assert(m_inputBindingInfo.second.GetNumBytes() >= dataBytes);
+    if (outResults.size() != m_OutputBuffer.size())
+    {
+        outResults = m_OutputBuffer;
+    }
+
+    armnn::InputTensors inputTensors = {{ m_inputBindingInfo.first,
+                                          armnn::ConstTensor(m_inputBindingInfo.second, inputData) }};
+    armnn::OutputTensors outputTensors;
+    outputTensors.reserve(outResults.size());
+    for (size_t it = 0; it < outResults.size(); ++it)
+    {
+        outputTensors.emplace_back(m_outputBindingInfo[it].first,
+                                   armnn::Tensor(m_outputBindingInfo[it].second, outResults[it].data()));
+    }
+
+    ARMNN_LOG(trace) << "Scheduling inference...";
+    m_Threadpool->Schedule(m_NetId,
+                           inputTensors,
+                           outputTensors,
+                           armnn::QosExecPriority::Medium,
+                           std::make_shared<ExecutionCallback>(std::move(callback)));
+}
+
 template <typename Tout>
 float ArmnnNetworkExecutor<Tout>::GetQuantizationScale()
 {
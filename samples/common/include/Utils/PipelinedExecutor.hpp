@@ -0,0 +1,275 @@
+//
+// Copyright © 2024 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace common
+{
+/**
+* @brief A first-in first-out queue holding at most a fixed number of items, shared between threads.
+*/
+template <typename T>
+class BoundedQueue
+{
+public:
+    explicit BoundedQueue(size_t capacity) : m_Capacity(capacity) {}
+
+    /**
+    * @brief Adds an item at the back of the queue, blocking while the queue is full.
+    */
+    void Push(T item)
+    {
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        m_NotFull.wait(lock, [this] { return m_Items.size() < m_Capacity; });
+        m_Items.push_back(std::move(item));
+        m_NotEmpty.notify_one();
+    }
+
+    /**
+    * @brief Removes the item at the front of the queue, blocking while the queue is empty.
+    *
+    * @param[out] item - the removed item
+    * @return false if the queue is empty and has been closed.
+    */
+    bool Pop(T& item)
+    {
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        m_NotEmpty.wait(lock, [this] { return !m_Items.empty() || m_Closed; });
+        if (m_Items.empty())
+        {
+            return false;
+        }
+        item = std::move(m_Items.front());
+        m_Items.pop_front();
+        m_NotFull.notify_one();
+        return true;
+    }
+
+    /**
+    * @brief Signals that no more items will be pushed. Items already in the queue can still be popped.
+    */
+    void Close()
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Closed = true;
+        m_NotEmpty.notify_all();
+    }
+
+private:
+    const size_t m_Capacity;
+    std::deque<T> m_Items;
+    bool m_Closed = false;
+    std::mutex m_Mutex;
+    std::condition_variable m_NotEmpty;
+    std::condition_variable m_NotFull;
+};
+
+/**
+* @brief Runs the pre-processing, inference and post-processing of a stream of frames as overlapping stages.
+*
+* Each stage runs on its own thread, so frame N can be pre-processed while frame N-1 is inferred and frame N-2 is
+* post-processed. The frames hold the buffers used by every stage. A fixed set of them is handed out by
+* AcquireFrame() and recycled through ReleaseFrame(), which bounds the number of frames in flight and avoids
+* allocating buffers per frame.
+*
+* The inference stage is given a function to call once the frame's inference has finished. It can be called from
+* another thread, e.g. from an asynchronous execution callback, so several inferences can overlap. Frames are
+* post-processed and returned in the order they were submitted.
+*/
+template <typename Frame>
+class PipelinedExecutor
+{
+public:
+    using Stage = std::function<void(Frame&)>;
+    using InferenceStage = std::function<void(Frame&, std::function<void()> done)>;
+
+    /**
+    * @brief Starts the stage threads.
+    *
+    * @param[in] frames - the frames, with their buffers, to cycle through the pipeline
+    * @param[in] preProcessing - turns the input of a frame into the network input
+    * @param[in] inference - runs inference on the network input, then calls done
+    * @param[in] postProcessing - decodes the inference results of a frame
+    */
+    PipelinedExecutor(std::vector<std::unique_ptr<Frame>> frames,
+                      Stage preProcessing,
+                      InferenceStage inference,
+                      Stage postProcessing)
+        : m_PreProcessing(std::move(preProcessing))
+        , m_Inference(std::move(inference))
+        , m_PostProcessing(std::move(postProcessing))
+        , m_FreeFrames(frames.size())
+        , m_Submitted(frames.size())
+        , m_PreProcessed(frames.size())
+        , m_Results(frames.size())
+    {
+        for (auto& frame : frames)
+        {
+            m_FreeFrames.Push(std::move(frame));
+        }
+        m_PreProcessingThread = std::thread(&PipelinedExecutor::PreProcessingLoop, this);
+        m_InferenceThread = std::thread(&PipelinedExecutor::InferenceLoop, this);
+        m_PostProcessingThread = std::thread(&PipelinedExecutor::PostProcessingLoop, this);
+    }
+
+    PipelinedExecutor(const PipelinedExecutor&) = delete;
+    PipelinedExecutor& operator=(const PipelinedExecutor&) = delete;
+
+    ~PipelinedExecutor()
+    {
+        Finish();
+        // Drain any results which were not collected, so the post-processing thread can finish.
+        while (NextResult())
+        {
+        }
+        m_PreProcessingThread.join();
+        m_InferenceThread.join();
+        m_PostProcessingThread.join();
+    }
+
+    /**
+    * @brief Returns a free frame for the caller to fill in, blocking until one is available.
+    */
+    std::unique_ptr<Frame> AcquireFrame()
+    {
+        std::unique_ptr<Frame> frame;
+        m_FreeFrames.Pop(frame);
+        return frame;
+    }
+
+    /**
+    * @brief Queues a frame returned by AcquireFrame() for processing.
+    */
+    void Submit(std::unique_ptr<Frame> frame)
+    {
+        m_Submitted.Push(std::move(frame));
+    }
+
+    /**
+    * @brief Returns the next processed frame, in submission order, blocking until it is ready.
+    *
+    * @return nullptr once Finish() has been called and every submitted frame has been returned.
+    */
+    std::unique_ptr<Frame> NextResult()
+    {
+        std::unique_ptr<Frame> frame;
+        m_Results.Pop(frame);
+        return frame;
+    }
+
+    /**
+    * @brief Gives a frame returned by NextResult() back to the pipeline, so its buffers are reused.
+    */
+    void ReleaseFrame(std::unique_ptr<Frame> frame)
+    {
+        m_FreeFrames.Push(std::move(frame));
+    }
+
+    /**
+    * @brief Signals that no more frames will be submitted.
+    */
+    void Finish()
+    {
+        m_Submitted.Close();
+    }
+
+private:
+    void PreProcessingLoop()
+    {
+        std::unique_ptr<Frame> frame;
+        while (m_Submitted.Pop(frame))
+        {
+            m_PreProcessing(*frame);
+            m_PreProcessed.Push(std::move(frame));
+        }
+        m_PreProcessed.Close();
+    }
+
+    void InferenceLoop()
+    {
+        std::unique_ptr<Frame> frame;
+        uint64_t sequenceNumber = 0;
+        while (m_PreProcessed.Pop(frame))
+        {
+            Frame& frameRef = *frame;
+            {
+                std::lock_guard<std::mutex> lock(m_InferenceMutex);
+                m_Inferring.emplace(sequenceNumber, std::make_pair(std::move(frame), false));
+            }
+            m_Inference(frameRef, [this, sequenceNumber]()
+            {
+                std::lock_guard<std::mutex> lock(m_InferenceMutex);
+                m_Inferring.at(sequenceNumber).second = true;
+                m_Inferred.notify_one();
+            });
+            ++sequenceNumber;
+        }
+
+        std::lock_guard<std::mutex> lock(m_InferenceMutex);
+        m_NumScheduled = sequenceNumber;
+        m_AllScheduled = true;
+        m_Inferred.notify_one();
+    }
+
+    void PostProcessingLoop()
+    {
+        for (uint64_t sequenceNumber = 0;; ++sequenceNumber)
+        {
+            std::unique_ptr<Frame> frame;
+            {
+                std::unique_lock<std::mutex> lock(m_InferenceMutex);
+                m_Inferred.wait(lock, [this, sequenceNumber]
+                {
+                    auto it = m_Inferring.find(sequenceNumber);
+                    return (it != m_Inferring.end() && it->second.second) ||
+                           (m_AllScheduled && sequenceNumber == m_NumScheduled);
+                });
+                auto it = m_Inferring.find(sequenceNumber);
+                if (it == m_Inferring.end())
+                {
+                    break;
+                }
+                frame = std::move(it->second.first);
+                m_Inferring.erase(it);
+            }
+            m_PostProcessing(*frame);
+            m_Results.Push(std::move(frame));
+        }
+        m_Results.Close();
+    }
+
+    Stage m_PreProcessing;
+    InferenceStage m_Inference;
+    Stage m_PostProcessing;
+
+    BoundedQueue<std::unique_ptr<Frame>> m_FreeFrames;
+    BoundedQueue<std::unique_ptr<Frame>> m_Submitted;
+    BoundedQueue<std::unique_ptr<Frame>> m_PreProcessed;
+    BoundedQueue<std::unique_ptr<Frame>> m_Results;
+
+    /// Frames handed to the inference stage by sequence number, with whether their inference has finished.
+    std::map<uint64_t, std::pair<std::unique_ptr<Frame>, bool>> m_Inferring;
+    uint64_t m_NumScheduled = 0;
+    bool m_AllScheduled = false;
+    std::mutex m_InferenceMutex;
+    std::condition_variable m_Inferred;
+
+    std::thread m_PreProcessingThread;
+    std::thread m_InferenceThread;
+    std::thread m_PostProcessingThread;
+};
+}// namespace common
@@ -45,6 +45,8 @@ struct PipelineOptions
     std::string m_ModelFilePath;
     std::vector<armnn::BackendId> m_backends;
     bool m_ProfilingEnabled = false;
+    /// Number of inferences which can run at once when inference is scheduled asynchronously.
+    unsigned int m_NumInferenceThreads = 0;
 };
 
 template<typename T>
@@ -0,0 +1,104 @@
+//
+// Copyright © 2024 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include <catch.hpp>
+
+#include "PipelinedExecutor.hpp"
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+namespace
+{
+struct TestFrame
+{
+    int m_Input = 0;
+    int m_PreProcessed = 0;
+    int m_Inferred = 0;
+    int m_Output = 0;
+    std::vector<int> m_Buffer;
+};
+
+std::vector<std::unique_ptr<TestFrame>> CreateFrames(size_t numFrames)
+{
+    std::vector<std::unique_ptr<TestFrame>> frames;
+    for (size_t i = 0; i < numFrames; ++i)
+    {
+        frames.emplace_back(std::make_unique<TestFrame>());
+    }
+    return frames;
+}
+} // anonymous namespace
+
+TEST_CASE("Test PipelinedExecutor returns frames in order")
+{
+    const int numInputs = 100;
+    std::vector<std::thread> inferenceThreads;
+
+    common::PipelinedExecutor<TestFrame> executor(
+        CreateFrames(4),
+        [](TestFrame& frame) { frame.m_PreProcessed = frame.m_Input * 2; },
+        [&inferenceThreads](TestFrame& frame, std::function<void()> done)
+        {
+            // Finish the inferences out of order, on other threads.
+            const auto delay = std::chrono::microseconds((frame.m_Input % 3) * 200);
+            inferenceThreads.emplace_back([&frame, done, delay]()
+            {
+                std::this_thread::sleep_for(delay);
+                frame.m_Inferred = frame.m_PreProcessed + 1;
+                done();
+            });
+        },
+        [](TestFrame& frame) { frame.m_Output = frame.m_Inferred * 10; });
+
+    std::thread producer([&executor]()
+    {
+        for (int i = 0; i < numInputs; ++i)
+        {
+            std::unique_ptr<TestFrame> frame = executor.AcquireFrame();
+            frame->m_Input = i;
+            executor.Submit(std::move(frame));
+        }
+        executor.Finish();
+    });
+
+    int expectedInput = 0;
+    while (std::unique_ptr<TestFrame> frame = executor.NextResult())
+    {
+        CHECK(frame->m_Input == expectedInput);
+        CHECK(frame->m_Output == (expectedInput * 2 + 1) * 10);
+        ++expectedInput;
+        executor.ReleaseFrame(std::move(frame));
+    }
+    producer.join();
+    for (auto& thread : inferenceThreads)
+    {
+        thread.join();
+    }
+    CHECK(expectedInput == numInputs);
+}
+
+TEST_CASE("Test PipelinedExecutor reuses frames")
+{
+    std::vector<std::unique_ptr<TestFrame>> frames = CreateFrames(2);
+    std::vector<const TestFrame*> framePointers = { frames[0].get(), frames[1].get() };
+
+    common::PipelinedExecutor<TestFrame> executor(
+        std::move(frames),
+        [](TestFrame& frame) { frame.m_Buffer.resize(16); },
+        [](TestFrame&, std::function<void()> done) { done(); },
+        [](TestFrame&) {});
+
+    for (int i = 0; i < 10; ++i)
+    {
+        std::unique_ptr<TestFrame> frame = executor.AcquireFrame();
+        CHECK((frame.get() == framePointers[0] || frame.get() == framePointers[1]));
+        executor.Submit(std::move(frame));
+        executor.ReleaseFrame(executor.NextResult());
+    }
+    executor.Finish();
+    CHECK(executor.NextResult() == nullptr);
+}
@@ -1,5 +1,5 @@
 //
-// Copyright © 2021-2023 Arm Ltd and Contributors. All rights reserved.
+// Copyright © 2021-2024 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 
@@ -23,6 +23,10 @@ void AsyncExecutionCallback::Notify(armnn::Status status, InferenceTimingPair ti
         m_Status    = status;
         m_StartTime = timeTaken.first;
         m_EndTime   = timeTaken.second;
+        if (!m_Queued)
+        {
+            m_ScheduledTime = m_StartTime;
+        }
         m_NotificationQueue.push(m_InferenceId);
     }
 #if !defined(ARMNN_DISABLE_THREADS)
@@ -30,6 +34,26 @@ void AsyncExecutionCallback::Notify(armnn::Status status, InferenceTimingPair ti
 #endif
 }
 
+void AsyncExecutionCallback::NotifyQueueingTime(InferenceTimingPair queueingTime)
+{
+#if !defined(ARMNN_DISABLE_THREADS)
+    std::lock_guard<std::mutex> hold(m_Mutex);
+#endif
+    m_ScheduledTime = queueingTime.first;
+    m_Queued        = true;
+}
+
+void AsyncExecutionCallback::NotifyRejected(HighResolutionClock time)
+{
+    {
+#if !defined(ARMNN_DISABLE_THREADS)
+        std::lock_guard<std::mutex> hold(m_Mutex);
+#endif
+        m_Rejected = true;
+    }
+    Notify(Status::Failure, std::make_pair(time, time));
+}
+
 armnn::Status AsyncExecutionCallback::GetStatus() const
 {
     return m_Status;
@@ -45,6 +69,16 @@ HighResolutionClock AsyncExecutionCallback::GetEndTime() const
     return m_EndTime;
 }
 
+HighResolutionClock AsyncExecutionCallback::GetScheduledTime() const
+{
+    return m_ScheduledTime;
+}
+
+bool AsyncExecutionCallback::IsRejected() const
+{
+    return m_Rejected;
+}
+
 std::shared_ptr<AsyncExecutionCallback> AsyncCallbackManager::GetNewCallback()
 {
     auto cb = std::make_unique<AsyncExecutionCallback>(m_NotificationQueue
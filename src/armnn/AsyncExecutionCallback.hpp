@@ -1,5 +1,5 @@
 //
-// Copyright © 2021-2023 Arm Ltd and Contributors. All rights reserved.
+// Copyright © 2021-2024 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 
@@ -45,7 +45,9 @@ public:
     ~AsyncExecutionCallback()
     {}
 
-    void Notify(armnn::Status status, InferenceTimingPair timeTaken);
+    void Notify(armnn::Status status, InferenceTimingPair timeTaken) override;
+    void NotifyQueueingTime(InferenceTimingPair queueingTime) override;
+    void NotifyRejected(HighResolutionClock time) override;
 
     InferenceId GetInferenceId()
     {
@@ -55,6 +57,10 @@ public:
     armnn::Status GetStatus() const;
     HighResolutionClock GetStartTime() const;
     HighResolutionClock GetEndTime() const;
+    /// The time the execution was scheduled at, which is the start time if it wasn't queued
+    HighResolutionClock GetScheduledTime() const;
+    /// Whether the execution was rejected without being run, as it couldn't meet its deadline
+    bool IsRejected() const;
 
 private:
     std::queue<InferenceId>& m_NotificationQueue;
@@ -65,6 +71,9 @@ private:
 
     HighResolutionClock m_StartTime;
     HighResolutionClock m_EndTime;
+    HighResolutionClock m_ScheduledTime;
+    bool                m_Queued   = false;
+    bool                m_Rejected = false;
     armnn::Status       m_Status = Status::Failure;
     InferenceId m_InferenceId;
 };
@@ -6,10 +6,12 @@
 #pragma once
 
 #include "DeviceSpec.hpp"
+#include "LayerSupportCache.hpp"
 
 #include <armnn/BackendId.hpp>
 #include <armnn/utility/PolymorphicDowncast.hpp>
 
+#include <memory>
 #include <vector>
 
 namespace armnn
@@ -22,6 +24,9 @@ struct BackendSettings
     BackendIdSet    m_SelectedBackends;
     BackendIdSet    m_IgnoredBackends;
 
+    /// Shared by the copies made while assigning backends so that answers are reused across the whole graph.
+    std::shared_ptr<LayerSupportCache> m_LayerSupportCache = std::make_shared<LayerSupportCache>();
+
     BackendSettings() = default;
 
     BackendSettings(const BackendIdVector& preferredBackends,
@@ -35,6 +40,7 @@ struct BackendSettings
         , m_SupportedBackends(other.m_SupportedBackends)
         , m_SelectedBackends(other.m_SelectedBackends)
         , m_IgnoredBackends(other.m_IgnoredBackends)
+        , m_LayerSupportCache(other.m_LayerSupportCache)
     {
     }
 
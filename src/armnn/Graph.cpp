@@ -17,6 +17,7 @@
 
 #include <fmt/format.h>
 
+#include <limits>
 #include <unordered_map>
 #include <DotSerializer.hpp>
 #include <sstream>
@@ -26,6 +27,7 @@ namespace armnn
 
 Graph::Graph(const Graph& other)
 :   m_LayersInOrder(other.m_LayersInOrder)
+,   m_FullSortRequired(other.m_FullSortRequired)
 ,   m_AllowExpandedDims(other.m_AllowExpandedDims)
 ,   m_ShapeInferenceMethod(other.m_ShapeInferenceMethod)
 ,   m_Profiler(other.m_Profiler)
@@ -57,12 +59,22 @@ Graph::Graph(const Graph& other)
                 {
                     inputSlot.SetTensorInfo(otherInputSlot->GetTensorInfo());
                 }
-                outputSlot->Connect(inputSlot);
+                const int connectionIndex = outputSlot->Connect(inputSlot);
+                outputSlot->SetEdgeStrategy(armnn::numeric_cast<unsigned int>(connectionIndex),
+                                            otherOutputSlot.GetEdgeStrategyForConnection(
+                                                armnn::numeric_cast<unsigned int>(connectionIndex)));
             }
             outputSlot->SetTensorInfo(otherOutputSlot.GetTensorInfo());
+            // Keeps the tensor handle choices made when the graph was optimized.
+            outputSlot->SetTensorHandleFactory(otherOutputSlot.GetTensorHandleFactoryId());
             ++outputSlot;
         }
     }
+
+    // The layers were cloned in the same relative order, so the copy is sorted if the original was.
+    m_LayersInOrder = other.m_LayersInOrder;
+    m_FullSortRequired = !other.m_LayersInOrder;
+    m_UnorderedLayers.clear();
 }
 
 Status Graph::Print(bool extended) const
@@ -305,6 +317,12 @@ Status Graph::AllocateDynamicBuffers()
 
 const Graph& Graph::TopologicalSort() const
 {
+    if (!m_LayersInOrder && !m_FullSortRequired && PlaceUnorderedLayers())
+    {
+        m_UnorderedLayers.clear();
+        m_LayersInOrder = true;
+    }
+
     if (!m_LayersInOrder)
     {
         // Resets layer order.
@@ -319,13 +337,175 @@ const Graph& Graph::TopologicalSort() const
             };
 
         m_Layers.sort(compareLayerPriority);
+        ResetOrderKeys();
 
+        m_UnorderedLayers.clear();
+        m_FullSortRequired = false;
         m_LayersInOrder = true;
     }
 
     return *this;
 }
 
+bool Graph::IsBefore(const Layer& layerA, const Layer& layerB) const
+{
+    return layerA.m_OrderKey < layerB.m_OrderKey;
+}
+
+namespace
+{
+
+/// Initial distance between the order keys of consecutive layers, leaving room for layers inserted in between.
+constexpr uint64_t OrderKeySpacing = uint64_t(1) << 32;
+
+/// Layers are only placed one by one when at most one in this many layers of the graph were added since the
+/// last sort. Otherwise, e.g. for small graphs or while a network is being built, a full sort is cheap enough.
+constexpr size_t UnorderedLayersRatio = 8;
+
+} // anonymous namespace
+
+void Graph::AssignOrderKey(Iterator it) const
+{
+    const uint64_t prevKey = (it == m_Layers.begin()) ? 0 : (*std::prev(it))->m_OrderKey;
+    const auto next = std::next(it);
+    if (next == m_Layers.end())
+    {
+        if (prevKey <= std::numeric_limits<uint64_t>::max() - OrderKeySpacing)
+        {
+            (*it)->m_OrderKey = prevKey + OrderKeySpacing;
+            return;
+        }
+    }
+    else
+    {
+        const uint64_t nextKey = (*next)->m_OrderKey;
+        if (nextKey - prevKey > 1)
+        {
+            (*it)->m_OrderKey = prevKey + (nextKey - prevKey) / 2;
+            return;
+        }
+    }
+
+    // No room left between the neighbours.
+    ResetOrderKeys();
+}
+
+void Graph::ResetOrderKeys() const
+{
+    uint64_t key = 0;
+    for (auto&& layer : m_Layers)
+    {
+        key += OrderKeySpacing;
+        layer->m_OrderKey = key;
+    }
+}
+
+bool Graph::PlaceUnorderedLayers() const
+{
+    if (m_UnorderedLayers.size() * UnorderedLayersRatio > m_Layers.size())
+    {
+        return false;
+    }
+
+    std::unordered_set<const Layer*> unplacedLayers(m_UnorderedLayers.begin(), m_UnorderedLayers.end());
+    for (auto&& layer : m_UnorderedLayers)
+    {
+        if (!PlaceUnorderedLayer(*layer, unplacedLayers))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool Graph::PlaceUnorderedLayer(Layer& layer, std::unordered_set<const Layer*>& unplacedLayers) const
+{
+    if (unplacedLayers.erase(&layer) == 0)
+    {
+        // Already placed as the parent of another layer.
+        return true;
+    }
+
+    // The layer must come after its latest parent...
+    const Layer* latestParent = nullptr;
+    for (auto&& inputSlot : layer.GetInputSlots())
+    {
+        const OutputSlot* connectedOutput = inputSlot.GetConnectedOutputSlot();
+        if (connectedOutput == nullptr)
+        {
+            continue;
+        }
+        Layer& parent = connectedOutput->GetOwningLayer();
+        if (!PlaceUnorderedLayer(parent, unplacedLayers))
+        {
+            return false;
+        }
+        if (latestParent == nullptr || IsBefore(*latestParent, parent))
+        {
+            latestParent = &parent;
+        }
+    }
+
+    // ...and before its earliest child. Children which are yet to be placed will be placed after it, so
+    // it must also come before their own children.
+    const Layer* earliestChild = nullptr;
+    std::vector<const Layer*> descendants = { &layer };
+    std::unordered_set<const Layer*> visited;
+    while (!descendants.empty())
+    {
+        const Layer* descendant = descendants.back();
+        descendants.pop_back();
+        for (auto&& outputSlot : descendant->GetOutputSlots())
+        {
+            for (auto&& connection : outputSlot.GetConnections())
+            {
+                const Layer& child = connection->GetOwningLayer();
+                if (unplacedLayers.find(&child) != unplacedLayers.end())
+                {
+                    if (visited.insert(&child).second)
+                    {
+                        descendants.push_back(&child);
+                    }
+                }
+                else if (earliestChild == nullptr || IsBefore(child, *earliestChild))
+                {
+                    earliestChild = &child;
+                }
+            }
+        }
+    }
+
+    if ((latestParent == nullptr || IsBefore(*latestParent, layer)) &&
+        (earliestChild == nullptr || IsBefore(layer, *earliestChild)))
+    {
+        return true;
+    }
+
+    if (latestParent != nullptr && earliestChild != nullptr && !IsBefore(*latestParent, *earliestChild))
+    {
+        return false;
+    }
+
+    // Moves the layer right after its latest parent, or after the inputs if it only depends on inputs.
+    Iterator insertBefore;
+    if (latestParent != nullptr && latestParent->GetType() != LayerType::Input)
+    {
+        insertBefore = std::next(m_PosInGraphMap.at(latestParent));
+    }
+    else
+    {
+        insertBefore = std::next(m_Layers.begin(), IteratorDifference(GetNumInputs()));
+    }
+
+    const Iterator layerIt = m_PosInGraphMap.at(&layer);
+    if (insertBefore != layerIt)
+    {
+        m_Layers.splice(insertBefore, m_Layers, layerIt);
+        AssignOrderKey(layerIt);
+    }
+    return true;
+}
+
 void Graph::AddCompatibilityLayers(std::map<BackendId, std::unique_ptr<IBackendInternal>>& backends,
                                    TensorHandleFactoryRegistry& registry)
 {
@@ -480,7 +660,7 @@ void Graph::SubstituteSubgraph(SubgraphView& subgraph, const SubgraphView& subst
         {
             auto layer = PolymorphicDowncast<Layer*>(iConnectableLayer);
             layer->Reparent(*this, m_Layers.end());
-            m_LayersInOrder = false;
+            SetLayersOutOfOrder();
         }
     });
 
@@ -697,6 +877,7 @@ const std::shared_ptr<IProfiler>& Graph::GetProfiler() const
 void Graph::SetLayersOutOfOrder()
 {
     m_LayersInOrder = false;
+    m_FullSortRequired = true;
 }
 
 } // namespace armnn
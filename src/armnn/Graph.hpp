@@ -16,6 +16,7 @@
 #include <armnn/utility/PolymorphicDowncast.hpp>
 #include <armnn/utility/TransformIterator.hpp>
 
+#include <algorithm>
 #include <list>
 #include <map>
 #include <unordered_map>
@@ -97,6 +98,7 @@ public:
 
     Graph(bool shapeInferenceMethod = false, bool allowExpandedDims = false)
         : m_LayersInOrder(true)
+        , m_FullSortRequired(false)
         , m_AllowExpandedDims(allowExpandedDims)
         , m_ShapeInferenceMethod(shapeInferenceMethod ? ShapeInferenceMethod::InferAndValidate :
                                                         ShapeInferenceMethod::ValidateOnly)
@@ -117,6 +119,8 @@ public:
         m_InputIds      = std::move(other.m_InputIds);
         m_OutputIds     = std::move(other.m_OutputIds);
         m_LayersInOrder = std::move(other.m_LayersInOrder);
+        // Layers waiting to be placed in the other graph are not tracked across the move.
+        m_FullSortRequired = other.m_FullSortRequired || !other.m_UnorderedLayers.empty();
         m_Views         = std::move(other.m_Views);
         m_Profiler      = std::move(other.m_Profiler);
         m_AllowExpandedDims    = other.m_AllowExpandedDims;
@@ -181,9 +185,15 @@ public:
     ConstIterator cend() const { return end(); }
 
     /// Sorts layers in topological order and return this.
+    /// Layers added since the last sort are moved into place individually when possible, instead of re-sorting
+    /// the whole graph.
     Graph& TopologicalSort() { const_cast<const Graph*>(this)->TopologicalSort(); return *this; }
     const Graph& TopologicalSort() const;
 
+    /// Returns true if layerA comes before layerB in the list of layers, in constant time.
+    /// This matches the topological order of the layers after a call to TopologicalSort().
+    bool IsBefore(const Layer& layerA, const Layer& layerB) const;
+
     size_t GetNumInputs() const { return m_InputIds.size(); }
     size_t GetNumOutputs() const { return m_OutputIds.size(); }
 
@@ -229,6 +239,7 @@ public:
 
     const std::shared_ptr<IProfiler>& GetProfiler() const;
 
+    /// Forces the next call to TopologicalSort() to re-sort the whole graph.
     void SetLayersOutOfOrder();
 
 private:
@@ -265,6 +276,16 @@ private:
         return it;
     }
 
+    /// Gives the layer at the given position an order key between the keys of its neighbours.
+    void AssignOrderKey(Iterator it) const;
+    /// Gives evenly spaced order keys to all the layers, following their order in the list.
+    void ResetOrderKeys() const;
+
+    /// Moves the layers added since the last sort into a valid position, one at a time.
+    /// Returns false if this is not possible without moving other layers, in which case a full sort is required.
+    bool PlaceUnorderedLayers() const;
+    bool PlaceUnorderedLayer(Layer& layer, std::unordered_set<const Layer*>& unplacedLayers) const;
+
     void NotifyObservables(GraphEvent event, Layer* graphState)
     {
         // Iterate over all observables observing this event
@@ -284,6 +305,10 @@ private:
     /// Mutable to allow sorting on const object.
     mutable LayerList m_Layers;
     mutable bool m_LayersInOrder;
+    /// Set when the order may have been broken by something other than adding layers.
+    mutable bool m_FullSortRequired;
+    /// Layers added since the last sort, which may not be in topological order with the rest of the graph.
+    mutable std::vector<Layer*> m_UnorderedLayers;
 
     bool m_AllowExpandedDims;
 
@@ -327,7 +352,9 @@ protected:
 private:
     void Insert(Graph& graph, Iterator insertBefore)
     {
-        graph.m_PosInGraphMap.emplace(this, graph.m_Layers.emplace(insertBefore, this));
+        auto layerIt = graph.m_Layers.emplace(insertBefore, this);
+        graph.m_PosInGraphMap.emplace(this, layerIt);
+        graph.AssignOrderKey(layerIt);
     }
 
     void Remove(Graph& graph)
@@ -335,6 +362,10 @@ private:
         auto layerIt = graph.GetPosInGraph(*this);
         graph.m_Layers.erase(layerIt);
 
+        auto& unorderedLayers = graph.m_UnorderedLayers;
+        unorderedLayers.erase(std::remove(unorderedLayers.begin(), unorderedLayers.end(), this),
+                              unorderedLayers.end());
+
         const size_t numErased = graph.m_PosInGraphMap.erase(this);
         IgnoreUnused(numErased);
         ARMNN_ASSERT(numErased == 1);
@@ -455,10 +486,17 @@ inline Graph::Iterator Graph::GetPosInGraph(Layer& layer)
 template <typename LayerT, typename... Args>
 inline LayerT* Graph::AddLayer(Args&&... args)
 {
-    m_LayersInOrder = m_LayersInOrder &&
-        ((LayerEnumOf<LayerT>() == LayerType::Input) || (LayerEnumOf<LayerT>() == LayerType::Output));
     LayerT* const layer = new LayerInGraph<LayerT>(*this, std::forward<Args>(args)...);
 
+    // Inputs, outputs and constants are always added in a valid position. Other layers are put in place
+    // by the next call to TopologicalSort(), once they have been connected.
+    if ((LayerEnumOf<LayerT>() != LayerType::Input) && (LayerEnumOf<LayerT>() != LayerType::Output) &&
+        (LayerEnumOf<LayerT>() != LayerType::Constant))
+    {
+        m_LayersInOrder = false;
+        m_UnorderedLayers.push_back(layer);
+    }
+
     layer->SetShapeInferenceMethod(m_ShapeInferenceMethod);
     layer->SetAllowExpandedDims(m_AllowExpandedDims);
 
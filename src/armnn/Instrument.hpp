@@ -1,5 +1,5 @@
 //
-// Copyright © 2017 Arm Ltd. All rights reserved.
+// Copyright © 2017, 2024 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 
@@ -18,6 +18,7 @@ struct Measurement
         TIME_NS,
         TIME_US,
         TIME_MS,
+        COUNT,
     };
 
     inline static const char* ToString(Unit unit)
@@ -27,6 +28,7 @@ struct Measurement
             case TIME_NS: return "ns";
             case TIME_US: return "us";
             case TIME_MS: return "ms";
+            case COUNT:   return "count";
             default:      return "";
         }
     }
@@ -453,6 +453,8 @@ private:
     /// Used for sorting.
     mutable LayerPriority m_Priority = 0;
     mutable bool m_Visiting = false;
+    /// Increases along the graph's list of layers, so the graph can compare positions in constant time.
+    uint64_t m_OrderKey = 0;
 
     bool m_AllowExpandedDims = false;
 
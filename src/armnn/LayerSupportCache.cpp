@@ -0,0 +1,240 @@
+//
+// Copyright © 2024 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "LayerSupportCache.hpp"
+
+#include "Layer.hpp"
+#include "LayersFwd.hpp"
+
+#include <armnn/BackendRegistry.hpp>
+#include <armnn/backends/WorkloadFactory.hpp>
+#include <armnn/utility/PolymorphicDowncast.hpp>
+
+#include <functional>
+#include <type_traits>
+
+namespace armnn
+{
+
+/// A copy of the descriptor of a layer, as the layer it was taken from may be changed or removed from the graph by
+/// the time another layer is compared with it.
+class LayerSupportCache::DescriptorCopy
+{
+public:
+    virtual ~DescriptorCopy() = default;
+
+    /// The layer given has the same type as the one the descriptor was copied from.
+    virtual bool Equals(const Layer& layer) const = 0;
+};
+
+namespace
+{
+
+template <typename Descriptor, typename = void>
+struct IsComparable : std::false_type {};
+
+template <typename Descriptor>
+struct IsComparable<Descriptor, std::void_t<decltype(std::declval<Descriptor>() == std::declval<Descriptor>())>>
+    : std::true_type {};
+
+template <typename Descriptor>
+class TypedDescriptorCopy : public LayerSupportCache::DescriptorCopy
+{
+public:
+    explicit TypedDescriptorCopy(const Descriptor& descriptor)
+        : m_Descriptor(descriptor)
+    {}
+
+    bool Equals(const Layer& layer) const override
+    {
+        if constexpr (IsComparable<Descriptor>::value)
+        {
+            return m_Descriptor == *PolymorphicDowncast<const Descriptor*>(&layer.GetParameters());
+        }
+        else
+        {
+            // Descriptors which can't be compared never match, so the result is not reused.
+            IgnoreUnused(layer);
+            return false;
+        }
+    }
+
+private:
+    Descriptor m_Descriptor;
+};
+
+template <typename LayerT, typename = void>
+struct HasDescriptor : std::false_type {};
+
+template <typename LayerT>
+struct HasDescriptor<LayerT, std::void_t<typename LayerT::DescriptorType>> : std::true_type {};
+
+template <LayerType Type>
+std::unique_ptr<LayerSupportCache::DescriptorCopy> CopyDescriptorOf(const Layer& layer)
+{
+    using LayerT = LayerTypeOf<Type>;
+    if constexpr (HasDescriptor<LayerT>::value)
+    {
+        using Descriptor = typename LayerT::DescriptorType;
+        return std::make_unique<TypedDescriptorCopy<Descriptor>>(
+            *PolymorphicDowncast<const Descriptor*>(&layer.GetParameters()));
+    }
+    else
+    {
+        IgnoreUnused(layer);
+        return nullptr;
+    }
+}
+
+/// Returns nullptr for layers without a descriptor.
+std::unique_ptr<LayerSupportCache::DescriptorCopy> CopyDescriptor(const Layer& layer)
+{
+    switch (layer.GetType())
+    {
+#define X(name) case LayerType::name: return CopyDescriptorOf<LayerType::name>(layer);
+        LIST_OF_LAYER_TYPE
+#undef X
+        default:
+            return nullptr;
+    }
+}
+
+/// The tensor infos the support of a layer depends on: its inputs, outputs and constant tensors.
+std::vector<TensorInfo> GetTensorInfos(const Layer& layer)
+{
+    std::vector<TensorInfo> tensorInfos;
+    tensorInfos.reserve(layer.GetNumInputSlots() + layer.GetNumOutputSlots());
+    for (unsigned int i = 0; i < layer.GetNumInputSlots(); ++i)
+    {
+        const OutputSlot* connection = layer.GetInputSlot(i).GetConnectedOutputSlot();
+        tensorInfos.push_back(connection ? connection->GetTensorInfo() : TensorInfo());
+    }
+    for (unsigned int i = 0; i < layer.GetNumOutputSlots(); ++i)
+    {
+        tensorInfos.push_back(layer.GetOutputSlot(i).GetTensorInfo());
+    }
+    const IConnectableLayer& connectableLayer = layer;
+    for (const std::shared_ptr<ConstTensorHandle>& constant : connectableLayer.GetConstantTensorsByRef())
+    {
+        // An empty info with another number of dimensions stands for a missing optional tensor, so that it is told
+        // apart from an empty one.
+        tensorInfos.push_back(constant ? constant->GetTensorInfo()
+                                       : TensorInfo(TensorShape(Dimensionality::NotSpecified), DataType::Float32));
+    }
+    return tensorInfos;
+}
+
+void HashCombine(size_t& seed, size_t value)
+{
+    seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+}
+
+size_t Hash(const BackendId& backendId,
+            LayerType layerType,
+            Optional<DataType> dataType,
+            const std::vector<TensorInfo>& tensorInfos)
+{
+    size_t seed = std::hash<BackendId>()(backendId);
+    HashCombine(seed, static_cast<size_t>(layerType));
+    HashCombine(seed, dataType.has_value() ? static_cast<size_t>(dataType.value()) + 1 : 0);
+    for (const TensorInfo& info : tensorInfos)
+    {
+        HashCombine(seed, static_cast<size_t>(info.GetDataType()));
+        const TensorShape& shape = info.GetShape();
+        if (shape.GetDimensionality() == Dimensionality::Specified && shape.AreAllDimensionsSpecified())
+        {
+            for (unsigned int i = 0; i < shape.GetNumDimensions(); ++i)
+            {
+                HashCombine(seed, shape[i]);
+            }
+        }
+    }
+    return seed;
+}
+
+} // anonymous namespace
+
+LayerSupportCache::LayerSupportCache() = default;
+
+LayerSupportCache::~LayerSupportCache() = default;
+
+const LayerSupportCache::Backend* LayerSupportCache::GetBackend(const BackendId& backendId)
+{
+    auto it = m_Backends.find(backendId);
+    if (it == m_Backends.end())
+    {
+        Backend backend;
+        auto& registry = BackendRegistryInstance();
+        if (registry.IsBackendRegistered(backendId))
+        {
+            backend.m_Backend = registry.GetFactory(backendId)();
+            backend.m_LayerSupport = backend.m_Backend->GetLayerSupport(ModelOptions());
+        }
+        it = m_Backends.emplace(backendId, std::move(backend)).first;
+    }
+    return it->second.m_Backend ? &it->second : nullptr;
+}
+
+bool LayerSupportCache::Matches(const Result& result,
+                                const Layer& layer,
+                                Optional<DataType> dataType,
+                                const std::vector<TensorInfo>& tensorInfos) const
+{
+    if (result.m_BackendId != layer.GetBackendId() ||
+        result.m_LayerType != layer.GetType() ||
+        result.m_DataType.has_value() != dataType.has_value() ||
+        (dataType.has_value() && result.m_DataType.value() != dataType.value()) ||
+        result.m_TensorInfos != tensorInfos)
+    {
+        return false;
+    }
+    return !result.m_Descriptor || result.m_Descriptor->Equals(layer);
+}
+
+bool LayerSupportCache::IsLayerSupported(const Layer& layer,
+                                         Optional<DataType> dataType,
+                                         std::string& outReasonIfUnsupported)
+{
+    const BackendId& backendId = layer.GetBackendId();
+    const Backend* backend = GetBackend(backendId);
+
+    // Pre-compiled layers carry state which can't be compared, so they are always asked about.
+    if (!backend || layer.GetType() == LayerType::PreCompiled)
+    {
+        return IWorkloadFactory::IsLayerSupported(layer, dataType, outReasonIfUnsupported);
+    }
+
+    std::vector<TensorInfo> tensorInfos = GetTensorInfos(layer);
+    const size_t hash = Hash(backendId, layer.GetType(), dataType, tensorInfos);
+
+    auto range = m_Results.equal_range(hash);
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        if (Matches(it->second, layer, dataType, tensorInfos))
+        {
+            outReasonIfUnsupported += it->second.m_ReasonIfUnsupported;
+            return it->second.m_Supported;
+        }
+    }
+
+    std::string reasonIfUnsupported;
+    const bool supported = IWorkloadFactory::IsLayerSupported(backendId,
+                                                              backend->m_LayerSupport,
+                                                              layer,
+                                                              dataType,
+                                                              reasonIfUnsupported);
+    outReasonIfUnsupported += reasonIfUnsupported;
+
+    m_Results.emplace(hash, Result{ backendId,
+                                    layer.GetType(),
+                                    dataType,
+                                    std::move(tensorInfos),
+                                    CopyDescriptor(layer),
+                                    supported,
+                                    std::move(reasonIfUnsupported) });
+    return supported;
+}
+
+} // namespace armnn
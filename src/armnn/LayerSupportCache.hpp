@@ -0,0 +1,73 @@
+//
+// Copyright © 2024 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include <armnn/BackendId.hpp>
+#include <armnn/Optional.hpp>
+#include <armnn/Tensor.hpp>
+#include <armnn/Types.hpp>
+#include <armnn/backends/IBackendInternal.hpp>
+#include <armnn/backends/ILayerSupport.hpp>
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace armnn
+{
+
+class Layer;
+
+/// Answers layer support queries during a single Optimize call. The backends and their layer support objects are
+/// created once rather than for every query, and the answer for a layer is remembered so that other layers with the
+/// same type, descriptor and tensor infos (e.g. the repeated blocks of a transformer) don't query the backend again.
+class LayerSupportCache
+{
+public:
+    LayerSupportCache();
+    ~LayerSupportCache();
+
+    /// Same as IWorkloadFactory::IsLayerSupported for the backend the layer is assigned to. The reason the layer
+    /// isn't supported, if any, is appended to outReasonIfUnsupported.
+    bool IsLayerSupported(const Layer& layer, Optional<DataType> dataType, std::string& outReasonIfUnsupported);
+
+    /// Number of different layer configurations the backends have been asked about.
+    size_t GetNumCachedResults() const { return m_Results.size(); }
+
+    class DescriptorCopy;
+
+private:
+    struct Result
+    {
+        BackendId m_BackendId;
+        LayerType m_LayerType;
+        Optional<DataType> m_DataType;
+        std::vector<TensorInfo> m_TensorInfos;
+        std::unique_ptr<DescriptorCopy> m_Descriptor;
+        bool m_Supported;
+        std::string m_ReasonIfUnsupported;
+    };
+
+    struct Backend
+    {
+        IBackendInternalUniquePtr m_Backend;
+        ILayerSupportSharedPtr m_LayerSupport;
+    };
+
+    /// Returns nullptr if the backend is not registered.
+    const Backend* GetBackend(const BackendId& backendId);
+
+    bool Matches(const Result& result,
+                 const Layer& layer,
+                 Optional<DataType> dataType,
+                 const std::vector<TensorInfo>& tensorInfos) const;
+
+    std::unordered_map<BackendId, Backend> m_Backends;
+    std::unordered_multimap<size_t, Result> m_Results;
+};
+
+} // namespace armnn
@@ -1,5 +1,5 @@
 //
-// Copyright © 2017-2023 Arm Ltd and Contributors. All rights reserved.
+// Copyright © 2017-2024 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 
@@ -23,6 +23,7 @@
 #include <armnn/profiling/ArmNNProfiling.hpp>
 
 #include <armnn/utility/Assert.hpp>
+#include <armnn/utility/PolymorphicDowncast.hpp>
 
 #include <backendsCommon/MemSyncWorkload.hpp>
 
@@ -30,6 +31,8 @@
 
 #include <fmt/format.h>
 
+#include <algorithm>
+
 namespace armnn
 {
 
@@ -224,6 +227,16 @@ LoadedNetwork::LoadedNetwork(std::unique_ptr<IOptimizedNetwork> net,
     ValidateSourcesMatchOptimizedNetwork(m_OptimizedNetwork.get()->pOptimizedNetworkImpl->GetModelOptions(),
                                          m_NetworkProperties);
 
+    // The number of other input shapes EnqueueWorkload keeps the network prepared for, see IRuntime::EnqueueWorkload.
+    ParseOptions(m_OptimizedNetwork->pOptimizedNetworkImpl->GetModelOptions(), "Global",
+                 [&](std::string name, const BackendOptions::Var& value)
+    {
+        if (name == "ShapeCacheSize")
+        {
+            m_ShapeCacheSize = armnn::numeric_cast<unsigned int>(ParseIntBackendOption(value, 0));
+        }
+    });
+
     //First create tensor handlers, backends and workload factories.
     //Handlers are created before workloads are.
     //Because workload creation can modify some of the handlers,
@@ -424,8 +437,12 @@ LoadedNetwork::LoadedNetwork(std::unique_ptr<IOptimizedNetwork> net,
                             ConstWorkloads.push_back(m_WorkloadQueue.back().get());
                         }
                     }
-                    // release the constant data in the layer.
-                    layer->ReleaseConstantData();
+                    // release the constant data in the layer, unless it's copied along with the layer to prepare the
+                    // network for other input shapes.
+                    if (m_ShapeCacheSize == 0)
+                    {
+                        layer->ReleaseConstantData();
+                    }
                     break;
                 }
             }
@@ -862,6 +879,19 @@ Status LoadedNetwork::EnqueueWorkload(const InputTensors& inputTensors,
         return Status::Failure;
     }
 
+    if (m_ShapeCacheSize > 0)
+    {
+        if (LoadedNetwork* shapePlan = GetShapePlan(inputTensors))
+        {
+            if (!preImportedInputIds.empty() || !preImportedOutputIds.empty())
+            {
+                throw InvalidArgumentException("EnqueueWorkload: pre-imported tensors can only be used with the "
+                                               "input shapes the network was loaded with.");
+            }
+            return shapePlan->EnqueueWorkload(inputTensors, outputTensors);
+        }
+    }
+
     // Data that must be kept alive for the entire execution of the workload.
     WorkloadData workloadData(inputTensors, outputTensors);
 
@@ -1257,6 +1287,147 @@ void LoadedNetwork::FreeWorkingMemory()
     }
     m_TensorHandleFactoryRegistry.ReleaseMemory();
     m_IsWorkingMemAllocated = false;
+
+    for (auto& shapePlan : m_ShapePlans)
+    {
+        shapePlan.second->FreeWorkingMemory();
+    }
+}
+
+std::vector<TensorShape> LoadedNetwork::GetInputShapes(const InputTensors& inputTensors) const
+{
+    const Graph& graph = m_OptimizedNetwork->pOptimizedNetworkImpl->GetGraph();
+
+    std::vector<TensorShape> inputShapes;
+    inputShapes.reserve(graph.GetNumInputs());
+    for (const BindableLayer* inputLayer : graph.GetInputLayers())
+    {
+        auto it = std::find_if(inputTensors.begin(), inputTensors.end(),
+                               [inputLayer](const std::pair<LayerBindingId, ConstTensor>& inputTensor)
+                               {
+                                   return inputTensor.first == inputLayer->GetBindingId();
+                               });
+        inputShapes.push_back(it != inputTensors.end() ? it->second.GetShape()
+                                                       : inputLayer->GetOutputSlot(0).GetTensorInfo().GetShape());
+    }
+    return inputShapes;
+}
+
+LoadedNetwork* LoadedNetwork::GetShapePlan(const InputTensors& inputTensors)
+{
+    std::vector<TensorShape> inputShapes = GetInputShapes(inputTensors);
+    if (inputShapes == GetInputShapes({}))
+    {
+        return nullptr;
+    }
+
+    auto it = std::find_if(m_ShapePlans.begin(), m_ShapePlans.end(),
+                           [&inputShapes](const auto& shapePlan) { return shapePlan.first == inputShapes; });
+    if (it != m_ShapePlans.end())
+    {
+        m_ShapePlans.splice(m_ShapePlans.begin(), m_ShapePlans, it);
+        return m_ShapePlans.front().second.get();
+    }
+
+    std::unique_ptr<LoadedNetwork> shapePlan = CreateShapePlan(inputShapes);
+    while (m_ShapePlans.size() >= m_ShapeCacheSize)
+    {
+        m_ShapePlans.pop_back();
+    }
+    m_ShapePlans.emplace_front(std::move(inputShapes), std::move(shapePlan));
+    return m_ShapePlans.front().second.get();
+}
+
+std::unique_ptr<LoadedNetwork> LoadedNetwork::CreateShapePlan(const std::vector<TensorShape>& inputShapes)
+{
+    ARMNN_SCOPED_PROFILING_EVENT(Compute::Undefined, "LoadedNetwork_CreateShapePlan");
+
+    OptimizedNetworkImpl& optimizedNetwork = *m_OptimizedNetwork->pOptimizedNetworkImpl;
+    auto graph = std::make_unique<Graph>(optimizedNetwork.GetGraph());
+
+    std::unordered_map<LayerBindingId, TensorShape> inputShapesById;
+    unsigned int inputIndex = 0;
+    for (const BindableLayer* inputLayer : optimizedNetwork.GetGraph().GetInputLayers())
+    {
+        inputShapesById.emplace(inputLayer->GetBindingId(), inputShapes[inputIndex++]);
+    }
+
+    // Sets the new input shapes, then infers every shape derived from them in topological order. Layers without
+    // inputs, such as constants, keep the shapes they have.
+    for (Layer* layer : graph->TopologicalSort())
+    {
+        layer->SetShapeInferenceMethod(ShapeInferenceMethod::InferAndValidate);
+        if (layer->GetType() == LayerType::Input)
+        {
+            OutputSlot& outputSlot = layer->GetOutputSlot(0);
+            TensorInfo info = outputSlot.GetTensorInfo();
+            info.SetShape(inputShapesById.at(PolymorphicDowncast<InputLayer*>(layer)->GetBindingId()));
+            outputSlot.SetTensorInfo(info);
+            continue;
+        }
+        if (layer->GetNumInputSlots() == 0)
+        {
+            continue;
+        }
+
+        for (unsigned int slotIndex = 0; slotIndex < layer->GetNumOutputSlots(); ++slotIndex)
+        {
+            TensorInfo info = layer->GetOutputSlot(slotIndex).GetTensorInfo();
+            info.SetShape(TensorShape(Dimensionality::NotSpecified));
+            layer->GetOutputSlot(slotIndex).SetTensorInfo(info);
+        }
+        layer->ValidateTensorShapesFromInputs();
+
+        for (const OutputSlot& outputSlot : layer->GetOutputSlots())
+        {
+            const TensorShape& shape = outputSlot.GetTensorInfo().GetShape();
+            if (shape.GetDimensionality() == Dimensionality::NotSpecified || !shape.AreAllDimensionsSpecified())
+            {
+                throw LayerValidationException(fmt::format("The output shapes of layer {} can not be inferred "
+                                                           "for the given input shapes.", layer->GetName()));
+            }
+        }
+    }
+
+    // Prepared like this network, except that it doesn't cache other shapes itself, the later option taking
+    // precedence.
+    ModelOptions planOptions = optimizedNetwork.GetModelOptions();
+    planOptions.push_back(BackendOptions("Global", {{"ShapeCacheSize", 0}}));
+
+    // The backends see the plan as part of this network. The copied graph shares the profiler of this one, so the
+    // plan is profiled along with it.
+    if (m_BackendContexts)
+    {
+        for (auto&& context : *m_BackendContexts)
+        {
+            context.second->BeforeLoadNetwork(m_NetworkId);
+        }
+    }
+
+    std::string errorMessage;
+    std::unique_ptr<LoadedNetwork> shapePlan =
+        MakeLoadedNetwork(std::unique_ptr<IOptimizedNetwork>(new IOptimizedNetwork(std::move(graph), planOptions)),
+                          errorMessage,
+                          m_NetworkProperties,
+                          m_ProfilingService);
+    if (!shapePlan)
+    {
+        throw InvalidArgumentException("EnqueueWorkload: the network can not be prepared for the given input "
+                                       "shapes. " + errorMessage);
+    }
+
+    if (m_BackendContexts)
+    {
+        for (auto&& context : *m_BackendContexts)
+        {
+            context.second->AfterLoadNetwork(m_NetworkId);
+        }
+    }
+    if (m_DebugCallback)
+    {
+        shapePlan->RegisterDebugCallback(m_DebugCallback);
+    }
+    return shapePlan;
 }
 
 bool LoadedNetwork::Execute(std::unique_ptr<TimelineUtilityMethods>& timelineUtils,
@@ -1773,6 +1944,13 @@ Status LoadedNetwork::Execute(const InputTensors& inputTensors,
         }
     }
 
+    // The working memory handles are created for the shapes the network was loaded with.
+    if (m_ShapeCacheSize > 0 && GetInputShapes(inputTensors) != GetInputShapes({}))
+    {
+        throw InvalidArgumentException("LoadedNetwork::Execute: inputs with shapes other than the ones the network "
+                                       "was loaded with can only be given to EnqueueWorkload.");
+    }
+
     WorkingMemHandle& workingMemHandle = dynamic_cast<WorkingMemHandle&>(iWorkingMemHandle);
     // Collect all the given LayerBindingIds and check them for duplicates and unknowns.
     std::vector<LayerBindingId>& bindingIds = workingMemHandle.GetBindingIdVector();
@@ -2230,6 +2408,17 @@ void LoadedNetwork::RegisterDebugCallback(const DebugCallbackFunction& func)
     {
         workloadPtr.get()->RegisterDebugCallback(func);
     }
+    for (auto& shapePlan : m_ShapePlans)
+    {
+        shapePlan.second->RegisterDebugCallback(func);
+    }
+    m_DebugCallback = func;
+}
+
+void LoadedNetwork::SetBackendContexts(NetworkId networkId, const BackendContextMap* backendContexts)
+{
+    m_NetworkId = networkId;
+    m_BackendContexts = backendContexts;
 }
 
 
@@ -1,5 +1,5 @@
 //
-// Copyright © 2017 Arm Ltd and Contributors. All rights reserved.
+// Copyright © 2017, 2024 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 #pragma once
@@ -27,7 +27,10 @@
 
 #include <mutex>
 #include <condition_variable>
+#include <list>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace cl
 {
@@ -90,6 +93,12 @@ public:
 
     void RegisterDebugCallback(const DebugCallbackFunction& func);
 
+    using BackendContextMap = std::unordered_map<BackendId, IBackendInternal::IBackendContextPtr>;
+
+    /// Sets the backend contexts told about the copies of this network prepared for other input shapes as they are
+    /// loaded, under the id of this network. They must outlive the network.
+    void SetBackendContexts(NetworkId networkId, const BackendContextMap* backendContexts);
+
     void SendNetworkStructure(arm::pipe::IProfilingService& profilingService);
 
     bool IsAsyncEnabled()
@@ -132,6 +141,17 @@ private:
 
     const IWorkloadFactory& GetWorkloadFactory(const Layer& layer) const;
 
+    /// Returns the shapes of the given inputs in the order of the graph input layers. Inputs which aren't given, such
+    /// as pre-imported ones, have the shape this network was loaded with.
+    std::vector<TensorShape> GetInputShapes(const InputTensors& inputTensors) const;
+
+    /// Returns the network prepared for the shapes of the given inputs, creating it if it isn't cached, or nullptr
+    /// when the shapes are the ones this network was loaded with.
+    LoadedNetwork* GetShapePlan(const InputTensors& inputTensors);
+
+    /// Prepares a copy of this network for the given input shapes, in the order of the graph input layers.
+    std::unique_ptr<LoadedNetwork> CreateShapePlan(const std::vector<TensorShape>& inputShapes);
+
     inline LayerBindingId ValidateImportedInputID(ImportedInputId id);
     inline LayerBindingId ValidateImportedOutputID(ImportedOutputId id);
 
@@ -228,6 +248,19 @@ private:
     std::vector<bool> m_IsInputImported;
     std::vector<bool> m_IsOutputImported;
 
+    /// The "ShapeCacheSize" of the "Global" model options, see IRuntime::EnqueueWorkload.
+    unsigned int m_ShapeCacheSize = 0;
+
+    /// Copies of this network prepared for other input shapes, most recently used first. Holds at most
+    /// m_ShapeCacheSize entries, which is expected to be small, so they are searched linearly.
+    std::list<std::pair<std::vector<TensorShape>, std::unique_ptr<LoadedNetwork>>> m_ShapePlans;
+
+    /// Registered on the copies prepared for other input shapes too, including the ones created later.
+    DebugCallbackFunction m_DebugCallback;
+
+    NetworkId m_NetworkId = 0;
+    const BackendContextMap* m_BackendContexts = nullptr;
+
 };
 
 }
@@ -1,5 +1,5 @@
 //
-// Copyright © 2017-2023 Arm Ltd and Contributors. All rights reserved.
+// Copyright © 2017-2024 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 
@@ -100,11 +100,15 @@ OptimizerOptionsOpaque& OptimizerOptionsOpaque::operator= (OptimizerOptionsOpaqu
     p_OptimizerOptionsImpl->m_ModelOptions = other.GetModelOptions();
     p_OptimizerOptionsImpl->m_ProfilingEnabled = other.GetProfilingEnabled();
     p_OptimizerOptionsImpl->m_DebugToFile = other.GetDebugToFileEnabled();
+    p_OptimizerOptionsImpl->m_DebugToNpyFile = other.GetDebugToNpyFileEnabled();
+    p_OptimizerOptionsImpl->m_DebugToFileLayers = other.GetDebugToFileLayers();
     p_OptimizerOptionsImpl->m_Debug = other.GetDebugEnabled();
     p_OptimizerOptionsImpl->m_ReduceFp32ToFp16 = other.GetReduceFp32ToFp16();
     p_OptimizerOptionsImpl->m_ExportEnabled = other.GetExportEnabled();
     p_OptimizerOptionsImpl->m_AllowExpandedDims = other.GetAllowExpandedDims();
     p_OptimizerOptionsImpl->m_ReduceFp32ToBf16 = other.GetReduceFp32ToBf16();
+    p_OptimizerOptionsImpl->m_FoldConstantLayers = other.GetFoldConstantLayersEnabled();
+    p_OptimizerOptionsImpl->m_MaxFoldedTensorBytes = other.GetMaxFoldedTensorBytes();
     return *this;
 }
 
@@ -133,6 +137,16 @@ void OptimizerOptionsOpaque::SetDebugToFileEnabled(bool DebugFileState)
     p_OptimizerOptionsImpl->m_DebugToFile = DebugFileState;
 }
 
+void OptimizerOptionsOpaque::SetDebugToNpyFileEnabled(bool DebugNpyFileState)
+{
+    p_OptimizerOptionsImpl->m_DebugToNpyFile = DebugNpyFileState;
+}
+
+void OptimizerOptionsOpaque::SetDebugToFileLayers(const std::vector<std::string>& DebugFileLayers)
+{
+    p_OptimizerOptionsImpl->m_DebugToFileLayers = DebugFileLayers;
+}
+
 void OptimizerOptionsOpaque::SetReduceFp32ToFp16(bool ReduceFp32ToFp16State)
 {
     p_OptimizerOptionsImpl->m_ReduceFp32ToFp16 = ReduceFp32ToFp16State;
@@ -148,6 +162,16 @@ void OptimizerOptionsOpaque::SetAllowExpandedDims(bool ExpandedDimsAllowed)
     p_OptimizerOptionsImpl->m_AllowExpandedDims = ExpandedDimsAllowed;
 }
 
+void OptimizerOptionsOpaque::SetFoldConstantLayersEnabled(bool FoldConstantLayersState)
+{
+    p_OptimizerOptionsImpl->m_FoldConstantLayers = FoldConstantLayersState;
+}
+
+void OptimizerOptionsOpaque::SetMaxFoldedTensorBytes(size_t MaxFoldedTensorBytes)
+{
+    p_OptimizerOptionsImpl->m_MaxFoldedTensorBytes = MaxFoldedTensorBytes;
+}
+
 void OptimizerOptionsOpaque::AddModelOption(armnn::BackendOptions NewModelOption)
 {
     p_OptimizerOptionsImpl->m_ModelOptions.push_back(NewModelOption);
@@ -188,11 +212,31 @@ bool OptimizerOptionsOpaque::GetDebugToFileEnabled() const
     return p_OptimizerOptionsImpl->m_DebugToFile;
 }
 
+bool OptimizerOptionsOpaque::GetDebugToNpyFileEnabled() const
+{
+    return p_OptimizerOptionsImpl->m_DebugToNpyFile;
+}
+
+std::vector<std::string> OptimizerOptionsOpaque::GetDebugToFileLayers() const
+{
+    return p_OptimizerOptionsImpl->m_DebugToFileLayers;
+}
+
 bool OptimizerOptionsOpaque::GetAllowExpandedDims() const
 {
     return p_OptimizerOptionsImpl->m_AllowExpandedDims;
 }
 
+bool OptimizerOptionsOpaque::GetFoldConstantLayersEnabled() const
+{
+    return p_OptimizerOptionsImpl->m_FoldConstantLayers;
+}
+
+size_t OptimizerOptionsOpaque::GetMaxFoldedTensorBytes() const
+{
+    return p_OptimizerOptionsImpl->m_MaxFoldedTensorBytes;
+}
+
 armnn::ModelOptions OptimizerOptionsOpaque::GetModelOptions() const
 {
     return p_OptimizerOptionsImpl->m_ModelOptions;
@@ -211,6 +255,7 @@ const std::string OptimizerOptionsOpaque::ToString() const
     stream << "\tReduceFp32ToBf16: " << p_OptimizerOptionsImpl->m_ReduceFp32ToBf16 << "\n";
     stream << "\tDebug: " << p_OptimizerOptionsImpl->m_Debug << "\n";
     stream << "\tDebug to file: " << p_OptimizerOptionsImpl->m_DebugToFile << "\n";
+    stream << "\tDebug to .npy file: " << p_OptimizerOptionsImpl->m_DebugToNpyFile << "\n";
     stream << "\tShapeInferenceMethod: " <<
            (p_OptimizerOptionsImpl->m_shapeInferenceMethod == ShapeInferenceMethod::ValidateOnly ?
            "ValidateOnly" : "InferAndValidate") << "\n";
@@ -218,6 +263,8 @@ const std::string OptimizerOptionsOpaque::ToString() const
     stream << "\tExportEnabled: " << p_OptimizerOptionsImpl->m_ExportEnabled << "\n";
     stream << "\tProfilingEnabled: " << p_OptimizerOptionsImpl->m_ProfilingEnabled << "\n";
     stream << "\tAllowExpandedDims: " << p_OptimizerOptionsImpl->m_AllowExpandedDims << "\n";
+    stream << "\tFoldConstantLayers: " << p_OptimizerOptionsImpl->m_FoldConstantLayers << "\n";
+    stream << "\tMaxFoldedTensorBytes: " << p_OptimizerOptionsImpl->m_MaxFoldedTensorBytes << "\n";
 
     stream << "\tModelOptions: \n";
     for (auto optionsGroup : p_OptimizerOptionsImpl->m_ModelOptions)
@@ -663,6 +710,26 @@ IConnectableLayer* INetwork::AddBroadcastToLayer(const BroadcastToDescriptor& de
     return pNetworkImpl->AddBroadcastToLayer(descriptor, name);
 }
 
+IConnectableLayer* INetwork::AddMemCopyLayer(const char* name)
+{
+    return pNetworkImpl->AddMemCopyLayer(name);
+}
+
+IConnectableLayer* INetwork::AddMemImportLayer(const char* name)
+{
+    return pNetworkImpl->AddMemImportLayer(name);
+}
+
+IConnectableLayer* INetwork::AddConvertFp16ToFp32Layer(const char* name)
+{
+    return pNetworkImpl->AddConvertFp16ToFp32Layer(name);
+}
+
+IConnectableLayer* INetwork::AddConvertFp32ToFp16Layer(const char* name)
+{
+    return pNetworkImpl->AddConvertFp32ToFp16Layer(name);
+}
+
 void INetwork::ExecuteStrategy(IStrategy& strategy) const
 {
     return pNetworkImpl->ExecuteStrategy(strategy);
@@ -732,6 +799,45 @@ size_t IOptimizedNetwork::GetNumOutputs() const
     return pOptimizedNetworkImpl->GetNumOutputs();
 }
 
+namespace
+{
+
+/// Index of the connection from an output slot to an input slot, in the order of the connections of the output slot.
+unsigned int GetConnectionIndex(const OutputSlot& outputSlot, const InputSlot& inputSlot)
+{
+    const std::vector<InputSlot*>& connections = outputSlot.GetConnections();
+    auto it = std::find(connections.begin(), connections.end(), &inputSlot);
+    if (it == connections.end())
+    {
+        throw InvalidArgumentException("Input slot is not connected to the output slot");
+    }
+    return static_cast<unsigned int>(std::distance(connections.begin(), it));
+}
+
+} // anonymous namespace
+
+OptimizedLayerPlacement IOptimizedNetwork::GetLayerPlacement(const IConnectableLayer& layer) const
+{
+    const Layer& graphLayer = *PolymorphicDowncast<const Layer*>(&layer);
+
+    OptimizedLayerPlacement placement;
+    placement.m_BackendId = graphLayer.GetBackendId();
+    for (const OutputSlot& outputSlot : graphLayer.GetOutputSlots())
+    {
+        placement.m_OutputTensorHandleFactoryIds.push_back(outputSlot.GetTensorHandleFactoryId());
+    }
+    for (const InputSlot& inputSlot : graphLayer.GetInputSlots())
+    {
+        const OutputSlot* connection = inputSlot.GetConnectedOutputSlot();
+        placement.m_InputEdgeStrategies.push_back(
+            connection ? connection->GetEdgeStrategyForConnection(GetConnectionIndex(*connection, inputSlot))
+                       : EdgeStrategy::Undefined);
+    }
+    // Backends only fuse activations into the additional information of a layer.
+    placement.m_FusedActivation = graphLayer.GetAdditionalInformation<ActivationDescriptor>();
+    return placement;
+}
+
 Status OptimizedNetworkImpl::PrintGraph()
 {
     m_Graph->Print();
@@ -870,7 +976,8 @@ OptimizationResult AttemptBackendAssignment(BackendSettings& backendSettings,
     // To run FP16 operations on CpuAcc we need at least v8.2 architecture. If the available architecture 
     // is older than v8.2, we can check if the operator is supported by changing operator inputs & outputs
     // to be FP32 and inserting convert layers around the FP32 operator.
-    bool isLayerSupported = IWorkloadFactory::IsLayerSupported(*layer, EmptyOptional(), currentReasonIfUnsupported);
+    LayerSupportCache& layerSupportCache = *backendSettings.m_LayerSupportCache;
+    bool isLayerSupported = layerSupportCache.IsLayerSupported(*layer, EmptyOptional(), currentReasonIfUnsupported);
     reasonIfUnsupported += currentReasonIfUnsupported;
     // This string matches the error message that is produced by acl when attempting to run FP16 kernels on
     // a cpu or build that does not have fp16 support. We use this to check if we should add
@@ -880,7 +987,7 @@ OptimizationResult AttemptBackendAssignment(BackendSettings& backendSettings,
     {
         if (dataTypeIn == DataType::Float16 || dataTypeOut == DataType::Float16)
         {
-            if (IWorkloadFactory::IsLayerSupported(*layer, DataType::Float32, reasonIfUnsupported)
+            if (layerSupportCache.IsLayerSupported(*layer, DataType::Float32, reasonIfUnsupported)
                 && layer->GetType() != LayerType::ConvertFp32ToFp16
                 && layer->GetType() != LayerType::ConvertFp16ToFp32)
             {
@@ -950,7 +1057,7 @@ OptimizationResult AttemptBackendAssignment(BackendSettings& backendSettings,
 
                         // Try preferred backend first
                         layer->SetBackendId(preferredBackend);
-                        if (IWorkloadFactory::IsLayerSupported(*layer,
+                        if (layerSupportCache.IsLayerSupported(*layer,
                                                                EmptyOptional(),
                                                                reasonIfUnsupported))
                         {
@@ -967,7 +1074,7 @@ OptimizationResult AttemptBackendAssignment(BackendSettings& backendSettings,
                                 }
 
                                 layer->SetBackendId(backend);
-                                if (IWorkloadFactory::IsLayerSupported(*layer,
+                                if (layerSupportCache.IsLayerSupported(*layer,
                                                                        EmptyOptional(),
                                                                        reasonIfUnsupported))
                                 {
@@ -1982,6 +2089,13 @@ IOptimizedNetworkPtr Optimize(const Graph& inGraph,
     // ConvertConstDequantisationLayersToConstLayers must happen before FoldPadIntoConvolution2d
     Optimizer::Pass(optGraph, MakeOptimizations(FusePermuteIntoConstLayer(),
                                                 ConvertConstDequantisationLayersToConstLayers()));
+    // Evaluate any remaining subgraphs whose inputs are all constant once, instead of on every inference.
+    if (options.GetFoldConstantLayersEnabled())
+    {
+        Optimizer::Pass(optGraph, MakeOptimizations(FoldConstantLayers(options.GetMaxFoldedTensorBytes())));
+    }
+    // Merge layers computing the same value, e.g. duplicated Shape/Gather/Cast branches in converted models.
+    Optimizer::Pass(optGraph, MakeOptimizations(CommonSubexpressionElimination()));
     // Perform optimisation passes
     Optimizer::Pass(optGraph, MakeOptimizations(SquashEqualPermuteSiblings(),
                                                 SquashEqualTransposeSiblings(),
@@ -2083,7 +2197,8 @@ IOptimizedNetworkPtr Optimize(const Graph& inGraph,
             auto result = armnnUtils::Filesystem::CreateDirectory("/ArmNNIntermediateLayerOutputs");
             ARMNN_LOG(info) << "Intermediate tensors will be written to: " << result;
 #endif
-            Optimizer::Pass(optGraph, MakeOptimizations(InsertDebugToFileLayer()));
+            Optimizer::Pass(optGraph, MakeOptimizations(InsertDebugToFileLayer(options.GetDebugToNpyFileEnabled(),
+                                                                               options.GetDebugToFileLayers())));
         }
         catch (const armnn::RuntimeException& e)
         {
@@ -2142,6 +2257,52 @@ IOptimizedNetworkPtr Optimize(const INetwork& inNetwork,
                     messages);
 }
 
+IOptimizedNetworkPtr CreateOptimizedNetwork(const INetwork& network,
+                                            const OptimizedLayerPlacements& placements,
+                                            const ModelOptions& modelOptions)
+{
+    // Copying the graph keeps the guids of the layers, which the placements are looked up by.
+    auto graph = std::make_unique<Graph>(network.pNetworkImpl->GetGraph());
+
+    for (Layer* layer : *graph)
+    {
+        auto it = placements.find(layer->GetGuid());
+        if (it == placements.end())
+        {
+            throw InvalidArgumentException(fmt::format("No placement was given for layer {}", layer->GetName()));
+        }
+        const OptimizedLayerPlacement& placement = it->second;
+        if (placement.m_OutputTensorHandleFactoryIds.size() != layer->GetNumOutputSlots() ||
+            placement.m_InputEdgeStrategies.size() != layer->GetNumInputSlots())
+        {
+            throw InvalidArgumentException(
+                fmt::format("The placement given for layer {} doesn't match its slots", layer->GetName()));
+        }
+
+        layer->SetBackendId(placement.m_BackendId);
+        for (unsigned int i = 0; i < layer->GetNumOutputSlots(); ++i)
+        {
+            layer->GetOutputSlot(i).SetTensorHandleFactory(placement.m_OutputTensorHandleFactoryIds[i]);
+        }
+        for (unsigned int i = 0; i < layer->GetNumInputSlots(); ++i)
+        {
+            InputSlot& inputSlot = layer->GetInputSlot(i);
+            OutputSlot* connection = inputSlot.GetConnectedOutputSlot();
+            if (connection)
+            {
+                connection->SetEdgeStrategy(GetConnectionIndex(*connection, inputSlot),
+                                            placement.m_InputEdgeStrategies[i]);
+            }
+        }
+        if (placement.m_FusedActivation)
+        {
+            layer->SetAdditionalInfoForObject(std::make_shared<ActivationDescriptor>(*placement.m_FusedActivation));
+        }
+    }
+
+    return IOptimizedNetworkPtr(new IOptimizedNetwork(std::move(graph), modelOptions), &IOptimizedNetwork::Destroy);
+}
+
 bool NetworkImpl::GetShapeInferenceMethod()
 {
     bool shapeInferenceMethod = false;
@@ -2264,6 +2425,16 @@ IConnectableLayer* NetworkImpl::AddConvertFp32ToFp16Layer(const char* name)
     return m_Graph->AddLayer<ConvertFp32ToFp16Layer>(name);
 }
 
+IConnectableLayer* NetworkImpl::AddMemCopyLayer(const char* name)
+{
+    return m_Graph->AddLayer<MemCopyLayer>(name);
+}
+
+IConnectableLayer* NetworkImpl::AddMemImportLayer(const char* name)
+{
+    return m_Graph->AddLayer<MemImportLayer>(name);
+}
+
 IConnectableLayer* NetworkImpl::AddConvolution3dLayer(const Convolution3dDescriptor& convolution3dDescriptor,
                                                       const char* name)
 {
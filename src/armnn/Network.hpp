@@ -1,5 +1,5 @@
 //
-// Copyright © 2017-2023 Arm Ltd and Contributors. All rights reserved.
+// Copyright © 2017-2024 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 #pragma once
@@ -245,6 +245,10 @@ public:
 
     IConnectableLayer* AddConvertFp32ToFp16Layer(const char* name = nullptr);
 
+    IConnectableLayer* AddMemCopyLayer(const char* name = nullptr);
+
+    IConnectableLayer* AddMemImportLayer(const char* name = nullptr);
+
     void ExecuteStrategy(IStrategy& strategy) const;
 
 private:
@@ -370,6 +374,12 @@ struct OptimizerOptionsOpaqueImpl
     /// Pass debug data to separate output files for easier troubleshooting
     bool m_DebugToFile = false;
 
+    /// Write the debug output files as binary NumPy .npy files rather than text
+    bool m_DebugToNpyFile = false;
+
+    /// Names or GUIDs of the layers whose outputs are written to file. Empty means all layers.
+    std::vector<std::string> m_DebugToFileLayers;
+
     /// @Note This feature has been replaced by enabling Fast Math in compute library backend options.
     /// This is currently a placeholder option
     bool m_ReduceFp32ToBf16 = false;
@@ -391,6 +401,12 @@ struct OptimizerOptionsOpaqueImpl
 
     /// When calculating tensor sizes, dimensions of size == 1 will be ignored
     bool m_AllowExpandedDims = false;
+
+    /// Evaluate the layers whose inputs are all constant at optimize time
+    bool m_FoldConstantLayers = true;
+
+    /// Largest output of a folded layer when folding it grows the model
+    size_t m_MaxFoldedTensorBytes = 1024 * 1024;
 };
 
 } // namespace armnn
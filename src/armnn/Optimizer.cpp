@@ -23,7 +23,8 @@ void Optimizer::Pass(Graph& graph, const Optimizations& optimizations)
     bool graphNeedsSorting = false;
     auto it = graph.TopologicalSort().end();
 
-    // Calls TopologicalSort() for every iteration to re-order the list in case layers were added/removed.
+    // Calls TopologicalSort() for every iteration to move any layers added by the optimizations into place.
+    // This is cheap when no layers were added, and only touches the added layers otherwise.
     while (it != graph.TopologicalSort().begin())
     {
         --it;
@@ -0,0 +1,201 @@
+//
+// Copyright © 2024 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "PerfEventCounters.hpp"
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <tuple>
+
+namespace armnn
+{
+
+const std::string PerfEventCounters::CYCLES       ("Cycles");
+const std::string PerfEventCounters::INSTRUCTIONS ("Instructions");
+const std::string PerfEventCounters::CACHE_MISSES ("Cache misses");
+const std::string PerfEventCounters::BRANCH_MISSES("Branch misses");
+const std::string PerfEventCounters::TASK_CLOCK   ("Task clock");
+const std::string PerfEventCounters::PAGE_FAULTS  ("Page faults");
+
+namespace
+{
+
+// The counters of a thread, opened as one group so that they are all read with a single system call.
+// Values are read as the time the group was enabled and running for, followed by the count of each counter.
+class PerfEventGroup
+{
+public:
+    PerfEventGroup()
+    {
+#if defined(__linux__)
+        struct Config
+        {
+            const std::string* m_Name;
+            uint32_t m_Type;
+            uint64_t m_Config;
+        };
+        const std::array<Config, PerfEventCounters::MaxNumCounters> configs =
+        {{
+            { &PerfEventCounters::CYCLES,        PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+            { &PerfEventCounters::INSTRUCTIONS,  PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+            { &PerfEventCounters::CACHE_MISSES,  PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES },
+            { &PerfEventCounters::BRANCH_MISSES, PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES },
+            { &PerfEventCounters::TASK_CLOCK,    PERF_TYPE_SOFTWARE, PERF_COUNT_SW_TASK_CLOCK },
+            { &PerfEventCounters::PAGE_FAULTS,   PERF_TYPE_SOFTWARE, PERF_COUNT_SW_PAGE_FAULTS },
+        }};
+
+        for (const Config& config : configs)
+        {
+            perf_event_attr attr;
+            std::memset(&attr, 0, sizeof(attr));
+            attr.size        = sizeof(attr);
+            attr.type        = config.m_Type;
+            attr.config      = config.m_Config;
+            attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+            // The leader is enabled once the whole group is opened
+            attr.disabled    = m_LeaderFd < 0;
+            // Counting user space only needs no privileges with the default perf_event_paranoid setting
+            attr.exclude_kernel = 1;
+            attr.exclude_hv     = 1;
+
+            // Virtual machines commonly have no hardware counters at all, these are just left out.
+            const int fd = static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, m_LeaderFd,
+                                                    PERF_FLAG_FD_CLOEXEC));
+            if (fd < 0)
+            {
+                continue;
+            }
+            if (m_LeaderFd < 0)
+            {
+                m_LeaderFd = fd;
+            }
+            m_Fds.push_back(fd);
+            m_Names[m_NumCounters++] = config.m_Name;
+        }
+
+        if (m_LeaderFd >= 0)
+        {
+            ioctl(m_LeaderFd, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+        }
+#endif
+    }
+
+    ~PerfEventGroup()
+    {
+#if defined(__linux__)
+        for (int fd : m_Fds)
+        {
+            close(fd);
+        }
+#endif
+    }
+
+    PerfEventGroup(const PerfEventGroup&) = delete;
+    PerfEventGroup& operator=(const PerfEventGroup&) = delete;
+
+    const PerfEventCounters::Names& GetNames() const
+    {
+        return m_Names;
+    }
+
+    unsigned int GetNumCounters() const
+    {
+        return m_NumCounters;
+    }
+
+    // Reads zeros rather than failing, so that every event has the same measurements.
+    void Read(PerfEventCounters::Values& outValues) const
+    {
+        outValues.fill(0);
+#if defined(__linux__)
+        if (m_LeaderFd < 0)
+        {
+            return;
+        }
+        // The number of counters comes first
+        std::array<uint64_t, 1 + std::tuple_size<PerfEventCounters::Values>::value> data;
+        const size_t numValues = 3 + m_NumCounters;
+        if (read(m_LeaderFd, data.data(), sizeof(data)) == static_cast<ssize_t>(numValues * sizeof(uint64_t)))
+        {
+            std::copy(data.begin() + 1, data.begin() + static_cast<std::ptrdiff_t>(numValues), outValues.begin());
+        }
+#endif
+    }
+
+private:
+    int m_LeaderFd = -1;
+    std::vector<int> m_Fds;
+    PerfEventCounters::Names m_Names{};
+    unsigned int m_NumCounters = 0;
+};
+
+// Counters count the thread which opened them, so each thread gets its own group.
+PerfEventGroup& GetThreadPerfEventGroup()
+{
+    thread_local PerfEventGroup group;
+    return group;
+}
+
+} // anonymous namespace
+
+const char* PerfEventCounters::GetName() const
+{
+    return "PerfEventCounters";
+}
+
+bool PerfEventCounters::IsSupported()
+{
+    return GetThreadPerfEventGroup().GetNumCounters() > 0;
+}
+
+void PerfEventCounters::Start()
+{
+    const PerfEventGroup& group = GetThreadPerfEventGroup();
+    m_Names       = group.GetNames();
+    m_NumCounters = group.GetNumCounters();
+    group.Read(m_Start);
+}
+
+void PerfEventCounters::Stop()
+{
+    GetThreadPerfEventGroup().Read(m_Stop);
+}
+
+std::vector<Measurement> PerfEventCounters::GetMeasurements() const
+{
+    std::vector<Measurement> measurements;
+    // When there are more counters than the hardware can count at once, the kernel takes turns between groups.
+    // The counts are scaled up to make up for the time the group wasn't counting.
+    const double enabled = static_cast<double>(m_Stop[0] - m_Start[0]);
+    const double running = static_cast<double>(m_Stop[1] - m_Start[1]);
+    const double scale   = running > 0.0 ? enabled / running : 0.0;
+
+    measurements.reserve(m_NumCounters);
+    for (unsigned int i = 0; i < m_NumCounters; ++i)
+    {
+        const double count = static_cast<double>(m_Stop[2 + i] - m_Start[2 + i]) * scale;
+        if (m_Names[i] == &TASK_CLOCK)
+        {
+            // Counted in nanoseconds
+            measurements.emplace_back(*m_Names[i], count / 1000.0, Measurement::Unit::TIME_US);
+        }
+        else
+        {
+            measurements.emplace_back(*m_Names[i], count, Measurement::Unit::COUNT);
+        }
+    }
+    return measurements;
+}
+
+} //namespace armnn
@@ -0,0 +1,66 @@
+//
+// Copyright © 2024 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include "Instrument.hpp"
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace armnn
+{
+
+// Implementation of an instrument counting the hardware and software events Linux perf reports for the calling
+// thread, such as the cycles and instructions spent on an event and the cache misses it caused.
+// The counters are opened once per thread and left running, so starting and stopping the instrument only reads them.
+// Counters the kernel or the CPU don't provide are left out of the measurements, and there are none on other
+// platforms, see IsSupported().
+class PerfEventCounters : public Instrument
+{
+public:
+    PerfEventCounters() = default;
+    ~PerfEventCounters() = default;
+
+    // Read the counters at the start of the event
+    void Start() override;
+
+    // Read the counters at the end of the event
+    void Stop() override;
+
+    // Get the name of the instrument
+    const char* GetName() const override;
+
+    // Get the number of events counted between Start() and Stop()
+    std::vector<Measurement> GetMeasurements() const override;
+
+    // Whether at least one counter could be opened for the calling thread
+    static bool IsSupported();
+
+    static const std::string CYCLES;
+    static const std::string INSTRUCTIONS;
+    static const std::string CACHE_MISSES;
+    static const std::string BRANCH_MISSES;
+    static const std::string TASK_CLOCK;
+    static const std::string PAGE_FAULTS;
+
+    static constexpr unsigned int MaxNumCounters = 6;
+
+    // The time the counters were enabled and running for, followed by their counts
+    using Values = std::array<uint64_t, 2 + MaxNumCounters>;
+
+    // The names of the counters opened for the calling thread, in the order of their counts
+    using Names = std::array<const std::string*, MaxNumCounters>;
+
+private:
+    Names m_Names{};
+    unsigned int m_NumCounters = 0;
+    Values m_Start{};
+    Values m_Stop{};
+};
+
+} //namespace armnn
@@ -1,5 +1,5 @@
 //
-// Copyright © 2017 Arm Ltd. All rights reserved.
+// Copyright © 2017, 2024 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 #include "Profiling.hpp"
@@ -9,6 +9,10 @@
 
 #include "JsonPrinter.hpp"
 
+#include <ChromeTraceWriter.hpp>
+
+#include <common/include/Processes.hpp>
+
 #if ARMNN_STREAMLINE_ENABLED
 #include <streamline_annotate.h>
 #endif
@@ -18,6 +22,7 @@
 #include <iostream>
 #include <fstream>
 #include <map>
+#include <sstream>
 #include <stack>
 
 namespace armnn
@@ -79,6 +84,36 @@ std::vector<Measurement> FindKernelMeasurements(const Event* event)
     return measurements;
 }
 
+bool HasPerfEventCounts(const Event* event)
+{
+    ARMNN_ASSERT(event != nullptr);
+
+    for (const auto& instrument : event->GetInstruments())
+    {
+        if (dynamic_cast<const PerfEventCounters*>(instrument.get()) != nullptr)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Writes the given measurement of the event, or a dash if the event doesn't have it.
+void WriteMeasurementOrDash(std::ostream& outStream, const std::string& name, const Event* event, int precision = 0)
+{
+    Measurement measurement = FindMeasurement(name, event);
+    if (measurement.m_Name.empty())
+    {
+        outStream << std::setw(20) << "-";
+    }
+    else
+    {
+        std::streamsize oldPrecision = outStream.precision(precision);
+        outStream << std::setw(20) << measurement.m_Value;
+        outStream.precision(oldPrecision);
+    }
+}
+
 std::map<std::string, ProfilerImpl::ProfilingEventStats> ProfilerImpl::CalculateProfilingEventStats() const
 {
     std::map<std::string, ProfilingEventStats> nameToStatsMap;
@@ -143,6 +178,51 @@ void ProfilerImpl::AnalyzeEventSequenceAndWriteResults(ItertType first, ItertTyp
         outStream.precision(oldPrecision);
     }
 
+    // Outputs the perf event counts of the events, if they were recorded.
+    // Few instructions per cycle along with many cache misses point at an event bound by memory accesses.
+    // The counts aren't part of the ProfilingDetails, which are recorded when the workloads are created, before any
+    // of them has run; the JSON output has them as measurements of the events instead.
+    if (std::any_of(first, last, [](const auto& event) { return HasPerfEventCounts(GetEventPtr(event)); }))
+    {
+        std::streamsize oldPrecision = outStream.precision();
+        outStream.precision(0);
+        std::ios_base::fmtflags oldFlags = outStream.flags();
+        outStream.setf(std::ios::fixed);
+        outStream << "Event Counters - Name | Cycles | Instructions | Instructions per cycle | Cache misses | "
+                     "Branch misses | Task clock (us) | Page faults | Device" << std::endl;
+        for (auto event = first; event != last; ++event)
+        {
+            const Event* eventPtr = GetEventPtr((*event));
+            if (!HasPerfEventCounts(eventPtr))
+            {
+                continue;
+            }
+            outStream << std::setw(50) << eventPtr->GetName() << " ";
+            WriteMeasurementOrDash(outStream, PerfEventCounters::CYCLES, eventPtr);
+            WriteMeasurementOrDash(outStream, PerfEventCounters::INSTRUCTIONS, eventPtr);
+
+            const double cycles = FindMeasurement(PerfEventCounters::CYCLES, eventPtr).m_Value;
+            const double instructions = FindMeasurement(PerfEventCounters::INSTRUCTIONS, eventPtr).m_Value;
+            if (cycles > 0.0)
+            {
+                outStream << std::setprecision(2) << std::setw(20) << instructions / cycles << std::setprecision(0);
+            }
+            else
+            {
+                outStream << std::setw(20) << "-";
+            }
+
+            WriteMeasurementOrDash(outStream, PerfEventCounters::CACHE_MISSES, eventPtr);
+            WriteMeasurementOrDash(outStream, PerfEventCounters::BRANCH_MISSES, eventPtr);
+            WriteMeasurementOrDash(outStream, PerfEventCounters::TASK_CLOCK, eventPtr, 3);
+            WriteMeasurementOrDash(outStream, PerfEventCounters::PAGE_FAULTS, eventPtr);
+            outStream << std::setw(20) << eventPtr->GetBackendId().Get() << std::endl;
+        }
+        outStream << std::endl;
+        outStream.flags(oldFlags);
+        outStream.precision(oldPrecision);
+    }
+
     // Aggregates results per event name.
     std::map<std::string, ProfilingEventStats> nameToStatsMap = CalculateProfilingEventStats();
 
@@ -163,7 +243,8 @@ void ProfilerImpl::AnalyzeEventSequenceAndWriteResults(ItertType first, ItertTyp
 
 ProfilerImpl::ProfilerImpl()
     : m_ProfilingEnabled(false),
-      m_DetailsToStdOutMethod(ProfilingDetailsMethod::Undefined)
+      m_DetailsToStdOutMethod(ProfilingDetailsMethod::Undefined),
+      m_HardwareCountersEnabled(false)
 {
     m_EventSequence.reserve(g_ProfilingEventCountHint);
 
@@ -202,27 +283,55 @@ void ProfilerImpl::EnableNetworkDetailsToStdOut(ProfilingDetailsMethod details)
     m_DetailsToStdOutMethod = details;
 }
 
+void ProfilerImpl::EnableHardwareCounters(bool enableHardwareCounters)
+{
+    m_HardwareCountersEnabled = enableHardwareCounters;
+}
+
+int CalcLevel(const Event* eventPtr)
+{
+    int level = 0;
+    while (eventPtr != nullptr)
+    {
+        eventPtr = eventPtr->GetParentEvent();
+        level++;
+    }
+    return level;
+}
+
 Event* ProfilerImpl::BeginEvent(armnn::IProfiler* profiler,
                                 const BackendId& backendId,
                                 const std::string& label,
                                 std::vector<InstrumentPtr>&& instruments,
                                 const Optional<arm::pipe::ProfilingGuid>& guid)
 {
-    Event* parent = m_Parents.empty() ? nullptr : m_Parents.top();
-    m_EventSequence.push_back(std::make_unique<Event>(label,
-                                                      profiler,
-                                                      parent,
-                                                      backendId,
-                                                      std::move(instruments),
-                                                      guid));
-    Event* event = m_EventSequence.back().get();
+    if (m_HardwareCountersEnabled && PerfEventCounters::IsSupported())
+    {
+        instruments.emplace_back(std::make_unique<PerfEventCounters>());
+    }
+
+    Event* event = nullptr;
+    {
+#if !defined(ARMNN_DISABLE_THREADS)
+        std::lock_guard<std::mutex> lock(m_EventsMutex);
+#endif
+        std::stack<Event*>& parents = m_Parents[GetEventThreadId()];
+        Event* parent = parents.empty() ? nullptr : parents.top();
+        m_EventSequence.push_back(std::make_unique<Event>(label,
+                                                          profiler,
+                                                          parent,
+                                                          backendId,
+                                                          std::move(instruments),
+                                                          guid));
+        event = m_EventSequence.back().get();
+        parents.push(event);
+    }
     event->Start();
 
 #if ARMNN_STREAMLINE_ENABLED
-    ANNOTATE_CHANNEL_COLOR(uint32_t(m_Parents.size()), GetEventColor(backendId), label.c_str());
+    ANNOTATE_CHANNEL_COLOR(uint32_t(CalcLevel(event) - 1), GetEventColor(backendId), label.c_str());
 #endif
 
-    m_Parents.push(event);
     return event;
 }
 
@@ -230,30 +339,25 @@ void ProfilerImpl::EndEvent(Event* event)
 {
     event->Stop();
 
-    ARMNN_ASSERT(!m_Parents.empty());
-    ARMNN_ASSERT(event == m_Parents.top());
-    m_Parents.pop();
-
-    Event* parent = m_Parents.empty() ? nullptr : m_Parents.top();
-    IgnoreUnused(parent);
-    ARMNN_ASSERT(event->GetParentEvent() == parent);
+    {
+#if !defined(ARMNN_DISABLE_THREADS)
+        std::lock_guard<std::mutex> lock(m_EventsMutex);
+#endif
+        std::stack<Event*>& parents = m_Parents[event->GetThreadId()];
+        ARMNN_ASSERT(!parents.empty());
+        ARMNN_ASSERT(event == parents.top());
+        parents.pop();
+
+        Event* parent = parents.empty() ? nullptr : parents.top();
+        IgnoreUnused(parent);
+        ARMNN_ASSERT(event->GetParentEvent() == parent);
+    }
 
 #if ARMNN_STREAMLINE_ENABLED
-    ANNOTATE_CHANNEL_END(uint32_t(m_Parents.size()));
+    ANNOTATE_CHANNEL_END(uint32_t(CalcLevel(event) - 1));
 #endif
 }
 
-int CalcLevel(const Event* eventPtr)
-{
-    int level = 0;
-    while (eventPtr != nullptr)
-    {
-        eventPtr = eventPtr->GetParentEvent();
-        level++;
-    }
-    return level;
-}
-
 void ProfilerImpl::PopulateParent(std::vector<const Event*>& outEvents, int& outBaseLevel, std::string parentName) const
 {
     outEvents.reserve(m_EventSequence.size());
@@ -478,10 +582,61 @@ void ProfilerImpl::Print(std::ostream& outStream) const
     }
 }
 
+void ProfilerImpl::PrintChromeTrace(std::ostream& outStream) const
+{
+    const int processId = arm::pipe::GetCurrentProcessId();
+    armnnUtils::ChromeTraceWriter writer(outStream);
+    writer.WriteProcessName(processId, "Arm NN");
+
+    uint64_t inferenceId = 0;
+    for (const auto& event : m_EventSequence)
+    {
+        const Measurement start    = FindMeasurement(WallClockTimer::WALL_CLOCK_TIME_START, event.get());
+        const Measurement duration = FindMeasurement(WallClockTimer::WALL_CLOCK_TIME, event.get());
+        if (start.m_Name.empty() || duration.m_Name.empty())
+        {
+            // Events can only be laid out on the timeline if they were timed
+            continue;
+        }
+
+        const std::string backendId = event->GetBackendId().Get();
+        armnnUtils::ChromeTraceWriter::Args args;
+        args.emplace_back("backend", backendId);
+        if (event->GetProfilingGuid().has_value())
+        {
+            args.emplace_back("guid", std::to_string(static_cast<uint64_t>(event->GetProfilingGuid().value())));
+        }
+        for (const Measurement& measurement : event->GetMeasurements())
+        {
+            if (measurement.m_Name.rfind(WallClockTimer::WALL_CLOCK_TIME, 0) != 0)
+            {
+                std::stringstream value;
+                value << std::fixed << std::setprecision(measurement.m_Unit == Measurement::Unit::COUNT ? 0 : 3)
+                      << measurement.m_Value << " " << Measurement::ToString(measurement.m_Unit);
+                args.emplace_back(measurement.m_Name, value.str());
+            }
+        }
+
+        writer.WriteCompleteEvent(event->GetName(), backendId, processId, event->GetThreadId(),
+                                  start.m_Value, duration.m_Value, args);
+
+        // Inferences are also drawn as spans of their own, as several may run at once on different threads
+        if (event->GetName() == "EnqueueWorkload" || event->GetName() == "Execute")
+        {
+            ++inferenceId;
+            writer.WriteAsyncBeginEvent("Inference", "inference", inferenceId, processId, event->GetThreadId(),
+                                        start.m_Value, { { "event", event->GetName() } });
+            writer.WriteAsyncEndEvent("Inference", "inference", inferenceId, processId, event->GetThreadId(),
+                                      start.m_Value + duration.m_Value);
+        }
+    }
+}
+
 void ProfilerImpl::AnalyzeEventsAndWriteResults(std::ostream& outStream) const
 {
-    // Stack should be empty now.
-    const bool saneMarkerSequence = m_Parents.empty();
+    // Stacks should be empty now.
+    const bool saneMarkerSequence = std::all_of(m_Parents.cbegin(), m_Parents.cend(),
+                                                [](const auto& parents) { return parents.second.empty(); });
 
     // Abort if the sequence of markers was found to have incorrect information:
     // The stats cannot be trusted.
@@ -617,6 +772,11 @@ void IProfiler::EnableNetworkDetailsToStdOut(ProfilingDetailsMethod detailsMetho
     pProfilerImpl->EnableNetworkDetailsToStdOut(detailsMethod);
 }
 
+void IProfiler::EnableHardwareCounters(bool enableHardwareCounters)
+{
+    pProfilerImpl->EnableHardwareCounters(enableHardwareCounters);
+}
+
 bool IProfiler::IsProfilingEnabled()
 {
     return pProfilerImpl->IsProfilingEnabled();
@@ -632,6 +792,11 @@ void IProfiler::Print(std::ostream& outStream) const
     pProfilerImpl->Print(outStream);
 }
 
+void IProfiler::PrintChromeTrace(std::ostream& outStream) const
+{
+    pProfilerImpl->PrintChromeTrace(outStream);
+}
+
 Event* IProfiler::BeginEvent(const BackendId& backendId,
                              const std::string& label,
                              std::vector<InstrumentPtr>&& instruments,
@@ -1,5 +1,5 @@
 //
-// Copyright © 2017 Arm Ltd. All rights reserved.
+// Copyright © 2017, 2024 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 #pragma once
@@ -11,6 +11,7 @@
 
 #include <armnn/Optional.hpp>
 #include <armnn/utility/IgnoreUnused.hpp>
+#include "PerfEventCounters.hpp"
 #include "WallClockTimer.hpp"
 
 #include <chrono>
@@ -19,13 +20,18 @@
 #include <vector>
 #include <stack>
 #include <map>
+#if !defined(ARMNN_DISABLE_THREADS)
+#include <mutex>
+#endif
 
 namespace armnn
 {
 
-// Simple single-threaded profiler.
+// Simple profiler.
 // Tracks events reported by BeginEvent()/EndEvent() and outputs detailed information and stats when
 // Profiler::AnalyzeEventsAndWriteResults() is called.
+// Events may be reported from several threads at once, e.g. by the threads of a Threadpool running inferences on
+// the same network, in which case the events of each thread are nested separately.
 class ProfilerImpl
 {
 public:
@@ -62,6 +68,9 @@ public:
     // Enables outputting the layer descriptors and infos to stdout
     void EnableNetworkDetailsToStdOut(ProfilingDetailsMethod detailsMethod);
 
+    // Enables/disables adding perf event counters to every event.
+    void EnableHardwareCounters(bool enableHardwareCounters);
+
     // Increments the event tag, allowing grouping of events in a user-defined manner (e.g. per inference).
     void UpdateEventTag();
 
@@ -72,6 +81,9 @@ public:
     // Print stats for events in JSON Format to the given output stream.
     void Print(std::ostream& outStream) const;
 
+    // Print the events in the Chrome Trace Event format to the given output stream.
+    void PrintChromeTrace(std::ostream& outStream) const;
+
     // Gets the color to render an event with, based on which device it denotes.
     uint32_t GetEventColor(const BackendId& backendId) const;
 
@@ -98,11 +110,17 @@ public:
     void PopulateParent(std::vector<const Event*>& outEvents, int& outBaseLevel, std::string parentName) const;
     void PopulateDescendants(std::map<const Event*, std::vector<const Event*>>& outDescendantsMap) const;
 
-    std::stack<Event*> m_Parents;
+    // The events which haven't ended yet, of each thread.
+    std::map<int, std::stack<Event*>> m_Parents;
     std::vector<EventPtr> m_EventSequence;
+#if !defined(ARMNN_DISABLE_THREADS)
+    // Guards the events, which are only read once they have all ended.
+    std::mutex m_EventsMutex;
+#endif
     DescPtr m_ProfilingDetails = std::make_unique<ProfilingDetails>();
     bool m_ProfilingEnabled;
     ProfilingDetailsMethod m_DetailsToStdOutMethod;
+    bool m_HardwareCountersEnabled;
 
 };
 
@@ -1,13 +1,23 @@
 //
-// Copyright © 2017 Arm Ltd. All rights reserved.
+// Copyright © 2017, 2024 Arm Ltd. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 
 #include "Profiling.hpp"
 #include "ProfilingEvent.hpp"
 
+#include <common/include/Threads.hpp>
+
 namespace armnn
 {
+
+int GetEventThreadId()
+{
+    // Saves a system call for every event
+    thread_local const int threadId = arm::pipe::GetCurrentThreadId();
+    return threadId;
+}
+
 Event::Event(const std::string& eventName,
              IProfiler* profiler,
              Event* parent,
@@ -20,6 +30,7 @@ Event::Event(const std::string& eventName,
     , m_BackendId(backendId)
     , m_Instruments(std::move(instruments))
     , m_ProfilingGuid(guid)
+    , m_ThreadId(GetEventThreadId())
 {
 }
 
@@ -30,6 +41,7 @@ Event::Event(Event&& other) noexcept
     , m_BackendId(other.m_BackendId)
     , m_Instruments(std::move(other.m_Instruments))
     , m_ProfilingGuid(other.m_ProfilingGuid)
+    , m_ThreadId(other.m_ThreadId)
 {
 }
 
@@ -96,6 +108,11 @@ Optional<arm::pipe::ProfilingGuid> Event::GetProfilingGuid() const
     return m_ProfilingGuid;
 }
 
+int Event::GetThreadId() const
+{
+    return m_ThreadId;
+}
+
 
 Event& Event::operator=(Event&& other) noexcept
 {
@@ -109,6 +126,7 @@ Event& Event::operator=(Event&& other) noexcept
     m_Parent = other.m_Parent;
     m_BackendId = other.m_BackendId;
     m_ProfilingGuid = other.m_ProfilingGuid;
+    m_ThreadId = other.m_ThreadId;
     other.m_Profiler = nullptr;
     other.m_Parent = nullptr;
     return *this;
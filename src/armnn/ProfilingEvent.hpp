@@ -1,5 +1,5 @@
 //
-// Copyright © 2017 Arm Ltd. All rights reserved.
+// Copyright © 2017, 2024 Arm Ltd. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 
@@ -22,6 +22,10 @@ namespace armnn
 /// Forward declaration
 class IProfiler;
 
+/// Get the id of the calling thread, as events record it
+/// \return Thread id of the calling thread
+int GetEventThreadId();
+
 /// Event class records measurements reported by BeginEvent()/EndEvent() and returns measurements when
 /// Event::GetMeasurements() is called.
 class Event
@@ -79,6 +83,10 @@ public:
     /// \return Optional GUID of the event
     Optional<arm::pipe::ProfilingGuid> GetProfilingGuid() const;
 
+    /// Get the id of the thread which began the event
+    /// \return Thread id of the event
+    int GetThreadId() const;
+
     /// Assignment operator
     Event& operator=(const Event& other) = delete;
 
@@ -103,6 +111,9 @@ private:
 
     /// Workload Profiling id
     Optional<arm::pipe::ProfilingGuid> m_ProfilingGuid;
+
+    /// Thread which began the event
+    int m_ThreadId;
 };
 
 } // namespace armnn
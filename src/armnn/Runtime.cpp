@@ -1,5 +1,5 @@
 //
-// Copyright © 2017, 2022-2023 Arm Ltd and Contributors. All rights reserved.
+// Copyright © 2017, 2022-2024 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 
@@ -206,14 +206,29 @@ Status RuntimeImpl::LoadNetwork(NetworkId& networkIdOut,
     {
         return Status::Failure;
     }
+    loadedNetwork->SetBackendContexts(networkIdOut, &m_BackendContexts);
+
+    // The backends are told that the network has been unloaded once it is freed, which is when the last inference
+    // still running on it is done if it is unloaded in the middle of inferences.
+    const NetworkId networkId = networkIdOut;
+    std::shared_ptr<LoadedNetwork> sharedNetwork(loadedNetwork.release(), [this, networkId](LoadedNetwork* network)
+    {
+        delete network;
+        for (auto&& context : m_BackendContexts)
+        {
+            context.second->AfterUnloadNetwork(networkId);
+        }
+    });
 
     {
 #if !defined(ARMNN_DISABLE_THREADS)
         std::lock_guard<std::mutex> lockGuard(m_Mutex);
 #endif
 
-        // Stores the network
-        m_LoadedNetworks[networkIdOut] = std::move(loadedNetwork);
+        // Stores the network in a new snapshot, inferences carry on with the previous one meanwhile
+        auto loadedNetworks = std::make_shared<LoadedNetworks>(*m_LoadedNetworks);
+        (*loadedNetworks)[networkIdOut] = std::move(sharedNetwork);
+        std::atomic_store(&m_LoadedNetworks, std::shared_ptr<const LoadedNetworks>(std::move(loadedNetworks)));
     }
 
     for (auto&& context : m_BackendContexts)
@@ -246,39 +261,43 @@ Status RuntimeImpl::UnloadNetwork(NetworkId networkId)
 
     std::unique_ptr<arm::pipe::TimelineUtilityMethods> timelineUtils =
         arm::pipe::TimelineUtilityMethods::GetTimelineUtils(*m_ProfilingService.get());
+
+    // Inferences which are still running on the network keep it alive. It is freed once the last of them is done,
+    // outside the lock, so that it doesn't hold up other loads and unloads. The backends' AfterUnloadNetwork is
+    // called when it is freed, see LoadNetwork().
+    std::shared_ptr<LoadedNetwork> unloadedNetwork;
     {
 #if !defined(ARMNN_DISABLE_THREADS)
         std::lock_guard<std::mutex> lockGuard(m_Mutex);
 #endif
 
-        // If timeline recording is on mark the Network end of life
-        if (timelineUtils)
+        auto search = m_LoadedNetworks->find(networkId);
+        if (search == m_LoadedNetworks->end())
         {
-            auto search = m_LoadedNetworks.find(networkId);
-            if (search != m_LoadedNetworks.end())
-            {
-                arm::pipe::ProfilingGuid networkGuid = search->second->GetNetworkGuid();
-                timelineUtils->RecordEvent(networkGuid,
-                                           arm::pipe::LabelsAndEventClasses::ARMNN_PROFILING_EOL_EVENT_CLASS);
-            }
+            ARMNN_LOG(warning) << "WARNING: RuntimeImpl::UnloadNetwork(): " << networkId << " not found!";
+            return Status::Failure;
         }
+        unloadedNetwork = search->second;
 
-        if (m_LoadedNetworks.erase(networkId) == 0)
+        // If timeline recording is on mark the Network end of life
+        if (timelineUtils)
         {
-            ARMNN_LOG(warning) << "WARNING: RuntimeImpl::UnloadNetwork(): " << networkId << " not found!";
-            return Status::Failure;
+            arm::pipe::ProfilingGuid networkGuid = unloadedNetwork->GetNetworkGuid();
+            timelineUtils->RecordEvent(networkGuid,
+                                       arm::pipe::LabelsAndEventClasses::ARMNN_PROFILING_EOL_EVENT_CLASS);
         }
 
+        auto loadedNetworks = std::make_shared<LoadedNetworks>(*m_LoadedNetworks);
+        loadedNetworks->erase(networkId);
+        std::atomic_store(&m_LoadedNetworks, std::shared_ptr<const LoadedNetworks>(std::move(loadedNetworks)));
+
         if (m_ProfilingService->IsProfilingEnabled())
         {
             m_ProfilingService->IncrementCounterValue(arm::pipe::NETWORK_UNLOADS);
         }
     }
 
-    for (auto&& context : m_BackendContexts)
-    {
-        context.second->AfterUnloadNetwork(networkId);
-    }
+    unloadedNetwork.reset();
 
     // Unregister the profiler
     ProfilerManager::GetInstance().RegisterProfiler(nullptr);
@@ -289,8 +308,9 @@ Status RuntimeImpl::UnloadNetwork(NetworkId networkId)
 
 const std::shared_ptr<IProfiler> RuntimeImpl::GetProfiler(NetworkId networkId) const
 {
-    auto it = m_LoadedNetworks.find(networkId);
-    if (it != m_LoadedNetworks.end())
+    std::shared_ptr<const LoadedNetworks> loadedNetworks = GetLoadedNetworks();
+    auto it = loadedNetworks->find(networkId);
+    if (it != loadedNetworks->end())
     {
         auto& loadedNetwork = it->second;
         return loadedNetwork->GetProfiler();
@@ -303,8 +323,9 @@ void RuntimeImpl::ReportStructure(arm::pipe::IProfilingService& profilingService
 {
     if (profilingService.IsProfilingEnabled())
     {
-        LoadedNetworks::iterator it = m_LoadedNetworks.begin();
-        while (it != m_LoadedNetworks.end())
+        std::shared_ptr<const LoadedNetworks> loadedNetworks = GetLoadedNetworks();
+        LoadedNetworks::const_iterator it = loadedNetworks->begin();
+        while (it != loadedNetworks->end())
         {
             auto& loadedNetwork = it->second;
             loadedNetwork->SendNetworkStructure(profilingService);
@@ -321,7 +342,8 @@ void RuntimeImpl::InitialiseProfilingService(arm::pipe::IProfilingService& profi
 }
 
 RuntimeImpl::RuntimeImpl(const IRuntime::CreationOptions& options)
-    : m_NetworkIdCounter(0)
+    : m_LoadedNetworks(std::make_shared<const LoadedNetworks>())
+    , m_NetworkIdCounter(0)
 {
     m_ProfilingService = arm::pipe::IProfilingService::CreateProfilingService(
         arm::pipe::MAX_ARMNN_COUNTER,
@@ -552,7 +574,8 @@ RuntimeImpl::~RuntimeImpl()
     try
     {
         // Coverity fix: The following code may throw an exception of type std::length_error.
-        std::transform(m_LoadedNetworks.begin(), m_LoadedNetworks.end(),
+        std::shared_ptr<const LoadedNetworks> loadedNetworks = GetLoadedNetworks();
+        std::transform(loadedNetworks->begin(), loadedNetworks->end(),
                        std::back_inserter(networkIDs),
                        [](const auto &pair) { return pair.first; });
     }
@@ -584,6 +607,9 @@ RuntimeImpl::~RuntimeImpl()
                       << std::endl;
         }
     }
+    // Networks which failed to unload are freed while the backends they tell about it are still there. The snapshot
+    // is replaced rather than reset, as profiling threads may still be looking networks up in it
+    std::atomic_store(&m_LoadedNetworks, std::make_shared<const LoadedNetworks>());
 #if !defined(ARMNN_DISABLE_DYNAMIC_BACKENDS)
     // Clear all dynamic backends.
     DynamicBackendUtils::DeregisterDynamicBackends(m_DeviceSpec.GetDynamicBackends());
@@ -602,12 +628,14 @@ RuntimeImpl::~RuntimeImpl()
                     << std::fixed << armnn::GetTimeDuration(startTime).count() << " ms.";
 }
 
-LoadedNetwork* RuntimeImpl::GetLoadedNetworkPtr(NetworkId networkId) const
+std::shared_ptr<const LoadedNetworks> RuntimeImpl::GetLoadedNetworks() const
 {
-#if !defined(ARMNN_DISABLE_THREADS)
-    std::lock_guard<std::mutex> lockGuard(m_Mutex);
-#endif
-    return m_LoadedNetworks.at(networkId).get();
+    return std::atomic_load(&m_LoadedNetworks);
+}
+
+std::shared_ptr<LoadedNetwork> RuntimeImpl::GetLoadedNetworkPtr(NetworkId networkId) const
+{
+    return GetLoadedNetworks()->at(networkId);
 }
 
 TensorInfo RuntimeImpl::GetInputTensorInfo(NetworkId networkId, LayerBindingId layerId) const
@@ -649,7 +677,7 @@ Status RuntimeImpl::EnqueueWorkload(NetworkId networkId,
 {
     const auto startTime = armnn::GetTimeNow();
 
-    LoadedNetwork* loadedNetwork = GetLoadedNetworkPtr(networkId);
+    std::shared_ptr<LoadedNetwork> loadedNetwork = GetLoadedNetworkPtr(networkId);
 
     if (!loadedNetwork)
     {
@@ -702,7 +730,7 @@ Status RuntimeImpl::Execute(IWorkingMemHandle& iWorkingMemHandle,
     const auto startTime = armnn::GetTimeNow();
 
     NetworkId networkId = iWorkingMemHandle.GetNetworkId();
-    LoadedNetwork* loadedNetwork = GetLoadedNetworkPtr(networkId);
+    std::shared_ptr<LoadedNetwork> loadedNetwork = GetLoadedNetworkPtr(networkId);
 
     if (!loadedNetwork)
     {
@@ -734,7 +762,7 @@ Status RuntimeImpl::Execute(IWorkingMemHandle& iWorkingMemHandle,
 /// overlapped Execution by calling this function from different threads.
 std::unique_ptr<IWorkingMemHandle> RuntimeImpl::CreateWorkingMemHandle(NetworkId networkId)
 {
-    LoadedNetwork* loadedNetwork = GetLoadedNetworkPtr(networkId);
+    std::shared_ptr<LoadedNetwork> loadedNetwork = GetLoadedNetworkPtr(networkId);
 
     if (!loadedNetwork)
     {
@@ -765,7 +793,7 @@ std::unique_ptr<IWorkingMemHandle> RuntimeImpl::CreateWorkingMemHandle(NetworkId
 
 void RuntimeImpl::RegisterDebugCallback(NetworkId networkId, const DebugCallbackFunction& func)
 {
-    LoadedNetwork* loadedNetwork = GetLoadedNetworkPtr(networkId);
+    std::shared_ptr<LoadedNetwork> loadedNetwork = GetLoadedNetworkPtr(networkId);
     loadedNetwork->RegisterDebugCallback(func);
 }
 
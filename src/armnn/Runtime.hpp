@@ -1,5 +1,5 @@
 //
-// Copyright © 2017, 2023 Arm Ltd and Contributors. All rights reserved.
+// Copyright © 2017, 2023-2024 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 #pragma once
@@ -18,12 +18,14 @@
 #include <client/include/IProfilingService.hpp>
 #include <client/include/IReportStructure.hpp>
 
+#include <atomic>
+#include <memory>
 #include <mutex>
 #include <unordered_map>
 
 namespace armnn
 {
-using LoadedNetworks = std::unordered_map<NetworkId, std::unique_ptr<LoadedNetwork>>;
+using LoadedNetworks = std::unordered_map<NetworkId, std::shared_ptr<LoadedNetwork>>;
 using IReportStructure = arm::pipe::IReportStructure;
     using IInitialiseProfilingService = arm::pipe::IInitialiseProfilingService;
 
@@ -83,6 +85,7 @@ public:
     /// Unloads a network from the Runtime.
     /// At the moment this only removes the network from the m_Impl->m_Network.
     /// This might need more work in the future to be AndroidNN compliant.
+    /// Inferences still running on the network carry on, and it is freed once the last of them is done.
     /// @param [in] networkId Unique identifier for the network to be unloaded. Generated in LoadNetwork().
     /// @return armnn::Status
     Status UnloadNetwork(NetworkId networkId);
@@ -115,22 +118,23 @@ public:
     void InitialiseProfilingService(arm::pipe::IProfilingService& profilingService) override;
 
 private:
-    friend void RuntimeLoadedNetworksReserve(RuntimeImpl* runtime); // See RuntimeTests.cpp
-
     friend arm::pipe::IProfilingService& GetProfilingService(RuntimeImpl* runtime); // See RuntimeTests.cpp
 
     int GenerateNetworkId();
 
-    LoadedNetwork* GetLoadedNetworkPtr(NetworkId networkId) const;
+    /// Gets the current snapshot of the loaded networks, without waiting for networks being loaded or unloaded.
+    std::shared_ptr<const LoadedNetworks> GetLoadedNetworks() const;
+
+    /// Gets a reference to the given network, which keeps it alive while it is used even if it gets unloaded
+    /// meanwhile. Throws std::out_of_range if there is no such network.
+    std::shared_ptr<LoadedNetwork> GetLoadedNetworkPtr(NetworkId networkId) const;
 
     template<typename Func>
     void LoadedNetworkFuncSafe(NetworkId networkId, Func f)
     {
-#if !defined(ARMNN_DISABLE_THREADS)
-        std::lock_guard<std::mutex> lockGuard(m_Mutex);
-#endif
-        auto iter = m_LoadedNetworks.find(networkId);
-        if (iter != m_LoadedNetworks.end())
+        std::shared_ptr<const LoadedNetworks> loadedNetworks = GetLoadedNetworks();
+        auto iter = loadedNetworks->find(networkId);
+        if (iter != loadedNetworks->end())
         {
             f(iter->second.get());
         }
@@ -140,15 +144,19 @@ private:
     void LoadDynamicBackends(const std::string& overrideBackendPath);
 
 #if !defined(ARMNN_DISABLE_THREADS)
+    /// Serialises the changes to the loaded networks
     mutable std::mutex m_Mutex;
 #endif
 
-    /// Map of Loaded Networks with associated GUID as key
-    LoadedNetworks m_LoadedNetworks;
+    /// Map of Loaded Networks with associated GUID as key.
+    /// Inferences read it on every call, while networks are rarely loaded or unloaded, so the map is never changed
+    /// in place: a changed copy replaces it instead. Readers take the current snapshot atomically and are never
+    /// blocked by a load or an unload, which only wait for each other.
+    std::shared_ptr<const LoadedNetworks> m_LoadedNetworks;
 
     std::unordered_map<BackendId, IBackendInternal::IBackendContextPtr> m_BackendContexts;
 
-    int m_NetworkIdCounter;
+    std::atomic<int> m_NetworkIdCounter;
 
     DeviceSpec m_DeviceSpec;
 
@@ -578,7 +578,7 @@ void SubgraphView::SubstituteSubgraph(SubgraphView& patternSubgraph, const Subgr
                                                         layer->Reparent(*workingCopyGraph,
                                                                         (workingCopyGraph->m_Layers).end());
 
-                                                        workingCopyGraph->m_LayersInOrder = false;
+                                                        workingCopyGraph->SetLayersOutOfOrder();
                                                     }
                                                 });
 
@@ -1,42 +1,413 @@
 //
-// Copyright © 2021 Arm Ltd and Contributors. All rights reserved.
+// Copyright © 2021, 2024 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 #if !defined(ARMNN_DISABLE_THREADS)
 
 #include <armnn/Threadpool.hpp>
 
+#include <armnn/IAsyncExecutionCallback.hpp>
+#include <armnn/IWorkingMemHandle.hpp>
+#include <armnn/Logging.hpp>
+#include <armnn/utility/IgnoreUnused.hpp>
 #include <armnn/utility/Timer.hpp>
 
+#include <algorithm>
+#include <array>
+#include <deque>
+#include <iterator>
+#include <limits>
+#include <map>
+
+#if defined(__linux__)
+#include <sched.h>
+#include <cerrno>
+#include <cstring>
+#endif
+
 namespace armnn
 {
 namespace experimental
 {
 
+namespace
+{
+
+constexpr std::array<QosExecPriority, 3> g_PrioritiesHighestFirst =
+    { QosExecPriority::High, QosExecPriority::Medium, QosExecPriority::Low };
+
+/// Weight of the last execution in the estimated duration of the executions of a network.
+constexpr double g_DurationSmoothing = 0.2;
+
+double ToNanoseconds(HighResolutionClock time, HighResolutionClock epoch)
+{
+    return std::chrono::duration<double, std::nano>(time - epoch).count();
+}
+
+/// The pool the current thread is a worker of, if any, so that executions scheduled by a worker (e.g. from a callback)
+/// go to its own queues.
+thread_local const Threadpool* tl_CurrentPool = nullptr;
+thread_local uint32_t tl_CurrentIndex = 0;
+
+void PinCurrentThread(unsigned int cpuId)
+{
+#if defined(__linux__)
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    CPU_SET(cpuId, &cpuSet);
+    // Pins the calling thread, which unlike pthread_setaffinity_np is also available on Android
+    if (sched_setaffinity(0, sizeof(cpuSet), &cpuSet) != 0)
+    {
+        ARMNN_LOG(warning) << "Threadpool: Unable to pin a thread to CPU " << cpuId << ": " << std::strerror(errno);
+    }
+#else
+    IgnoreUnused(cpuId);
+#endif
+}
+
+} // anonymous namespace
+
+struct Threadpool::Execution
+{
+    NetworkId m_NetworkId;
+    InputTensors m_InputTensors;
+    OutputTensors m_OutputTensors;
+    std::shared_ptr<IAsyncExecutionCallback> m_Callback;
+    QosExecPriority m_Priority;
+    HighResolutionClock m_ScheduledTime;
+    /// Estimated duration of the execution in nanoseconds, 0 if unknown.
+    double m_EstimatedDuration;
+    /// Position of the execution in the queues under the EarliestDeadlineFirst and WeightedFairQueuing policies,
+    /// lowest first.
+    double m_Tag;
+    /// The network and the working memory handle the execution runs with, set when it is taken off the queues.
+    /// The network is null if it has been unloaded since the execution was scheduled.
+    std::shared_ptr<NetworkState> m_Network;
+    std::shared_ptr<IWorkingMemHandle> m_MemHandle;
+};
+
+/// The queues of one of the threads of the pool, and what the thread is running.
+/// Under the Priority policy there is a queue for each priority. The thread takes executions from the front, while the
+/// threads stealing from it take them from the back. Under the other policies the executions are ordered by their tag.
+/// Executions are only taken off the queues when they can start, see Threadpool::TryStartExecution(), the ones which
+/// can't being skipped.
+class Threadpool::WorkerQueues
+{
+public:
+    explicit WorkerQueues(SchedulingPolicy policy)
+        : m_Policy(policy)
+    {}
+
+    void Push(ExecutionPtr execution)
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        if (m_Policy == SchedulingPolicy::Priority)
+        {
+            GetQueue(execution->m_Priority).push_back(std::move(execution));
+        }
+        else
+        {
+            const double tag = execution->m_Tag;
+            m_TaggedQueue.emplace(tag, std::move(execution));
+        }
+    }
+
+    /// Takes the execution with the highest priority which can start, unless executions of that priority have been
+    /// taken EXPIRE_RATE times in a row while lower priority ones are waiting.
+    template <typename TryStart>
+    ExecutionPtr Pop(unsigned int& highPriorityCount, unsigned int& mediumPriorityCount, TryStart&& tryStart)
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        auto& highPriorityQueue = GetQueue(QosExecPriority::High);
+        auto& mediumPriorityQueue = GetQueue(QosExecPriority::Medium);
+        auto& lowPriorityQueue = GetQueue(QosExecPriority::Low);
+
+        // A second pass is only needed when the counts are reset because only expired priorities are left
+        for (int pass = 0; pass < 2; ++pass)
+        {
+            if (highPriorityCount < EXPIRE_RATE)
+            {
+                if (ExecutionPtr execution = Take(highPriorityQueue, false, tryStart))
+                {
+                    highPriorityCount += 1;
+                    return execution;
+                }
+            }
+            // If no high priority message can start or the count exceeds the expire rate, get medium priority message
+            if (mediumPriorityCount < EXPIRE_RATE)
+            {
+                if (ExecutionPtr execution = Take(mediumPriorityQueue, false, tryStart))
+                {
+                    mediumPriorityCount += 1;
+                    // Reset high priority count
+                    highPriorityCount = 0;
+                    return execution;
+                }
+            }
+            // Reset high and medium priority count
+            highPriorityCount = 0;
+            mediumPriorityCount = 0;
+            // If no medium priority message can start or the count exceeds the expire rate, get low priority message
+            if (ExecutionPtr execution = Take(lowPriorityQueue, false, tryStart))
+            {
+                return execution;
+            }
+        }
+        return nullptr;
+    }
+
+    /// Takes the last execution of the given priority which can start.
+    template <typename TryStart>
+    ExecutionPtr Steal(QosExecPriority priority, TryStart&& tryStart)
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        return Take(GetQueue(priority), true, tryStart);
+    }
+
+    /// Gets the tag of the first of the tagged executions which may be able to start, returning false if there are
+    /// none.
+    template <typename CanStart>
+    bool PeekFirstTag(double& tag, CanStart&& canStart)
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        for (const auto& tagged : m_TaggedQueue)
+        {
+            if (canStart(*tagged.second))
+            {
+                tag = tagged.first;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /// Takes the first of the tagged executions which can start.
+    template <typename TryStart>
+    ExecutionPtr PopFirst(TryStart&& tryStart)
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        for (auto it = m_TaggedQueue.begin(); it != m_TaggedQueue.end(); ++it)
+        {
+            if (tryStart(*it->second))
+            {
+                ExecutionPtr execution = std::move(it->second);
+                m_TaggedQueue.erase(it);
+                return execution;
+            }
+        }
+        return nullptr;
+    }
+
+    /// Records the execution the thread is running, and when it is expected to finish in nanoseconds from the epoch
+    /// of the pool.
+    void SetRunning(NetworkId networkId, double expectedEnd)
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Running = true;
+        m_RunningNetworkId = networkId;
+        m_RunningExpectedEnd = expectedEnd;
+    }
+
+    void ClearRunning()
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Running = false;
+    }
+
+    /// Adds the estimated duration, in nanoseconds, of the queued executions which run before the execution and of
+    /// what is left of the one running to workAhead, and that of the ones of the same network to networkWorkAhead.
+    void AddWorkAhead(const Execution& execution, double now, double& workAhead, double& networkWorkAhead)
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        auto add = [&](NetworkId networkId, double duration)
+        {
+            workAhead += duration;
+            if (networkId == execution.m_NetworkId)
+            {
+                networkWorkAhead += duration;
+            }
+        };
+
+        if (m_Running)
+        {
+            add(m_RunningNetworkId, std::max(0.0, m_RunningExpectedEnd - now));
+        }
+        if (m_Policy == SchedulingPolicy::Priority)
+        {
+            for (QosExecPriority priority : g_PrioritiesHighestFirst)
+            {
+                if (priority < execution.m_Priority)
+                {
+                    break;
+                }
+                for (const ExecutionPtr& queued : GetQueue(priority))
+                {
+                    add(queued->m_NetworkId, queued->m_EstimatedDuration);
+                }
+            }
+        }
+        else
+        {
+            for (auto it = m_TaggedQueue.begin(); it != m_TaggedQueue.end() && it->first <= execution.m_Tag; ++it)
+            {
+                add(it->second->m_NetworkId, it->second->m_EstimatedDuration);
+            }
+        }
+    }
+
+private:
+    std::deque<ExecutionPtr>& GetQueue(QosExecPriority priority)
+    {
+        return m_Queues[static_cast<size_t>(priority)];
+    }
+
+    /// Takes the first execution of the queue which can start, or the last one if fromBack is set.
+    template <typename TryStart>
+    static ExecutionPtr Take(std::deque<ExecutionPtr>& queue, bool fromBack, TryStart& tryStart)
+    {
+        for (size_t i = 0; i < queue.size(); ++i)
+        {
+            const auto offset = static_cast<std::ptrdiff_t>(i);
+            auto it = fromBack ? std::prev(queue.end(), offset + 1) : std::next(queue.begin(), offset);
+            if (tryStart(**it))
+            {
+                ExecutionPtr execution = std::move(*it);
+                queue.erase(it);
+                return execution;
+            }
+        }
+        return nullptr;
+    }
+
+    SchedulingPolicy m_Policy;
+    std::mutex m_Mutex;
+    std::array<std::deque<ExecutionPtr>, 3> m_Queues;
+    std::multimap<double, ExecutionPtr> m_TaggedQueue;
+    bool m_Running = false;
+    NetworkId m_RunningNetworkId = 0;
+    double m_RunningExpectedEnd = 0.0;
+};
+
+/// The working memory handles of a network which aren't in use by an execution, and what its executions are scheduled
+/// with.
+class Threadpool::NetworkState
+{
+public:
+    void AddMemHandles(const std::vector<std::shared_ptr<IWorkingMemHandle>>& memHandles)
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_FreeHandles.insert(m_FreeHandles.end(), memHandles.begin(), memHandles.end());
+        m_NumMemHandles += memHandles.size();
+    }
+
+    /// Takes a free handle, the preferred one if it is free, or returns nullptr if they are all in use.
+    std::shared_ptr<IWorkingMemHandle> TryAcquireMemHandle(const IWorkingMemHandle* preferred)
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        if (m_FreeHandles.empty())
+        {
+            return nullptr;
+        }
+
+        auto it = std::find_if(m_FreeHandles.begin(), m_FreeHandles.end(),
+                               [preferred](const std::shared_ptr<IWorkingMemHandle>& memHandle)
+                               {
+                                   return memHandle.get() == preferred;
+                               });
+        if (it == m_FreeHandles.end())
+        {
+            it = std::prev(m_FreeHandles.end());
+        }
+        std::shared_ptr<IWorkingMemHandle> memHandle = std::move(*it);
+        m_FreeHandles.erase(it);
+        return memHandle;
+    }
+
+    void ReleaseMemHandle(std::shared_ptr<IWorkingMemHandle> memHandle)
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_FreeHandles.push_back(std::move(memHandle));
+    }
+
+    bool HasFreeMemHandle()
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        return !m_FreeHandles.empty();
+    }
+
+    /// Number of handles of the network, free or in use, i.e. how many of its executions can run at once.
+    size_t GetNumMemHandles()
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        return m_NumMemHandles;
+    }
+
+    /// Estimated duration of an execution in nanoseconds, 0 until one has run.
+    double GetEstimatedDuration() const
+    {
+        return m_EstimatedDuration.load();
+    }
+
+    void RecordDuration(double duration)
+    {
+        // Moving average, so that the estimate follows changes in the load of the system
+        const double estimate = m_EstimatedDuration.load();
+        m_EstimatedDuration.store(estimate > 0.0 ? estimate + (duration - estimate) * g_DurationSmoothing : duration);
+    }
+
+    // Guarded by the fair queuing mutex of the pool
+    unsigned int m_Weight = 1;
+    double m_LastFinishTag = 0.0;
+
+private:
+    std::mutex m_Mutex;
+    std::vector<std::shared_ptr<IWorkingMemHandle>> m_FreeHandles;
+    size_t m_NumMemHandles = 0;
+    std::atomic<double> m_EstimatedDuration{ 0.0 };
+};
+
 Threadpool::Threadpool(std::size_t numThreads,
                        IRuntime* runtimePtr,
-                       std::vector<std::shared_ptr<IWorkingMemHandle>> memHandles)
+                       std::vector<std::shared_ptr<IWorkingMemHandle>> memHandles,
+                       std::vector<unsigned int> cpuIds,
+                       SchedulingPolicy policy)
     : m_RuntimePtr(runtimePtr)
+    , m_CpuIds(std::move(cpuIds))
+    , m_Policy(policy)
+    , m_Epoch(armnn::GetTimeNow())
+    , m_VirtualTime(0.0)
+    , m_NextQueue(0)
+    , m_NumPendingExecutions(0)
+    , m_NumWorkEvents(0)
+    , m_TerminatePool(false)
 {
+    if (numThreads == 0)
+    {
+        throw armnn::InvalidArgumentException("Threadpool: The number of threads must be greater than 0");
+    }
+
+    LoadMemHandles(memHandles);
+
+    for (auto i = 0u; i < numThreads; ++i)
+    {
+        m_WorkerQueues.emplace_back(std::make_unique<WorkerQueues>(m_Policy));
+    }
     for (auto i = 0u; i < numThreads; ++i)
     {
         m_Threads.emplace_back(std::make_unique<std::thread>(&Threadpool::ProcessExecPriorities, this, i));
     }
+}
 
-    LoadMemHandles(memHandles);
+Threadpool::~Threadpool()
+{
+    TerminateThreadPool();
 }
 
 void Threadpool::LoadMemHandles(std::vector<std::shared_ptr<IWorkingMemHandle>> memHandles)
 {
     if (memHandles.size() == 0)
     {
-        throw armnn::RuntimeException("Threadpool::UnloadMemHandles: Size of memHandles vector must be greater than 0");
-    }
-
-    if (memHandles.size() != m_Threads.size())
-    {
-        throw armnn::RuntimeException(
-                "Threadpool::UnloadMemHandles: Size of memHandles vector must match the number of threads");
+        throw armnn::RuntimeException("Threadpool::LoadMemHandles: Size of memHandles vector must be greater than 0");
     }
 
     NetworkId networkId = memHandles[0]->GetNetworkId();
@@ -45,25 +416,66 @@ void Threadpool::LoadMemHandles(std::vector<std::shared_ptr<IWorkingMemHandle>>
         if (networkId != memHandles[i]->GetNetworkId())
         {
             throw armnn::RuntimeException(
-                    "Threadpool::UnloadMemHandles: All network ids must be identical in memHandles");
+                    "Threadpool::LoadMemHandles: All network ids must be identical in memHandles");
         }
     }
 
-    std::pair<NetworkId, std::vector<std::shared_ptr<IWorkingMemHandle>>> pair {networkId, memHandles};
+    std::shared_ptr<NetworkState> network;
+    {
+        std::lock_guard<std::mutex> lock(m_NetworkStatesMutex);
+        auto& entry = m_NetworkStates[networkId];
+        if (!entry)
+        {
+            entry = std::make_shared<NetworkState>();
+        }
+        network = entry;
+    }
+    network->AddMemHandles(memHandles);
 
-    m_WorkingMemHandleMap.insert(pair);
+    // Executions of the network may have been waiting for handles
+    NotifyWorkers();
 }
 
 void Threadpool::UnloadMemHandles(NetworkId networkId)
 {
-    if (m_WorkingMemHandleMap.find(networkId) != m_WorkingMemHandleMap.end())
     {
-        m_WorkingMemHandleMap.erase(networkId);
+        std::lock_guard<std::mutex> lock(m_NetworkStatesMutex);
+        if (m_NetworkStates.find(networkId) != m_NetworkStates.end())
+        {
+            m_NetworkStates.erase(networkId);
+        }
+        else
+        {
+           throw armnn::RuntimeException("Threadpool::UnloadMemHandles: Unknown NetworkId");
+        }
     }
-    else
+
+    // The executions of the network still waiting for a handle can now be taken, to be failed
+    NotifyWorkers();
+}
+
+void Threadpool::SetNetworkWeight(NetworkId networkId, unsigned int weight)
+{
+    if (weight == 0)
+    {
+        throw armnn::InvalidArgumentException("Threadpool::SetNetworkWeight: The weight must be greater than 0");
+    }
+
+    std::shared_ptr<NetworkState> network = GetNetworkState(networkId);
+    if (!network)
     {
-       throw armnn::RuntimeException("Threadpool::UnloadMemHandles: Unknown NetworkId");
+        throw armnn::RuntimeException("Threadpool::SetNetworkWeight: Unknown NetworkId");
     }
+
+    std::lock_guard<std::mutex> lock(m_FairQueuingMutex);
+    network->m_Weight = weight;
+}
+
+std::shared_ptr<Threadpool::NetworkState> Threadpool::GetNetworkState(NetworkId networkId)
+{
+    std::lock_guard<std::mutex> lock(m_NetworkStatesMutex);
+    auto it = m_NetworkStates.find(networkId);
+    return it != m_NetworkStates.end() ? it->second : nullptr;
 }
 
 void Threadpool::Schedule(NetworkId networkId,
@@ -72,31 +484,154 @@ void Threadpool::Schedule(NetworkId networkId,
                           const QosExecPriority priority,
                           std::shared_ptr<IAsyncExecutionCallback> cb)
 {
-    if (m_WorkingMemHandleMap.find(networkId) == m_WorkingMemHandleMap.end())
+    ScheduleExecution(networkId, inputTensors, outputTensors, priority, EmptyOptional(), cb);
+}
+
+void Threadpool::Schedule(NetworkId networkId,
+                          const InputTensors& inputTensors,
+                          const OutputTensors& outputTensors,
+                          HighResolutionClock deadline,
+                          std::shared_ptr<IAsyncExecutionCallback> cb)
+{
+    ScheduleExecution(networkId, inputTensors, outputTensors, QosExecPriority::Medium, deadline, cb);
+}
+
+void Threadpool::ScheduleExecution(NetworkId networkId,
+                                   const InputTensors& inputTensors,
+                                   const OutputTensors& outputTensors,
+                                   QosExecPriority priority,
+                                   Optional<HighResolutionClock> deadline,
+                                   std::shared_ptr<IAsyncExecutionCallback> cb)
+{
+    std::shared_ptr<NetworkState> network = GetNetworkState(networkId);
+    if (!network)
     {
-        throw armnn::RuntimeException("Threadpool::UnloadMemHandles: Unknown NetworkId");
+        throw armnn::RuntimeException("Threadpool::Schedule: Unknown NetworkId");
     }
 
-    // Group execution parameters so that they can be easily added to the queue
-    ExecutionTuple groupExecParams = std::make_tuple(networkId, inputTensors, outputTensors, cb);
+    const HighResolutionClock now = armnn::GetTimeNow();
+    ExecutionPtr execution = std::make_unique<Execution>(Execution{ networkId,
+                                                                    inputTensors,
+                                                                    outputTensors,
+                                                                    cb,
+                                                                    priority,
+                                                                    now,
+                                                                    network->GetEstimatedDuration(),
+                                                                    0.0,
+                                                                    nullptr,
+                                                                    nullptr });
 
-    std::shared_ptr<ExecutionTuple> operation = std::make_shared<ExecutionTuple>(groupExecParams);
-
-    // Add a message to the queue and notify the request thread
-    std::unique_lock<std::mutex> lock(m_ThreadPoolMutex);
-    switch (priority)
+    // The tag of the network is only moved on once the execution is admitted, so the lock is held until then
+    std::unique_lock<std::mutex> fairQueuingLock(m_FairQueuingMutex, std::defer_lock);
+    switch (m_Policy)
     {
-        case QosExecPriority::High:
-            m_HighPriorityQueue.push(operation);
+        case SchedulingPolicy::EarliestDeadlineFirst:
+            execution->m_Tag = deadline.has_value() ? ToNanoseconds(deadline.value(), m_Epoch) :
+                                                      std::numeric_limits<double>::max();
             break;
-        case QosExecPriority::Low:
-            m_LowPriorityQueue.push(operation);
+        case SchedulingPolicy::WeightedFairQueuing:
+        {
+            fairQueuingLock.lock();
+            // Executions of networks which haven't run yet cost the same whatever the network, so that the weights
+            // alone share the threads between them
+            const double cost = execution->m_EstimatedDuration > 0.0 ? execution->m_EstimatedDuration : 1.0;
+            const double startTag = std::max(m_VirtualTime, network->m_LastFinishTag);
+            execution->m_Tag = startTag + cost / static_cast<double>(network->m_Weight);
             break;
-        case QosExecPriority::Medium:
+        }
+        case SchedulingPolicy::Priority:
         default:
-            m_MediumPriorityQueue.push(operation);
+            break;
     }
-    m_ThreadPoolEvent.notify_one();
+
+    if (deadline.has_value())
+    {
+        // Admission control. The work ahead of the execution, queued or left of the executions running, is shared
+        // between the threads, except that the executions of its network can't run on more threads at once than the
+        // network has working memory handles
+        const double nowNs = ToNanoseconds(now, m_Epoch);
+        double workAhead = 0.0;
+        double networkWorkAhead = 0.0;
+        for (auto& queues : m_WorkerQueues)
+        {
+            queues->AddWorkAhead(*execution, nowNs, workAhead, networkWorkAhead);
+        }
+        const double numThreads = static_cast<double>(m_WorkerQueues.size());
+        const double numNetworkThreads = std::min(numThreads, static_cast<double>(network->GetNumMemHandles()));
+        const double expectedEnd = nowNs +
+                                   std::max(workAhead / numThreads, networkWorkAhead / numNetworkThreads) +
+                                   execution->m_EstimatedDuration;
+        if (expectedEnd > ToNanoseconds(deadline.value(), m_Epoch))
+        {
+            if (fairQueuingLock.owns_lock())
+            {
+                fairQueuingLock.unlock();
+            }
+            cb->NotifyRejected(now);
+            return;
+        }
+    }
+
+    if (fairQueuingLock.owns_lock())
+    {
+        network->m_LastFinishTag = execution->m_Tag;
+        fairQueuingLock.unlock();
+    }
+
+    // Executions scheduled by a worker stay on its queues, the others are spread over the workers in turn
+    const uint32_t index = tl_CurrentPool == this ?
+                           tl_CurrentIndex :
+                           m_NextQueue.fetch_add(1) % static_cast<uint32_t>(m_WorkerQueues.size());
+
+    // Counted before it is queued so that the count never drops below the number of executions in the queues
+    m_NumPendingExecutions.fetch_add(1);
+    m_WorkerQueues[index]->Push(std::move(execution));
+
+    NotifyWorkers();
+}
+
+void Threadpool::NotifyWorkers()
+{
+    // Taking the lock makes sure that a worker about to wait sees the new count or is woken up by the notification
+    {
+        std::lock_guard<std::mutex> lock(m_ThreadPoolMutex);
+        m_NumWorkEvents.fetch_add(1);
+    }
+    // While terminating, the workers waiting for the last executions to be taken all need to stop
+    if (m_TerminatePool)
+    {
+        m_ThreadPoolEvent.notify_all();
+    }
+    else
+    {
+        m_ThreadPoolEvent.notify_one();
+    }
+}
+
+bool Threadpool::CanStartExecution(const Execution& execution)
+{
+    std::shared_ptr<NetworkState> network = GetNetworkState(execution.m_NetworkId);
+    return !network || network->HasFreeMemHandle();
+}
+
+bool Threadpool::TryStartExecution(Execution& execution, LastMemHandles& lastMemHandles)
+{
+    execution.m_Network = GetNetworkState(execution.m_NetworkId);
+    if (!execution.m_Network)
+    {
+        // The network has been unloaded since the execution was scheduled
+        return true;
+    }
+
+    const IWorkingMemHandle*& lastMemHandle = lastMemHandles[execution.m_NetworkId];
+    execution.m_MemHandle = execution.m_Network->TryAcquireMemHandle(lastMemHandle);
+    if (!execution.m_MemHandle)
+    {
+        execution.m_Network.reset();
+        return false;
+    }
+    lastMemHandle = execution.m_MemHandle.get();
+    return true;
 }
 
 void Threadpool::TerminateThreadPool() noexcept
@@ -110,95 +645,186 @@ void Threadpool::TerminateThreadPool() noexcept
 
     for (auto &thread : m_Threads)
     {
-        thread->join();
+        if (thread->joinable())
+        {
+            thread->join();
+        }
+    }
+}
+
+Threadpool::ExecutionPtr Threadpool::TakeExecution(uint32_t index,
+                                                   unsigned int& highPriorityCount,
+                                                   unsigned int& mediumPriorityCount,
+                                                   LastMemHandles& lastMemHandles)
+{
+    if (m_Policy != SchedulingPolicy::Priority)
+    {
+        ExecutionPtr execution = TakeFirstExecution(lastMemHandles);
+        if (execution)
+        {
+            m_NumPendingExecutions.fetch_sub(1);
+        }
+        return execution;
+    }
+
+    auto tryStart = [this, &lastMemHandles](Execution& execution)
+    {
+        return TryStartExecution(execution, lastMemHandles);
+    };
+    ExecutionPtr execution = m_WorkerQueues[index]->Pop(highPriorityCount, mediumPriorityCount, tryStart);
+
+    // Steal from the other workers, visiting them all for higher priority work before looking for lower priority work
+    const auto numQueues = static_cast<uint32_t>(m_WorkerQueues.size());
+    for (auto priority = g_PrioritiesHighestFirst.begin(); !execution && priority != g_PrioritiesHighestFirst.end();
+         ++priority)
+    {
+        for (uint32_t offset = 1; !execution && offset < numQueues; ++offset)
+        {
+            execution = m_WorkerQueues[(index + offset) % numQueues]->Steal(*priority, tryStart);
+        }
+    }
+
+    if (execution)
+    {
+        m_NumPendingExecutions.fetch_sub(1);
+    }
+    return execution;
+}
+
+Threadpool::ExecutionPtr Threadpool::TakeFirstExecution(LastMemHandles& lastMemHandles)
+{
+    auto canStart = [this](const Execution& execution)
+    {
+        return CanStartExecution(execution);
+    };
+    auto tryStart = [this, &lastMemHandles](Execution& execution)
+    {
+        return TryStartExecution(execution, lastMemHandles);
+    };
+
+    ExecutionPtr execution;
+    while (!execution)
+    {
+        WorkerQueues* first = nullptr;
+        double firstTag = 0.0;
+        for (auto& queues : m_WorkerQueues)
+        {
+            double tag = 0.0;
+            if (queues->PeekFirstTag(tag, canStart) && (!first || tag < firstTag))
+            {
+                first = queues.get();
+                firstTag = tag;
+            }
+        }
+        if (!first)
+        {
+            return nullptr;
+        }
+
+        // Other threads may have taken the executions which could start in the meantime, in which case it looks again
+        execution = first->PopFirst(tryStart);
+    }
+
+    if (m_Policy == SchedulingPolicy::WeightedFairQueuing)
+    {
+        std::lock_guard<std::mutex> lock(m_FairQueuingMutex);
+        m_VirtualTime = std::max(m_VirtualTime, execution->m_Tag);
     }
+    return execution;
 }
 
 void Threadpool::ProcessExecPriorities(uint32_t index)
 {
-    int expireRate = EXPIRE_RATE;
-    int highPriorityCount = 0;
-    int mediumPriorityCount = 0;
+    tl_CurrentPool = this;
+    tl_CurrentIndex = index;
+    if (!m_CpuIds.empty())
+    {
+        PinCurrentThread(m_CpuIds[index % m_CpuIds.size()]);
+    }
+
+    unsigned int highPriorityCount = 0;
+    unsigned int mediumPriorityCount = 0;
+
+    // The working memory handle last used for each network, which is likely to still be in the caches of the CPU
+    LastMemHandles lastMemHandles;
 
     while (true)
     {
-        std::shared_ptr<ExecutionTuple> currentExecInProgress(nullptr);
+        // Read before looking for an execution, so that a worker which finds none doesn't miss an execution being
+        // scheduled or a handle being released meanwhile
+        const uint64_t numWorkEvents = m_NumWorkEvents.load();
+
+        ExecutionPtr currentExecInProgress = TakeExecution(index, highPriorityCount, mediumPriorityCount,
+                                                           lastMemHandles);
+        if (!currentExecInProgress)
         {
-            // Wait for a message to be added to the queue
-            // This is in a separate scope to minimise the lifetime of the lock
+            // Wait for an execution to be scheduled, or for a handle to be released if none of the pending executions
+            // can start. This is in a separate scope to minimise the lifetime of the lock
             std::unique_lock<std::mutex> lock(m_ThreadPoolMutex);
 
             m_ThreadPoolEvent.wait(lock,
-                                   [=]
+                                   [this, numWorkEvents]
                                    {
-                                       return m_TerminatePool || !m_HighPriorityQueue.empty() ||
-                                              !m_MediumPriorityQueue.empty() || !m_LowPriorityQueue.empty();
+                                       return (m_TerminatePool && m_NumPendingExecutions == 0) ||
+                                              m_NumWorkEvents.load() != numWorkEvents;
                                    });
 
-            if (m_TerminatePool && m_HighPriorityQueue.empty() && m_MediumPriorityQueue.empty() &&
-                m_LowPriorityQueue.empty())
+            if (m_TerminatePool && m_NumPendingExecutions == 0)
             {
                 break;
             }
-
-            // Get the message to process from the front of each queue based on priority from high to low
-            // Get high priority first if it does not exceed the expire rate
-            if (!m_HighPriorityQueue.empty() && highPriorityCount < expireRate)
-            {
-                currentExecInProgress = m_HighPriorityQueue.front();
-                m_HighPriorityQueue.pop();
-                highPriorityCount += 1;
-            }
-                // If high priority queue is empty or the count exceeds the expire rate, get medium priority message
-            else if (!m_MediumPriorityQueue.empty() && mediumPriorityCount < expireRate)
-            {
-                currentExecInProgress = m_MediumPriorityQueue.front();
-                m_MediumPriorityQueue.pop();
-                mediumPriorityCount += 1;
-                // Reset high priority count
-                highPriorityCount = 0;
-            }
-                // If medium priority queue is empty or the count exceeds the expire rate, get low priority message
-            else if (!m_LowPriorityQueue.empty())
-            {
-                currentExecInProgress = m_LowPriorityQueue.front();
-                m_LowPriorityQueue.pop();
-                // Reset high and medium priority count
-                highPriorityCount = 0;
-                mediumPriorityCount = 0;
-            }
-            else
-            {
-                // Reset high and medium priority count
-                highPriorityCount = 0;
-                mediumPriorityCount = 0;
-                continue;
-            }
+            continue;
         }
 
         // invoke the asynchronous execution method
-        auto networkId = std::get<0>(*currentExecInProgress);
-        auto inputTensors = std::get<1>(*currentExecInProgress);
-        auto outputTensors = std::get<2>(*currentExecInProgress);
-        auto cb = std::get<3>(*currentExecInProgress);
+        auto networkId = currentExecInProgress->m_NetworkId;
+        auto& cb = currentExecInProgress->m_Callback;
+
+        std::shared_ptr<NetworkState> network = std::move(currentExecInProgress->m_Network);
+        if (!network)
+        {
+            // The network has been unloaded since the execution was scheduled
+            HighResolutionClock now = armnn::GetTimeNow();
+            cb->Notify(Status::Failure, std::make_pair(now, now));
+            NotifyWorkers();
+            continue;
+        }
+
+        std::shared_ptr<IWorkingMemHandle> memHandle = std::move(currentExecInProgress->m_MemHandle);
 
-        // Get time at start of inference
+        // Get time at start of inference, the time until then being spent queued
         HighResolutionClock startTime = armnn::GetTimeNow();
+        m_WorkerQueues[index]->SetRunning(networkId,
+                                          ToNanoseconds(startTime, m_Epoch) + network->GetEstimatedDuration());
+        cb->NotifyQueueingTime(std::make_pair(currentExecInProgress->m_ScheduledTime, startTime));
 
+        Status status = Status::Failure;
         try // executing the inference
         {
-            IWorkingMemHandle& memHandle = *(m_WorkingMemHandleMap.at(networkId))[index];
-
-            // Execute and populate the time at end of inference in the callback
-            m_RuntimePtr->Execute(memHandle, inputTensors, outputTensors) == Status::Success ?
-            cb->Notify(Status::Success, std::make_pair(startTime, armnn::GetTimeNow())) :
-            cb->Notify(Status::Failure, std::make_pair(startTime, armnn::GetTimeNow()));
+            status = m_RuntimePtr->Execute(*memHandle,
+                                           currentExecInProgress->m_InputTensors,
+                                           currentExecInProgress->m_OutputTensors);
         }
         catch (const RuntimeException&)
         {
-            cb->Notify(Status::Failure, std::make_pair(startTime, armnn::GetTimeNow()));
+            status = Status::Failure;
+        }
+
+        // Get time at end of inference, and hand the working memory back before the callback can schedule more work
+        HighResolutionClock endTime = armnn::GetTimeNow();
+        m_WorkerQueues[index]->ClearRunning();
+        network->ReleaseMemHandle(std::move(memHandle));
+        if (status == Status::Success)
+        {
+            network->RecordDuration(std::chrono::duration<double, std::nano>(endTime - startTime).count());
         }
+        // Executions of the network may have been waiting for the handle
+        NotifyWorkers();
+
+        cb->Notify(status, std::make_pair(startTime, endTime));
     }
+
+    tl_CurrentPool = nullptr;
 }
 
 } // namespace experimental
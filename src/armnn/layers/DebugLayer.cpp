@@ -14,12 +14,14 @@ namespace armnn
 
 DebugLayer::DebugLayer(const char* name)
     : Layer(1, 1, LayerType::Debug, name),
-      m_ToFile(false)
+      m_ToFile(false),
+      m_ToNpyFile(false)
 {}
 
-DebugLayer::DebugLayer(const char* name, bool toFile)
+DebugLayer::DebugLayer(const char* name, bool toFile, bool toNpyFile)
     : Layer(1, 1, LayerType::Debug, name),
-      m_ToFile(toFile)
+      m_ToFile(toFile),
+      m_ToNpyFile(toNpyFile)
 {}
 
 std::unique_ptr<IWorkload> DebugLayer::CreateWorkload(const IWorkloadFactory& factory) const
@@ -31,6 +33,7 @@ std::unique_ptr<IWorkload> DebugLayer::CreateWorkload(const IWorkloadFactory& fa
     descriptor.m_LayerName = prevLayer.GetNameStr();
     descriptor.m_SlotIndex = GetInputSlot(0).GetConnectedOutputSlot()->CalculateIndexOnOwner();
     descriptor.m_LayerOutputToFile = m_ToFile;
+    descriptor.m_LayerOutputToNpyFile = m_ToNpyFile;
 
     SetAdditionalInfo(descriptor);
 
@@ -39,7 +42,7 @@ std::unique_ptr<IWorkload> DebugLayer::CreateWorkload(const IWorkloadFactory& fa
 
 DebugLayer* DebugLayer::Clone(Graph& graph) const
 {
-    return CloneBase<DebugLayer>(graph, GetName());
+    return CloneBase<DebugLayer>(graph, GetName(), m_ToFile, m_ToNpyFile);
 }
 
 void DebugLayer::ValidateTensorShapesFromInputs()
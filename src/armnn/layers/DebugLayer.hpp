@@ -34,13 +34,14 @@ protected:
     /// Constructor to create a DebugLayer.
     /// @param [in] name Optional name for the layer.
     DebugLayer(const char* name);
-    DebugLayer(const char* name, bool toFile);
+    DebugLayer(const char* name, bool toFile, bool toNpyFile = false);
 
     /// Default destructor
     ~DebugLayer() = default;
 
 private:
     bool m_ToFile;
+    bool m_ToNpyFile;
 };
 
 } // namespace armnn
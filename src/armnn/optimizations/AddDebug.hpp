@@ -7,6 +7,10 @@
 #include "Optimization.hpp"
 #include "NetworkUtils.hpp"
 
+#include <algorithm>
+#include <string>
+#include <vector>
+
 namespace armnn
 {
 namespace optimizations
@@ -37,17 +41,40 @@ public:
 
     void Run(Graph& graph, Layer& layer) const
     {
-        if (layer.GetType() != LayerType::Debug && layer.GetType() != LayerType::Output)
+        if (layer.GetType() != LayerType::Debug && layer.GetType() != LayerType::Output && IsSelected(layer))
         {
             // if the inputs/outputs of this layer do not have a debug layer
             // insert the debug layer after them
-            InsertDebugLayerAfter(graph, layer, true);
+            InsertDebugLayerAfter(graph, layer, true, m_ToNpyFile);
         }
     }
 
+    AddDebugToFileImpl(bool toNpyFile, std::vector<std::string> layers)
+        : m_ToNpyFile(toNpyFile)
+        , m_Layers(std::move(layers))
+    {}
+
 protected:
     AddDebugToFileImpl() = default;
     ~AddDebugToFileImpl() = default;
+
+private:
+    /// Layers are selected by name or by GUID, or all of them when no layers are given.
+    bool IsSelected(const Layer& layer) const
+    {
+        if (m_Layers.empty())
+        {
+            return true;
+        }
+        const std::string guid = std::to_string(static_cast<uint64_t>(layer.GetGuid()));
+        return std::any_of(m_Layers.begin(), m_Layers.end(), [&](const std::string& selected)
+        {
+            return selected == layer.GetNameStr() || selected == guid;
+        });
+    }
+
+    bool m_ToNpyFile = false;
+    std::vector<std::string> m_Layers;
 };
 
 using InsertDebugLayer = OptimizeForType<Layer, AddDebugImpl>;
@@ -6,11 +6,13 @@
 
 #include "AddBroadcastReshapeLayer.hpp"
 #include "AddDebug.hpp"
+#include "CommonSubexpressionElimination.hpp"
 #include "ConvertConstants.hpp"
 #include "ConvertConstDequantisationLayersToConstLayers.hpp"
 #include "ConvertConstPermuteLayersToConstLayers.hpp"
 #include "ConvertFp32NetworkToFp16.hpp"
 #include "DeleteBroadcastTo.hpp"
+#include "FoldConstantLayers.hpp"
 #include "FoldPadIntoLayer2d.hpp"
 #include "FuseBatchNorm.hpp"
 #include "MovePermuteUp.hpp"
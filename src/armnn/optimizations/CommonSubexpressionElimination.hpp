@@ -0,0 +1,266 @@
+//
+// Copyright © 2024 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include "Optimization.hpp"
+
+#include <armnn/utility/IgnoreUnused.hpp>
+
+#include <algorithm>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace armnn
+{
+namespace optimizations
+{
+
+/// Merges layers that compute the same value: layers of the same type, with equal descriptors and output
+/// tensor infos, that are connected to the same output slots. Descriptors are compared with their operator==, so
+/// layers whose descriptor has none never take part.
+/// When two layers are merged their children may become equivalent too, so these are revisited until no more
+/// layers can be merged. The layer coming first in the graph is kept, so the topological order is preserved.
+class CommonSubexpressionEliminationImpl
+{
+public:
+    void Run(Graph& graph, Layer& layer) const
+    {
+        std::vector<Layer*> pending = { &layer };
+        while (!pending.empty())
+        {
+            Layer* current = pending.back();
+            pending.pop_back();
+
+            if (Layer* kept = SquashEquivalentSiblings(graph, *current, layer, pending))
+            {
+                // The consumers of the merged layers are now siblings and may be equivalent as well.
+                for (auto&& outputSlot : kept->GetOutputSlots())
+                {
+                    for (auto&& connection : outputSlot.GetConnections())
+                    {
+                        pending.push_back(&connection->GetOwningLayer());
+                    }
+                }
+            }
+        }
+    }
+
+protected:
+    CommonSubexpressionEliminationImpl() = default;
+    ~CommonSubexpressionEliminationImpl() = default;
+
+private:
+    enum class DescriptorComparison
+    {
+        Equal,
+        Different,
+        /// The descriptor has no operator==
+        Incomparable
+    };
+
+    template <typename LayerT, typename = void>
+    struct HasDescriptor : std::false_type {};
+
+    template <typename LayerT>
+    struct HasDescriptor<LayerT, std::void_t<typename LayerT::DescriptorType>> : std::true_type {};
+
+    template <typename Descriptor, typename = void>
+    struct IsComparable : std::false_type {};
+
+    template <typename Descriptor>
+    struct IsComparable<Descriptor, std::void_t<decltype(std::declval<Descriptor>() == std::declval<Descriptor>())>>
+        : std::true_type {};
+
+    template <LayerType Type>
+    static DescriptorComparison CompareDescriptorsOf(const Layer& layer, const Layer& other)
+    {
+        using LayerT = LayerTypeOf<Type>;
+        if constexpr (HasDescriptor<LayerT>::value)
+        {
+            using Descriptor = typename LayerT::DescriptorType;
+            if constexpr (IsComparable<Descriptor>::value)
+            {
+                return *PolymorphicDowncast<const Descriptor*>(&layer.GetParameters()) ==
+                       *PolymorphicDowncast<const Descriptor*>(&other.GetParameters()) ?
+                       DescriptorComparison::Equal : DescriptorComparison::Different;
+            }
+            else
+            {
+                IgnoreUnused(layer, other);
+                return DescriptorComparison::Incomparable;
+            }
+        }
+        else
+        {
+            IgnoreUnused(layer, other);
+            return DescriptorComparison::Equal;
+        }
+    }
+
+    /// Compares the descriptors of two layers of the same type.
+    static DescriptorComparison CompareDescriptors(const Layer& layer, const Layer& other)
+    {
+        switch (layer.GetType())
+        {
+#define X(name) case LayerType::name: return CompareDescriptorsOf<LayerType::name>(layer, other);
+            LIST_OF_LAYER_TYPE
+#undef X
+            default:
+                return DescriptorComparison::Incomparable;
+        }
+    }
+
+    static bool IsCandidate(Layer& layer)
+    {
+        switch (layer.GetType())
+        {
+            case LayerType::Constant:
+            case LayerType::Debug:
+            case LayerType::Input:
+            case LayerType::Map:
+            case LayerType::MemCopy:
+            case LayerType::MemImport:
+            case LayerType::Output:
+            case LayerType::PreCompiled:
+            case LayerType::StandIn:
+            case LayerType::Unmap:
+                return false;
+            default:
+                break;
+        }
+
+        if (layer.GetNumInputSlots() == 0 || layer.IsOutputUnconnected() ||
+            CompareDescriptors(layer, layer) == DescriptorComparison::Incomparable)
+        {
+            return false;
+        }
+
+        // Layers holding their own constant tensors (e.g. Lstm weights) are not compared by value.
+        const IConnectableLayer& connectableLayer = layer;
+        for (auto&& tensor : connectableLayer.GetConstantTensorsByRef())
+        {
+            if (tensor.get() != nullptr)
+            {
+                return false;
+            }
+        }
+
+        for (auto&& inputSlot : layer.GetInputSlots())
+        {
+            if (inputSlot.GetConnectedOutputSlot() == nullptr)
+            {
+                return false;
+            }
+        }
+
+        // Each network output keeps its own tensor, as it may be imported from or exported to user memory.
+        for (auto&& outputSlot : layer.GetOutputSlots())
+        {
+            for (auto&& connection : outputSlot.GetConnections())
+            {
+                if (connection->GetOwningLayer().GetType() == LayerType::Output)
+                {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    static bool AreEquivalent(const Layer& layer, const Layer& other)
+    {
+        if (layer.GetType() != other.GetType() ||
+            layer.GetNumInputSlots() != other.GetNumInputSlots() ||
+            layer.GetNumOutputSlots() != other.GetNumOutputSlots())
+        {
+            return false;
+        }
+
+        for (unsigned int i = 0; i < layer.GetNumInputSlots(); ++i)
+        {
+            if (layer.GetInputSlot(i).GetConnectedOutputSlot() != other.GetInputSlot(i).GetConnectedOutputSlot())
+            {
+                return false;
+            }
+        }
+
+        for (unsigned int i = 0; i < layer.GetNumOutputSlots(); ++i)
+        {
+            if (layer.GetOutputSlot(i).GetTensorInfo() != other.GetOutputSlot(i).GetTensorInfo())
+            {
+                return false;
+            }
+        }
+
+        return layer.GetBackendHint() == other.GetBackendHint() &&
+               CompareDescriptors(layer, other) == DescriptorComparison::Equal;
+    }
+
+    /// Moves the connections of the layer and of every sibling equivalent to it onto the one coming first in
+    /// the graph, and removes the others. The root layer (the one the optimizer is visiting) is only left
+    /// unconnected, for the optimizer to remove. Removed layers are dropped from the pending list.
+    /// Returns the layer that was kept, or nullptr if there was nothing to merge.
+    static Layer* SquashEquivalentSiblings(Graph& graph, Layer& layer, const Layer& root,
+                                           std::vector<Layer*>& pending)
+    {
+        if (!IsCandidate(layer))
+        {
+            return nullptr;
+        }
+
+        // Equivalent layers share all their inputs, so it's enough to look at the consumers of the first one.
+        std::vector<Layer*> equivalentLayers = { &layer };
+        for (auto&& connection : layer.GetInputSlot(0).GetConnectedOutputSlot()->GetConnections())
+        {
+            Layer* sibling = &connection->GetOwningLayer();
+            if (std::find(equivalentLayers.begin(), equivalentLayers.end(), sibling) != equivalentLayers.end())
+            {
+                continue;
+            }
+
+            if (IsCandidate(*sibling) && AreEquivalent(layer, *sibling))
+            {
+                equivalentLayers.push_back(sibling);
+            }
+        }
+
+        if (equivalentLayers.size() == 1)
+        {
+            return nullptr;
+        }
+
+        // The consumers of all the merged layers come after the first of them.
+        Layer* kept = *std::min_element(equivalentLayers.begin(), equivalentLayers.end(),
+                                        [&graph](const Layer* layerA, const Layer* layerB)
+                                        {
+                                            return graph.IsBefore(*layerA, *layerB);
+                                        });
+
+        for (Layer* equivalentLayer : equivalentLayers)
+        {
+            if (equivalentLayer == kept)
+            {
+                continue;
+            }
+
+            for (unsigned int i = 0; i < kept->GetNumOutputSlots(); ++i)
+            {
+                equivalentLayer->GetOutputSlot(i).MoveAllConnections(kept->GetOutputSlot(i));
+            }
+            if (equivalentLayer != &root)
+            {
+                pending.erase(std::remove(pending.begin(), pending.end(), equivalentLayer), pending.end());
+                graph.EraseLayer(equivalentLayer);
+            }
+        }
+        return kept;
+    }
+};
+
+using CommonSubexpressionElimination = OptimizeForType<Layer, CommonSubexpressionEliminationImpl>;
+
+} // namespace optimizations
+} // namespace armnn
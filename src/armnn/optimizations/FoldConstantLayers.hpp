@@ -0,0 +1,375 @@
+//
+// Copyright © 2024 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include "Optimization.hpp"
+
+#include <armnn/BackendRegistry.hpp>
+#include <armnn/Logging.hpp>
+#include <armnn/backends/IBackendInternal.hpp>
+#include <armnn/backends/TensorHandle.hpp>
+#include <armnn/backends/WorkloadFactory.hpp>
+#include <backendsCommon/TensorHandleFactoryRegistry.hpp>
+
+#include <cstring>
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace armnn
+{
+namespace optimizations
+{
+
+/// Evaluates layers whose inputs are all ConstantLayers once, at optimize time, using the reference backend
+/// and replaces them with ConstantLayers holding the result. Chains of constant layers are folded in a single
+/// pass as the inputs of a candidate are folded before the candidate itself.
+/// - The optimization is a no-op if the reference backend is not part of the build.
+/// - A folded result is only kept if it is no larger than maxFoldedTensorBytes, or if it does not grow the model,
+///   i.e. it is no larger than the constant data that becomes unused once the layer is folded.
+/// - Optimize() runs it unless disabled with OptimizerOptionsOpaque::SetFoldConstantLayersEnabled(), with the limit
+///   set with OptimizerOptionsOpaque::SetMaxFoldedTensorBytes().
+class FoldConstantLayersImpl
+{
+public:
+    static constexpr size_t DefaultMaxFoldedTensorBytes = 1024 * 1024;
+
+    FoldConstantLayersImpl(size_t maxFoldedTensorBytes = DefaultMaxFoldedTensorBytes)
+        : m_MaxFoldedTensorBytes(maxFoldedTensorBytes)
+        , m_Context(std::make_shared<FoldingContext>())
+    {}
+
+    void Run(Graph& graph, Layer& layer) const
+    {
+        FoldLayer(graph, layer);
+    }
+
+protected:
+    ~FoldConstantLayersImpl() = default;
+
+private:
+    /// Lazily created reference backend objects, shared between the copies of the optimization.
+    struct FoldingContext
+    {
+        bool m_Initialized = false;
+        IBackendInternalUniquePtr m_Backend;
+        TensorHandleFactoryRegistry m_Registry;
+        IBackendInternal::IWorkloadFactoryPtr m_WorkloadFactory;
+        ITensorHandleFactory* m_TensorHandleFactory = nullptr;
+        /// Layers already found to be unfoldable, so that shared ancestors are only visited once.
+        std::unordered_set<LayerGuid> m_UnfoldableLayers;
+    };
+
+    static bool IsFoldableType(LayerType type)
+    {
+        switch (type)
+        {
+            case LayerType::Constant:
+            case LayerType::Debug:
+            case LayerType::Input:
+            case LayerType::Map:
+            case LayerType::MemCopy:
+            case LayerType::MemImport:
+            case LayerType::Merge:
+            case LayerType::Output:
+            case LayerType::PreCompiled:
+            case LayerType::StandIn:
+            case LayerType::Switch:
+            case LayerType::Unmap:
+                return false;
+            default:
+                return true;
+        }
+    }
+
+    static bool IsConstantLayer(const Layer& layer)
+    {
+        return layer.GetType() == LayerType::Constant &&
+               PolymorphicDowncast<const ConstantLayer*>(&layer)->m_LayerOutput != nullptr;
+    }
+
+    bool InitializeContext() const
+    {
+        FoldingContext& context = *m_Context;
+        if (!context.m_Initialized)
+        {
+            context.m_Initialized = true;
+
+            auto& backendRegistry = BackendRegistryInstance();
+            if (!backendRegistry.IsBackendRegistered(Compute::CpuRef))
+            {
+                ARMNN_LOG(debug) << "FoldConstantLayers: the CpuRef backend is not available, "
+                                    "constant layers will not be folded.";
+                return false;
+            }
+
+            context.m_Backend = backendRegistry.GetFactory(Compute::CpuRef)();
+            context.m_WorkloadFactory = context.m_Backend->CreateWorkloadFactory(context.m_Registry);
+
+            auto handleFactoryIds = context.m_Backend->GetHandleFactoryPreferences();
+            if (!handleFactoryIds.empty())
+            {
+                context.m_TensorHandleFactory = context.m_Registry.GetFactory(handleFactoryIds.front());
+            }
+        }
+        return context.m_WorkloadFactory && context.m_TensorHandleFactory;
+    }
+
+    /// Returns false if the layer can't be folded whatever its inputs.
+    bool IsCandidate(Layer& layer) const
+    {
+        if (!IsFoldableType(layer.GetType()) || layer.GetNumInputSlots() == 0 || layer.IsOutputUnconnected())
+        {
+            return false;
+        }
+        const auto& unfoldableLayers = m_Context->m_UnfoldableLayers;
+        return unfoldableLayers.find(layer.GetGuid()) == unfoldableLayers.end();
+    }
+
+    /// Folds the layer if all of its inputs are, or can be folded into, ConstantLayers.
+    /// Returns true if the layer was folded.
+    bool FoldLayer(Graph& graph, Layer& layer) const
+    {
+        if (!IsCandidate(layer))
+        {
+            return false;
+        }
+
+        // Depth first walk of the ancestors which aren't constant yet, folding each of them in topological order, once
+        // all of its inputs are constant. The walk keeps its own stack, as chains of foldable layers can be far deeper
+        // than the call stack allows.
+        std::vector<std::pair<Layer*, unsigned int>> stack = { { &layer, 0u } };
+        while (!stack.empty())
+        {
+            Layer& current = *stack.back().first;
+            unsigned int& nextInput = stack.back().second;
+
+            Layer* parent = nullptr;
+            bool foldable = true;
+            for (; nextInput < current.GetNumInputSlots(); ++nextInput)
+            {
+                const OutputSlot* connectedOutput = current.GetInputSlot(nextInput).GetConnectedOutputSlot();
+                if (connectedOutput == nullptr)
+                {
+                    foldable = false;
+                    break;
+                }
+                Layer& input = connectedOutput->GetOwningLayer();
+                if (IsConstantLayer(input))
+                {
+                    continue;
+                }
+                if (!IsCandidate(input))
+                {
+                    foldable = false;
+                    break;
+                }
+                // Folding the parent moves its connections to a new ConstantLayer, so this slot is then connected to
+                // a constant when the walk comes back to it.
+                parent = &input;
+                break;
+            }
+
+            if (parent != nullptr)
+            {
+                stack.emplace_back(parent, 0u);
+                continue;
+            }
+
+            if (!foldable || !TryFoldLayer(graph, current))
+            {
+                // None of the layers depending on it can be folded either
+                for (auto&& entry : stack)
+                {
+                    m_Context->m_UnfoldableLayers.insert(entry.first->GetGuid());
+                }
+                return false;
+            }
+            stack.pop_back();
+        }
+        return true;
+    }
+
+    /// Folds the layer, whose inputs must all be ConstantLayers.
+    bool TryFoldLayer(Graph& graph, Layer& layer) const
+    {
+        for (auto&& outputSlot : layer.GetOutputSlots())
+        {
+            if (!outputSlot.GetTensorInfo().GetShape().AreAllDimensionsSpecified())
+            {
+                return false;
+            }
+        }
+
+        if (!IsWithinSizeLimit(layer) || !InitializeContext())
+        {
+            return false;
+        }
+
+        std::string reasonIfUnsupported;
+        if (!IWorkloadFactory::IsLayerSupported(Compute::CpuRef, layer, EmptyOptional(), reasonIfUnsupported))
+        {
+            ARMNN_LOG(debug) << "FoldConstantLayers: unable to fold layer " << layer.GetNameStr()
+                             << ": " << reasonIfUnsupported;
+            return false;
+        }
+
+        std::vector<std::shared_ptr<ConstTensorHandle>> results;
+        try
+        {
+            results = Evaluate(layer);
+        }
+        catch (const armnn::Exception& e)
+        {
+            ARMNN_LOG(debug) << "FoldConstantLayers: unable to fold layer " << layer.GetNameStr() << ": " << e.what();
+            return false;
+        }
+
+        for (unsigned int i = 0; i < layer.GetNumOutputSlots(); ++i)
+        {
+            OutputSlot& outputSlot = layer.GetOutputSlot(i);
+            if (outputSlot.GetNumConnections() == 0)
+            {
+                continue;
+            }
+
+            std::string name = "folded-" + layer.GetNameStr();
+            if (layer.GetNumOutputSlots() > 1)
+            {
+                name += ":" + std::to_string(i);
+            }
+
+            TensorInfo constantInfo = outputSlot.GetTensorInfo();
+            constantInfo.SetConstant(true);
+
+            auto constantLayer = graph.AddLayer<ConstantLayer>(name.c_str());
+            constantLayer->m_LayerOutput = results[i];
+            constantLayer->GetOutputSlot(0).SetTensorInfo(constantInfo);
+
+            // Moves connections in the folded layer's output to the new constant layer.
+            // The folded layer will be removed by the optimizer as it's left unconnected.
+            outputSlot.MoveAllConnections(constantLayer->GetOutputSlot(0));
+        }
+
+        return true;
+    }
+
+    /// Returns true if replacing the layer by its outputs keeps the model within the configured size limit.
+    bool IsWithinSizeLimit(const Layer& layer) const
+    {
+        size_t outputBytes = 0;
+        for (auto&& outputSlot : layer.GetOutputSlots())
+        {
+            outputBytes += outputSlot.GetTensorInfo().GetNumBytes();
+        }
+        if (outputBytes <= m_MaxFoldedTensorBytes)
+        {
+            return true;
+        }
+
+        // Constants only consumed by this layer are released once it is folded.
+        size_t releasedBytes = 0;
+        for (auto&& inputSlot : layer.GetInputSlots())
+        {
+            const OutputSlot* connectedOutput = inputSlot.GetConnectedOutputSlot();
+            bool exclusive = true;
+            for (auto&& connection : connectedOutput->GetConnections())
+            {
+                exclusive &= (&connection->GetOwningLayer() == &layer);
+            }
+            if (exclusive)
+            {
+                releasedBytes += connectedOutput->GetTensorInfo().GetNumBytes();
+            }
+        }
+        return outputBytes <= releasedBytes;
+    }
+
+    /// Runs the reference workload of the layer on the data of its constant inputs.
+    std::vector<std::shared_ptr<ConstTensorHandle>> Evaluate(Layer& layer) const
+    {
+        ITensorHandleFactory& handleFactory = *m_Context->m_TensorHandleFactory;
+
+        // The workload collects its tensor handles from the output handlers of the layer and its parents.
+        // These are only set for the duration of the evaluation; LoadedNetwork creates the real ones.
+        std::vector<OutputHandler*> usedHandlers;
+        auto releaseHandlers = [&usedHandlers]()
+        {
+            for (auto handler : usedHandlers)
+            {
+                handler->SetData(nullptr);
+            }
+        };
+
+        std::vector<std::shared_ptr<ConstTensorHandle>> results;
+        try
+        {
+            for (unsigned int i = 0; i < layer.GetNumInputSlots(); ++i)
+            {
+                OutputSlot* connectedOutput = layer.GetInputSlot(i).GetConnectedOutputSlot();
+                auto& constantLayer = *PolymorphicDowncast<ConstantLayer*>(&connectedOutput->GetOwningLayer());
+                OutputHandler& handler = connectedOutput->GetOutputHandler();
+                if (handler.GetData() == nullptr)
+                {
+                    auto handle = handleFactory.CreateTensorHandle(connectedOutput->GetTensorInfo(), false);
+                    handle->Allocate();
+                    std::memcpy(handle->Map(true),
+                                constantLayer.m_LayerOutput->Map(true),
+                                connectedOutput->GetTensorInfo().GetNumBytes());
+                    handle->Unmap();
+                    constantLayer.m_LayerOutput->Unmap();
+                    handler.SetData(std::move(handle));
+                    usedHandlers.push_back(&handler);
+                }
+            }
+
+            for (unsigned int i = 0; i < layer.GetNumOutputSlots(); ++i)
+            {
+                OutputSlot& outputSlot = layer.GetOutputSlot(i);
+                auto handle = handleFactory.CreateTensorHandle(outputSlot.GetTensorInfo(), false);
+                handle->Allocate();
+                OutputHandler& handler = outputSlot.GetOutputHandler();
+                handler.SetData(std::move(handle));
+                usedHandlers.push_back(&handler);
+            }
+
+            auto workload = layer.CreateWorkload(*m_Context->m_WorkloadFactory);
+            if (!workload)
+            {
+                throw RuntimeException("No workload created");
+            }
+            workload->PostAllocationConfigure();
+            workload->Execute();
+
+            for (auto&& outputSlot : layer.GetOutputSlots())
+            {
+                ITensorHandle* handle = outputSlot.GetOutputHandler().GetData();
+                TensorInfo info = outputSlot.GetTensorInfo();
+                info.SetConstant(true);
+                ConstTensor tensor(info, handle->Map(true));
+                results.push_back(std::make_shared<ScopedTensorHandle>(tensor));
+                handle->Unmap();
+            }
+        }
+        catch (...)
+        {
+            releaseHandlers();
+            throw;
+        }
+
+        releaseHandlers();
+        return results;
+    }
+
+    size_t m_MaxFoldedTensorBytes;
+    std::shared_ptr<FoldingContext> m_Context;
+};
+
+using FoldConstantLayers = OptimizeForType<Layer, FoldConstantLayersImpl>;
+
+} // namespace optimizations
+} // namespace armnn
@@ -1,5 +1,5 @@
 //
-// Copyright © 2017, 2023 Arm Ltd. All rights reserved.
+// Copyright © 2017, 2023-2024 Arm Ltd. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 
@@ -96,6 +96,55 @@ TEST_CASE("RuntimeRegisterDebugCallback")
     CHECK(slotIndexes == expectedSlotIndexes);
 }
 
+TEST_CASE("RuntimeRegisterDebugCallbackWithOtherInputShapes")
+{
+    INetworkPtr net = CreateSimpleNetwork();
+
+    IRuntime::CreationOptions options;
+    IRuntimePtr runtime(IRuntime::Create(options));
+
+    // Optimize the network with debug option, keeping it prepared for other input shapes
+    OptimizerOptionsOpaque optimizerOptions(false, true);
+    optimizerOptions.AddModelOption(BackendOptions("Global", {{"ShapeCacheSize", 2}}));
+    std::vector<BackendId> backends = { "CpuRef" };
+    IOptimizedNetworkPtr optNet = Optimize(*net, backends, runtime->GetDeviceSpec(), optimizerOptions);
+
+    NetworkId netId;
+    CHECK(runtime->LoadNetwork(netId, std::move(optNet)) == Status::Success);
+
+    std::vector<TensorShape> tensorShapes;
+    runtime->RegisterDebugCallback(netId, [&](LayerGuid, unsigned int, ITensorHandle* tensor)
+    {
+        tensorShapes.push_back(tensor->GetShape());
+    });
+
+    std::vector<float> inputData({-2, -1, 0, 1, 2, -2, -1, 0, 1, 2});
+    std::vector<float> outputData(10);
+    const TensorShape otherShape({ 1, 1, 2, 5 });
+    InputTensors inputTensors
+    {
+        {0, ConstTensor(TensorInfo(otherShape, DataType::Float32, 0.0f, 0, true), inputData.data())}
+    };
+    OutputTensors outputTensors
+    {
+        {0, Tensor(TensorInfo(otherShape, DataType::Float32), outputData.data())}
+    };
+
+    // The callback registered before the network is prepared for the other shape is called for it
+    CHECK(runtime->EnqueueWorkload(netId, inputTensors, outputTensors) == Status::Success);
+    CHECK(tensorShapes == std::vector<TensorShape>({otherShape, otherShape}));
+
+    // and so is the one registered once it is prepared
+    int callCount = 0;
+    runtime->RegisterDebugCallback(netId, [&](LayerGuid, unsigned int, ITensorHandle*)
+    {
+        callCount++;
+    });
+    CHECK(runtime->EnqueueWorkload(netId, inputTensors, outputTensors) == Status::Success);
+    CHECK(callCount == 2);
+    CHECK(tensorShapes.size() == 2);
+}
+
 } // anonymous namespace
 
 }
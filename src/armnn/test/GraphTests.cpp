@@ -71,6 +71,73 @@ TEST_CASE("TopologicalSort")
     CHECK(CheckOrder(graph, layerB, layerC));
 }
 
+TEST_CASE("TopologicalSortPlacesAddedLayers")
+{
+    armnn::Graph graph;
+
+    armnn::ActivationDescriptor activationDefaults;
+
+    // A chain of activations, large enough for added layers to be placed without sorting the whole graph.
+    std::vector<armnn::Layer*> chain = { graph.AddLayer<armnn::InputLayer>(0, "input") };
+    for (unsigned int i = 0; i < 24; ++i)
+    {
+        const std::string name = "layer" + std::to_string(i);
+        chain.push_back(graph.AddLayer<armnn::ActivationLayer>(activationDefaults, name.c_str()));
+        chain[i]->GetOutputSlot(0).Connect(chain[i + 1]->GetInputSlot(0));
+    }
+    chain.back()->GetOutputSlot(0).Connect(graph.AddLayer<armnn::OutputLayer>(0, "output")->GetInputSlot(0));
+    graph.TopologicalSort();
+
+    // Adds layerB then layerA, which go to the end of the graph, and connects them between layer3 and layer4.
+    armnn::Layer* const layerB = graph.AddLayer<armnn::ActivationLayer>(activationDefaults, "layerB");
+    armnn::Layer* const layerA = graph.AddLayer<armnn::ActivationLayer>(activationDefaults, "layerA");
+    chain[4]->GetOutputSlot(0).Disconnect(chain[5]->GetInputSlot(0));
+    chain[4]->GetOutputSlot(0).Connect(layerA->GetInputSlot(0));
+    layerA->GetOutputSlot(0).Connect(layerB->GetInputSlot(0));
+    layerB->GetOutputSlot(0).Connect(chain[5]->GetInputSlot(0));
+
+    // A constant layer added to the graph is always in a valid position.
+    armnn::Layer* const constant = graph.AddLayer<armnn::ConstantLayer>("constant");
+    armnn::Layer* const add = graph.AddLayer<armnn::ElementwiseBinaryLayer>(armnn::BinaryOperation::Add, "add");
+    chain[10]->GetOutputSlot(0).Disconnect(chain[11]->GetInputSlot(0));
+    chain[10]->GetOutputSlot(0).Connect(add->GetInputSlot(0));
+    constant->GetOutputSlot(0).Connect(add->GetInputSlot(1));
+    add->GetOutputSlot(0).Connect(chain[11]->GetInputSlot(0));
+
+    graph.TopologicalSort();
+
+    CHECK(CheckOrder(graph, chain[4], layerA));
+    CHECK(CheckOrder(graph, layerA, layerB));
+    CHECK(CheckOrder(graph, layerB, chain[5]));
+    CHECK(CheckOrder(graph, chain[10], add));
+    CHECK(CheckOrder(graph, constant, add));
+    CHECK(CheckOrder(graph, add, chain[11]));
+
+    CHECK(graph.IsBefore(*chain[4], *layerA));
+    CHECK(graph.IsBefore(*layerA, *layerB));
+    CHECK(graph.IsBefore(*layerB, *chain[5]));
+
+    // The other layers are left where they were.
+    for (unsigned int i = 0; i + 1 < chain.size(); ++i)
+    {
+        CHECK(graph.IsBefore(*chain[i], *chain[i + 1]));
+    }
+
+    // A copy of a sorted graph is sorted in the same order.
+    armnn::Graph copy(graph);
+    std::vector<std::string> names;
+    std::vector<std::string> copyNames;
+    for (auto&& layer : graph)
+    {
+        names.push_back(layer->GetNameStr());
+    }
+    for (auto&& layer : copy.TopologicalSort())
+    {
+        copyNames.push_back(layer->GetNameStr());
+    }
+    CHECK(copyNames == names);
+}
+
 TEST_CASE("InsertNewLayerBefore")
 {
     armnn::Graph graph;
@@ -1,9 +1,10 @@
 //
-// Copyright © 2017 Arm Ltd. All rights reserved.
+// Copyright © 2017, 2024 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 #include <doctest/doctest.h>
 
+#include "PerfEventCounters.hpp"
 #include "WallClockTimer.hpp"
 
 #include <chrono>
@@ -59,4 +60,47 @@ TEST_CASE("WallClockTimerInNanoseconds")
     CHECK_GE(wallClockTimer.GetMeasurements().front().m_Value, delta.count());
 }
 
+TEST_CASE("PerfEventCountersCountWork")
+{
+    if (!PerfEventCounters::IsSupported())
+    {
+        MESSAGE("No perf event counters available, skipping");
+        return;
+    }
+
+    PerfEventCounters perfEventCounters;
+
+    CHECK((std::string(perfEventCounters.GetName()) == std::string("PerfEventCounters")));
+
+    perfEventCounters.Start();
+
+    // Spin for a millisecond, so that the thread runs for long enough for every counter to tick
+    volatile unsigned int sum = 0;
+    const auto start = std::chrono::steady_clock::now();
+    while (std::chrono::steady_clock::now() - start < std::chrono::milliseconds(1))
+    {
+        sum = sum + 1;
+    }
+
+    perfEventCounters.Stop();
+
+    const std::vector<Measurement> measurements = perfEventCounters.GetMeasurements();
+    CHECK(!measurements.empty());
+    for (const Measurement& measurement : measurements)
+    {
+        CHECK_GE(measurement.m_Value, 0.0);
+        if (measurement.m_Name == PerfEventCounters::INSTRUCTIONS || measurement.m_Name == PerfEventCounters::CYCLES)
+        {
+            CHECK_GT(measurement.m_Value, 0.0);
+            CHECK(measurement.m_Unit == Measurement::Unit::COUNT);
+        }
+        else if (measurement.m_Name == PerfEventCounters::TASK_CLOCK)
+        {
+            // At least most of the millisecond was spent on the CPU
+            CHECK_GT(measurement.m_Value, 100.0);
+            CHECK(measurement.m_Unit == Measurement::Unit::TIME_US);
+        }
+    }
+}
+
 }
@@ -0,0 +1,97 @@
+//
+// Copyright © 2024 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include <Graph.hpp>
+#include <LayerSupportCache.hpp>
+
+#include <armnn/backends/WorkloadFactory.hpp>
+
+#include <doctest/doctest.h>
+
+using namespace armnn;
+
+namespace
+{
+
+Layer* AddSoftmax(Graph& graph, Layer& input, float beta, const TensorInfo& info)
+{
+    SoftmaxDescriptor descriptor;
+    descriptor.m_Beta = beta;
+    Layer* layer = graph.AddLayer<SoftmaxLayer>(descriptor, "softmax");
+    input.GetOutputSlot(0).Connect(layer->GetInputSlot(0));
+    layer->GetOutputSlot(0).SetTensorInfo(info);
+    layer->SetBackendId(Compute::CpuRef);
+    return layer;
+}
+
+} // anonymous namespace
+
+TEST_SUITE("LayerSupportCache")
+{
+
+TEST_CASE("LayerSupportCacheReusesResults")
+{
+    const TensorInfo info({ 1, 8 }, DataType::Float32);
+
+    Graph graph;
+    Layer* input = graph.AddLayer<InputLayer>(0, "input");
+    input->GetOutputSlot(0).SetTensorInfo(info);
+    input->SetBackendId(Compute::CpuRef);
+
+    Layer* first = AddSoftmax(graph, *input, 1.0f, info);
+    Layer* second = AddSoftmax(graph, *first, 1.0f, info);
+    Layer* otherBeta = AddSoftmax(graph, *second, 2.0f, info);
+
+    LayerSupportCache cache;
+    std::string reason;
+    CHECK(cache.IsLayerSupported(*first, EmptyOptional(), reason));
+    CHECK(cache.GetNumCachedResults() == 1);
+
+    // Same type, descriptor and tensor infos.
+    CHECK(cache.IsLayerSupported(*second, EmptyOptional(), reason));
+    CHECK(cache.GetNumCachedResults() == 1);
+
+    // Another descriptor, then another data type to check against.
+    CHECK(cache.IsLayerSupported(*otherBeta, EmptyOptional(), reason));
+    CHECK(cache.GetNumCachedResults() == 2);
+    CHECK(cache.IsLayerSupported(*second, DataType::Float16, reason));
+    CHECK(cache.GetNumCachedResults() == 3);
+    CHECK(reason.empty());
+}
+
+TEST_CASE("LayerSupportCacheMatchesUncachedQueries")
+{
+    // Signed 64 bit softmax isn't supported by the reference backend, so a reason is given for each query.
+    const TensorInfo info({ 1, 8 }, DataType::Signed64);
+
+    Graph graph;
+    Layer* input = graph.AddLayer<InputLayer>(0, "input");
+    input->GetOutputSlot(0).SetTensorInfo(info);
+    input->SetBackendId(Compute::CpuRef);
+    Layer* first = AddSoftmax(graph, *input, 1.0f, info);
+    Layer* second = AddSoftmax(graph, *first, 1.0f, info);
+
+    std::string expectedReason;
+    const bool expected = IWorkloadFactory::IsLayerSupported(*second, EmptyOptional(), expectedReason);
+    CHECK(!expected);
+
+    LayerSupportCache cache;
+    for (Layer* layer : { first, second })
+    {
+        std::string reason;
+        CHECK(cache.IsLayerSupported(*layer, EmptyOptional(), reason) == expected);
+        CHECK(reason == expectedReason);
+    }
+    CHECK(cache.GetNumCachedResults() == 1);
+
+    // Layers on backends which aren't registered are passed on, as are the errors for them.
+    second->SetBackendId("MissingBackend");
+    std::string reason;
+    CHECK(!cache.IsLayerSupported(*second, EmptyOptional(), reason));
+    CHECK(!reason.empty());
+    CHECK(cache.GetNumCachedResults() == 1);
+}
+
+}
@@ -1,5 +1,5 @@
 //
-// Copyright © 2017 Arm Ltd. All rights reserved.
+// Copyright © 2017, 2024 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 
@@ -345,6 +345,105 @@ TEST_CASE("WriteEventResults")
     profiler->EnableProfiling(false);
 }
 
+TEST_CASE("WriteEventResultsWithHardwareCounters")
+{
+    armnn::ProfilerManager& profilerManager = armnn::ProfilerManager::GetInstance();
+
+    std::unique_ptr<armnn::IProfiler> profiler = std::make_unique<armnn::IProfiler>();
+    profilerManager.RegisterProfiler(profiler.get());
+    profiler->EnableProfiling(true);
+    profiler->EnableHardwareCounters(true);
+
+    {
+        ARMNN_SCOPED_PROFILING_EVENT(armnn::Compute::CpuRef, "EnqueueWorkload");
+        {
+            ARMNN_SCOPED_PROFILING_EVENT(armnn::Compute::CpuRef, "Workload");
+        }
+    }
+
+    std::ostringstream report;
+    profiler->AnalyzeEventsAndWriteResults(report);
+    std::ostringstream json;
+    profiler->Print(json);
+
+    profiler->EnableProfiling(false);
+    profilerManager.RegisterProfiler(nullptr);
+
+    // The counts are reported along with the timings, but only where the platform can count something.
+    const bool supported = armnn::PerfEventCounters::IsSupported();
+    CHECK((report.str().find("Event Counters - Name") != std::string::npos) == supported);
+    if (supported)
+    {
+        CHECK(json.str().find("\"unit\": \"count\"") != std::string::npos);
+    }
+}
+
+TEST_CASE("WriteChromeTraceFromMultipleThreads")
+{
+    std::unique_ptr<armnn::IProfiler> profiler = std::make_unique<armnn::IProfiler>();
+    profiler->EnableProfiling(true);
+
+    // Inferences running at the same time on the threads of a Threadpool share the profiler of their network
+    constexpr unsigned int numThreads = 4;
+    std::vector<int> threadIds(numThreads);
+    std::vector<std::thread> threads;
+    for (unsigned int i = 0; i < numThreads; ++i)
+    {
+        threads.emplace_back([&profiler, &threadIds, i]()
+        {
+            armnn::ProfilerManager::GetInstance().RegisterProfiler(profiler.get());
+            threadIds[i] = armnn::GetEventThreadId();
+            for (int inference = 0; inference < 10; ++inference)
+            {
+                ARMNN_SCOPED_PROFILING_EVENT(armnn::Compute::Undefined, "Execute");
+                {
+                    ARMNN_SCOPED_PROFILING_EVENT_GUID(armnn::Compute::CpuRef, "Workload",
+                                                      arm::pipe::ProfilingGuid(100 + i));
+                }
+            }
+            armnn::ProfilerManager::GetInstance().RegisterProfiler(nullptr);
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    // The events of each thread are nested separately
+    std::ostringstream report;
+    profiler->AnalyzeEventsAndWriteResults(report);
+    CHECK(report.str().find("Cannot write profiling stats") == std::string::npos);
+
+    std::ostringstream trace;
+    profiler->PrintChromeTrace(trace);
+    const std::string result = trace.str();
+
+    auto count = [&result](const std::string& text)
+    {
+        size_t found = 0;
+        for (size_t pos = result.find(text); pos != std::string::npos; pos = result.find(text, pos + 1))
+        {
+            ++found;
+        }
+        return found;
+    };
+
+    CHECK(result.front() == '[');
+    CHECK(result.find("]\n") == result.size() - 2);
+    CHECK(count("{\"ph\":\"X\",\"name\":\"Execute\"") == numThreads * 10);
+    CHECK(count("{\"ph\":\"X\",\"name\":\"Workload\"") == numThreads * 10);
+    CHECK(count("{\"ph\":\"b\",\"name\":\"Inference\"") == numThreads * 10);
+    CHECK(count("{\"ph\":\"e\",\"name\":\"Inference\"") == numThreads * 10);
+    for (unsigned int i = 0; i < numThreads; ++i)
+    {
+        // Workloads are drawn on the track of the thread which ran them, along with their backend and GUID
+        const std::string track = ",\"tid\":" + std::to_string(threadIds[i]) + ",\"cat\":\"CpuRef\"";
+        const std::string args = "\"args\":{\"backend\":\"CpuRef\",\"guid\":\"" + std::to_string(100 + i) + "\"}";
+        CHECK(count(track) == 10);
+        CHECK(count(args) == 10);
+    }
+}
+
 TEST_CASE("ProfilerJsonPrinter")
 {
     class TestInstrument : public armnn::Instrument
@@ -1,5 +1,5 @@
 //
-// Copyright © 2017-2023 Arm Ltd and Contributors. All rights reserved.
+// Copyright © 2017-2024 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 
@@ -7,10 +7,14 @@
 #include <ProfilingOptionsConverter.hpp>
 #include <Runtime.hpp>
 
+#include <armnn/BackendRegistry.hpp>
 #include <armnn/Descriptors.hpp>
 #include <armnn/IRuntime.hpp>
 #include <armnn/INetwork.hpp>
+#include <armnn/LstmParams.hpp>
 
+#include <armnn/backends/IBackendContext.hpp>
+#include <armnn/backends/IBackendInternal.hpp>
 #include <armnn/profiling/ArmNNProfiling.hpp>
 
 #include <common/include/LabelsAndEventClasses.hpp>
@@ -23,23 +27,78 @@
 #endif
 
 #include <doctest/doctest.h>
-#include "RuntimeTests.hpp"
 #include <TestUtils.hpp>
 
+#include <atomic>
+#include <cmath>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <thread>
+
 #ifdef ARMNN_LEAK_CHECKING_ENABLED
 #include <HeapProfiling.hpp>
 #include <LeakChecking.hpp>
 #endif
 
-namespace armnn
+namespace
 {
 
-void RuntimeLoadedNetworksReserve(armnn::RuntimeImpl* runtime)
+/// Counts the networks the runtime tells the backends it has unloaded.
+class UnloadCountingBackendContext : public armnn::IBackendContext
 {
-    runtime->m_LoadedNetworks.reserve(1);
-}
+public:
+    UnloadCountingBackendContext(const armnn::IRuntime::CreationOptions& options,
+                                 std::shared_ptr<std::atomic<unsigned int>> numUnloads)
+        : armnn::IBackendContext(options)
+        , m_NumUnloads(std::move(numUnloads))
+    {}
+
+    bool BeforeLoadNetwork(armnn::NetworkId) override { return true; }
+    bool AfterLoadNetwork(armnn::NetworkId) override { return true; }
+    bool BeforeUnloadNetwork(armnn::NetworkId) override { return true; }
+    bool AfterEnqueueWorkload(armnn::NetworkId) override { return true; }
+
+    bool AfterUnloadNetwork(armnn::NetworkId) override
+    {
+        ++(*m_NumUnloads);
+        return true;
+    }
+
+private:
+    std::shared_ptr<std::atomic<unsigned int>> m_NumUnloads;
+};
+
+/// A backend which doesn't run anything, and only has a context counting the unloaded networks.
+class UnloadCountingBackend : public armnn::IBackendInternal
+{
+public:
+    explicit UnloadCountingBackend(std::shared_ptr<std::atomic<unsigned int>> numUnloads)
+        : m_NumUnloads(std::move(numUnloads))
+    {}
+
+    static const armnn::BackendId& GetIdStatic()
+    {
+        static const armnn::BackendId s_Id{ "UnloadCountingBackend" };
+        return s_Id;
+    }
+    const armnn::BackendId& GetId() const override { return GetIdStatic(); }
 
-} // namespace armnn
+    IWorkloadFactoryPtr CreateWorkloadFactory(const IMemoryManagerSharedPtr&) const override { return nullptr; }
+
+    ILayerSupportSharedPtr GetLayerSupport() const override { return nullptr; }
+
+    IBackendContextPtr CreateBackendContext(const armnn::IRuntime::CreationOptions& options) const override
+    {
+        return std::make_unique<UnloadCountingBackendContext>(options, m_NumUnloads);
+    }
+
+private:
+    std::shared_ptr<std::atomic<unsigned int>> m_NumUnloads;
+};
+
+} // anonymous namespace
 
 TEST_SUITE("Runtime")
 {
@@ -401,11 +460,8 @@ TEST_CASE("RuntimeMemoryLeak")
 
     armnn::NetworkId networkIdentifier1 = 1;
 
-    // ensure that runtime is large enough before checking for memory leaks
-    // otherwise when loading the network it will automatically reserve memory that won't be released until destruction
     armnn::IRuntime::CreationOptions options;
     armnn::RuntimeImpl                   runtime(options);
-    armnn::RuntimeLoadedNetworksReserve(&runtime);
 
     {
         std::vector<armnn::BackendId> backends = { armnn::Compute::CpuRef };
@@ -1547,4 +1603,579 @@ TEST_CASE("SyncExecutePreImportInputsHappyPath")
                                         std::vector<ImportedOutputId>());
     REQUIRE(ret == Status::Success);
 }
+
+TEST_CASE("EnqueueWorkloadWithOtherInputShapes")
+{
+    using namespace armnn;
+
+    IRuntime::CreationOptions options;
+    IRuntimePtr runtime(IRuntime::Create(options));
+
+    // output = ReLu(input + constant), where the constant is broadcast over the rows of the input.
+    INetworkPtr net(INetwork::Create());
+    IConnectableLayer* input = net->AddInputLayer(0);
+    std::vector<float> constantData = { 1.0f, -2.0f, 3.0f, -4.0f };
+    TensorInfo constantInfo({ 4 }, DataType::Float32, 0.0f, 0, true);
+    IConnectableLayer* constant = net->AddConstantLayer(ConstTensor(constantInfo, constantData));
+    IConnectableLayer* add = net->AddElementwiseBinaryLayer(BinaryOperation::Add);
+    ActivationDescriptor reluDesc;
+    reluDesc.m_Function = ActivationFunction::ReLu;
+    IConnectableLayer* relu = net->AddActivationLayer(reluDesc);
+    IConnectableLayer* output = net->AddOutputLayer(0);
+
+    input->GetOutputSlot(0).Connect(add->GetInputSlot(0));
+    constant->GetOutputSlot(0).Connect(add->GetInputSlot(1));
+    add->GetOutputSlot(0).Connect(relu->GetInputSlot(0));
+    relu->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+
+    input->GetOutputSlot(0).SetTensorInfo(TensorInfo({ 2, 4 }, DataType::Float32));
+    constant->GetOutputSlot(0).SetTensorInfo(constantInfo);
+    add->GetOutputSlot(0).SetTensorInfo(TensorInfo({ 2, 4 }, DataType::Float32));
+    relu->GetOutputSlot(0).SetTensorInfo(TensorInfo({ 2, 4 }, DataType::Float32));
+
+    std::vector<BackendId> backends = { Compute::CpuRef };
+    OptimizerOptionsOpaque optimizerOptions;
+    optimizerOptions.AddModelOption(BackendOptions("Global", {{"ShapeCacheSize", 2}}));
+    NetworkId netId;
+    std::string errorMessage;
+    INetworkProperties networkProperties(false, MemorySource::Undefined, MemorySource::Undefined, true);
+    REQUIRE(runtime->LoadNetwork(netId, Optimize(*net, backends, runtime->GetDeviceSpec(), optimizerOptions),
+                                 errorMessage, networkProperties) == Status::Success);
+
+    // More shapes than are cached, so plans are evicted and created again, and the loaded shape in between.
+    for (unsigned int rows : { 3u, 5u, 2u, 1u, 3u, 5u, 3u, 2u })
+    {
+        std::vector<float> inputData(rows * 4);
+        for (unsigned int i = 0; i < inputData.size(); ++i)
+        {
+            inputData[i] = static_cast<float>(i) - 3.0f;
+        }
+        std::vector<float> outputData(rows * 4, -1.0f);
+
+        InputTensors inputTensors{ { 0, ConstTensor(TensorInfo({ rows, 4 }, DataType::Float32, 0.0f, 0, true),
+                                                    inputData.data()) } };
+        OutputTensors outputTensors{ { 0, Tensor(TensorInfo({ rows, 4 }, DataType::Float32), outputData.data()) } };
+        REQUIRE(runtime->EnqueueWorkload(netId, inputTensors, outputTensors) == Status::Success);
+
+        for (unsigned int i = 0; i < outputData.size(); ++i)
+        {
+            CHECK(outputData[i] == std::max(inputData[i] + constantData[i % 4], 0.0f));
+        }
+    }
+
+    // The networks prepared for the other shapes report to the profiler of the loaded one, so every inference is
+    // there and not only the two with the loaded shape. The trace lists each event on its own.
+    std::ostringstream trace;
+    runtime->GetProfiler(netId)->PrintChromeTrace(trace);
+    size_t activations = 0;
+    for (size_t pos = trace.str().find("RefActivationWorkload_Execute"); pos != std::string::npos;
+         pos = trace.str().find("RefActivationWorkload_Execute", pos + 1))
+    {
+        ++activations;
+    }
+    CHECK(activations >= 8);
+
+    // The working memory handles of the asynchronous path are created for the loaded shapes only.
+    INetworkProperties asyncProperties(true, MemorySource::Undefined, MemorySource::Undefined);
+    NetworkId asyncNetId;
+    REQUIRE(runtime->LoadNetwork(asyncNetId, Optimize(*net, backends, runtime->GetDeviceSpec(), optimizerOptions),
+                                 errorMessage, asyncProperties) == Status::Success);
+    std::unique_ptr<IWorkingMemHandle> workingMemHandle = runtime->CreateWorkingMemHandle(asyncNetId);
+    std::vector<float> inputData(3 * 4, 1.0f);
+    std::vector<float> outputData(3 * 4);
+    InputTensors inputTensors{ { 0, ConstTensor(TensorInfo({ 3, 4 }, DataType::Float32, 0.0f, 0, true),
+                                                inputData.data()) } };
+    OutputTensors outputTensors{ { 0, Tensor(TensorInfo({ 3, 4 }, DataType::Float32), outputData.data()) } };
+    CHECK_THROWS_AS(runtime->Execute(*workingMemHandle, inputTensors, outputTensors),
+                    armnn::InvalidArgumentException);
+}
+
+TEST_CASE("EnqueueWorkloadWithOtherInputShapesBatchNormalization")
+{
+    using namespace armnn;
+
+    IRuntime::CreationOptions options;
+    IRuntimePtr runtime(IRuntime::Create(options));
+
+    // The layers holding their own constants, such as batch normalization, are copied along with them for each shape.
+    const TensorInfo paramInfo({ 2 }, DataType::Float32, 0.0f, 0, true);
+    std::vector<float> mean = { 1.0f, -1.0f };
+    std::vector<float> variance = { 4.0f, 1.0f };
+    std::vector<float> beta = { 0.5f, 0.0f };
+    std::vector<float> gamma = { 2.0f, 3.0f };
+    BatchNormalizationDescriptor batchNormDesc;
+    batchNormDesc.m_Eps = 0.0f;
+    batchNormDesc.m_DataLayout = DataLayout::NHWC;
+
+    INetworkPtr net(INetwork::Create());
+    IConnectableLayer* input = net->AddInputLayer(0);
+    IConnectableLayer* batchNorm = net->AddBatchNormalizationLayer(batchNormDesc,
+                                                                   ConstTensor(paramInfo, mean),
+                                                                   ConstTensor(paramInfo, variance),
+                                                                   ConstTensor(paramInfo, beta),
+                                                                   ConstTensor(paramInfo, gamma));
+    IConnectableLayer* output = net->AddOutputLayer(0);
+    input->GetOutputSlot(0).Connect(batchNorm->GetInputSlot(0));
+    batchNorm->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+    input->GetOutputSlot(0).SetTensorInfo(TensorInfo({ 2, 1, 1, 2 }, DataType::Float32));
+    batchNorm->GetOutputSlot(0).SetTensorInfo(TensorInfo({ 2, 1, 1, 2 }, DataType::Float32));
+
+    OptimizerOptionsOpaque optimizerOptions;
+    optimizerOptions.AddModelOption(BackendOptions("Global", {{"ShapeCacheSize", 2}}));
+    NetworkId netId;
+    std::string errorMessage;
+    INetworkProperties networkProperties(false, MemorySource::Undefined, MemorySource::Undefined);
+    REQUIRE(runtime->LoadNetwork(netId,
+                                 Optimize(*net, { Compute::CpuRef }, runtime->GetDeviceSpec(), optimizerOptions),
+                                 errorMessage, networkProperties) == Status::Success);
+
+    for (unsigned int batches : { 3u, 1u, 2u, 3u })
+    {
+        std::vector<float> inputData(batches * 2);
+        for (unsigned int i = 0; i < inputData.size(); ++i)
+        {
+            inputData[i] = static_cast<float>(i);
+        }
+        std::vector<float> outputData(batches * 2, -1.0f);
+
+        InputTensors inputTensors{ { 0, ConstTensor(TensorInfo({ batches, 1, 1, 2 }, DataType::Float32, 0.0f, 0, true),
+                                                    inputData.data()) } };
+        OutputTensors outputTensors{ { 0, Tensor(TensorInfo({ batches, 1, 1, 2 }, DataType::Float32),
+                                                 outputData.data()) } };
+        REQUIRE(runtime->EnqueueWorkload(netId, inputTensors, outputTensors) == Status::Success);
+
+        for (unsigned int i = 0; i < outputData.size(); ++i)
+        {
+            const unsigned int c = i % 2;
+            CHECK(outputData[i] == doctest::Approx(gamma[c] * (inputData[i] - mean[c]) / std::sqrt(variance[c]) +
+                                                   beta[c]));
+        }
+    }
+}
+
+TEST_CASE("EnqueueWorkloadWithOtherInputShapesLstm")
+{
+    using namespace armnn;
+
+    IRuntime::CreationOptions options;
+    IRuntimePtr runtime(IRuntime::Create(options));
+
+    // With all weights and biases 0, every gate is 0.5 and the cell input is 0, so the new cell state is half of the
+    // previous one and the output is half of its tanh.
+    const unsigned int inputSize = 2;
+    const unsigned int numUnits = 2;
+    const TensorInfo weightsInfo({ numUnits, inputSize }, DataType::Float32, 0.0f, 0, true);
+    const TensorInfo biasInfo({ numUnits }, DataType::Float32, 0.0f, 0, true);
+    std::vector<float> weightsData(numUnits * inputSize, 0.0f);
+    std::vector<float> biasData(numUnits, 0.0f);
+    const ConstTensor weights(weightsInfo, weightsData);
+    const ConstTensor bias(biasInfo, biasData);
+
+    LstmDescriptor lstmDesc;
+    lstmDesc.m_ActivationFunc = 4;
+    lstmDesc.m_CifgEnabled = true;
+    LstmInputParams params;
+    params.m_InputToForgetWeights = &weights;
+    params.m_InputToCellWeights = &weights;
+    params.m_InputToOutputWeights = &weights;
+    params.m_RecurrentToForgetWeights = &weights;
+    params.m_RecurrentToCellWeights = &weights;
+    params.m_RecurrentToOutputWeights = &weights;
+    params.m_ForgetGateBias = &bias;
+    params.m_CellBias = &bias;
+    params.m_OutputGateBias = &bias;
+
+    auto stateInfo = [](unsigned int batches, unsigned int size, bool isConstant = false)
+    {
+        return TensorInfo({ batches, size }, DataType::Float32, 0.0f, 0, isConstant);
+    };
+
+    INetworkPtr net(INetwork::Create());
+    IConnectableLayer* input = net->AddInputLayer(0);
+    IConnectableLayer* outputStateIn = net->AddInputLayer(1);
+    IConnectableLayer* cellStateIn = net->AddInputLayer(2);
+    IConnectableLayer* lstm = net->AddLstmLayer(lstmDesc, params);
+    input->GetOutputSlot(0).Connect(lstm->GetInputSlot(0));
+    outputStateIn->GetOutputSlot(0).Connect(lstm->GetInputSlot(1));
+    cellStateIn->GetOutputSlot(0).Connect(lstm->GetInputSlot(2));
+    input->GetOutputSlot(0).SetTensorInfo(stateInfo(2, inputSize));
+    outputStateIn->GetOutputSlot(0).SetTensorInfo(stateInfo(2, numUnits));
+    cellStateIn->GetOutputSlot(0).SetTensorInfo(stateInfo(2, numUnits));
+    // Scratch buffer, output state, cell state and output.
+    for (unsigned int i = 0; i < 4; ++i)
+    {
+        lstm->GetOutputSlot(i).SetTensorInfo(stateInfo(2, i == 0 ? numUnits * 3 : numUnits));
+        lstm->GetOutputSlot(i).Connect(net->AddOutputLayer(static_cast<LayerBindingId>(i))->GetInputSlot(0));
+    }
+
+    OptimizerOptionsOpaque optimizerOptions;
+    optimizerOptions.AddModelOption(BackendOptions("Global", {{"ShapeCacheSize", 2}}));
+    NetworkId netId;
+    std::string errorMessage;
+    INetworkProperties networkProperties(false, MemorySource::Undefined, MemorySource::Undefined);
+    REQUIRE(runtime->LoadNetwork(netId,
+                                 Optimize(*net, { Compute::CpuRef }, runtime->GetDeviceSpec(), optimizerOptions),
+                                 errorMessage, networkProperties) == Status::Success);
+
+    for (unsigned int batches : { 3u, 1u, 2u, 3u })
+    {
+        std::vector<float> inputData(batches * inputSize, 1.0f);
+        std::vector<float> outputStateData(batches * numUnits, 0.0f);
+        std::vector<float> cellStateData(batches * numUnits);
+        for (unsigned int i = 0; i < cellStateData.size(); ++i)
+        {
+            cellStateData[i] = static_cast<float>(i) - 2.0f;
+        }
+        std::vector<float> scratchOut(batches * numUnits * 3);
+        std::vector<float> outputStateOut(batches * numUnits);
+        std::vector<float> cellStateOut(batches * numUnits);
+        std::vector<float> outputData(batches * numUnits);
+
+        InputTensors inputTensors{ { 0, ConstTensor(stateInfo(batches, inputSize, true), inputData.data()) },
+                                   { 1, ConstTensor(stateInfo(batches, numUnits, true), outputStateData.data()) },
+                                   { 2, ConstTensor(stateInfo(batches, numUnits, true), cellStateData.data()) } };
+        OutputTensors outputTensors{ { 0, Tensor(stateInfo(batches, numUnits * 3), scratchOut.data()) },
+                                     { 1, Tensor(stateInfo(batches, numUnits), outputStateOut.data()) },
+                                     { 2, Tensor(stateInfo(batches, numUnits), cellStateOut.data()) },
+                                     { 3, Tensor(stateInfo(batches, numUnits), outputData.data()) } };
+        REQUIRE(runtime->EnqueueWorkload(netId, inputTensors, outputTensors) == Status::Success);
+
+        for (unsigned int i = 0; i < outputData.size(); ++i)
+        {
+            CHECK(cellStateOut[i] == doctest::Approx(0.5f * cellStateData[i]));
+            CHECK(outputData[i] == doctest::Approx(0.5f * std::tanh(0.5f * cellStateData[i])));
+        }
+    }
+}
+
+TEST_CASE("LoadRebuiltOptimizedNetwork")
+{
+    using namespace armnn;
+
+    IRuntime::CreationOptions options;
+    IRuntimePtr runtime(IRuntime::Create(options));
+
+    // Builds input -> ReLu -> output, with a copy of the ReLu output in between when asked to.
+    auto buildNetwork = [](bool addMemCopy)
+    {
+        INetworkPtr net(INetwork::Create());
+        IConnectableLayer* input = net->AddInputLayer(0, "input");
+        ActivationDescriptor reluDesc;
+        reluDesc.m_Function = ActivationFunction::ReLu;
+        IConnectableLayer* relu = net->AddActivationLayer(reluDesc, "relu");
+        IConnectableLayer* output = net->AddOutputLayer(0, "output");
+
+        const TensorInfo info({ 1, 4 }, DataType::Float32);
+        input->GetOutputSlot(0).Connect(relu->GetInputSlot(0));
+        input->GetOutputSlot(0).SetTensorInfo(info);
+        relu->GetOutputSlot(0).SetTensorInfo(info);
+        if (addMemCopy)
+        {
+            IConnectableLayer* memCopy = net->AddMemCopyLayer("memCopy");
+            relu->GetOutputSlot(0).Connect(memCopy->GetInputSlot(0));
+            memCopy->GetOutputSlot(0).SetTensorInfo(info);
+            memCopy->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+        }
+        else
+        {
+            relu->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+        }
+        return net;
+    };
+
+    // Takes the placement of each layer of the optimized network, by name.
+    class PlacementCollector : public IStrategy
+    {
+    public:
+        explicit PlacementCollector(const IOptimizedNetwork& optNet) : m_OptNet(optNet) {}
+
+        void ExecuteStrategy(const IConnectableLayer* layer,
+                             const BaseDescriptor&,
+                             const std::vector<ConstTensor>&,
+                             const char* name,
+                             const LayerBindingId) override
+        {
+            m_Placements[name] = m_OptNet.GetLayerPlacement(*layer);
+        }
+
+        const IOptimizedNetwork& m_OptNet;
+        std::map<std::string, OptimizedLayerPlacement> m_Placements;
+    };
+
+    IOptimizedNetworkPtr optNet = Optimize(*buildNetwork(false), { Compute::CpuRef }, runtime->GetDeviceSpec());
+    PlacementCollector collector(*optNet);
+    optNet->ExecuteStrategy(collector);
+    REQUIRE(collector.m_Placements.size() == 3);
+    CHECK(collector.m_Placements["relu"].m_BackendId == Compute::CpuRef);
+    CHECK(collector.m_Placements["relu"].m_InputEdgeStrategies.size() == 1);
+    CHECK(collector.m_Placements["relu"].m_OutputTensorHandleFactoryIds.size() == 1);
+
+    // The copy is placed on the same backend as the layer before it.
+    collector.m_Placements["memCopy"] = collector.m_Placements["relu"];
+    INetworkPtr rebuilt = buildNetwork(true);
+    class GuidMapper : public IStrategy
+    {
+    public:
+        explicit GuidMapper(const std::map<std::string, OptimizedLayerPlacement>& byName) : m_ByName(byName) {}
+
+        void ExecuteStrategy(const IConnectableLayer* layer,
+                             const BaseDescriptor&,
+                             const std::vector<ConstTensor>&,
+                             const char* name,
+                             const LayerBindingId) override
+        {
+            m_Placements[layer->GetGuid()] = m_ByName.at(name);
+        }
+
+        const std::map<std::string, OptimizedLayerPlacement>& m_ByName;
+        OptimizedLayerPlacements m_Placements;
+    };
+    GuidMapper mapper(collector.m_Placements);
+    rebuilt->ExecuteStrategy(mapper);
+
+    // Every layer needs a placement.
+    OptimizedLayerPlacements incomplete = mapper.m_Placements;
+    incomplete.erase(incomplete.begin());
+    CHECK_THROWS_AS((CreateOptimizedNetwork(*rebuilt, incomplete)), armnn::InvalidArgumentException);
+
+    // The activation a backend fused into a layer is kept along with it.
+    CHECK(!collector.m_Placements["relu"].m_FusedActivation);
+    ActivationDescriptor fusedActivation;
+    fusedActivation.m_Function = ActivationFunction::BoundedReLu;
+    fusedActivation.m_A = 6.0f;
+    OptimizedLayerPlacements fusedPlacements = mapper.m_Placements;
+    for (auto&& placement : fusedPlacements)
+    {
+        placement.second.m_FusedActivation = std::make_shared<ActivationDescriptor>(fusedActivation);
+    }
+    IOptimizedNetworkPtr fusedNet = CreateOptimizedNetwork(*rebuilt, fusedPlacements);
+    PlacementCollector fusedCollector(*fusedNet);
+    fusedNet->ExecuteStrategy(fusedCollector);
+    REQUIRE(fusedCollector.m_Placements["relu"].m_FusedActivation);
+    CHECK(*fusedCollector.m_Placements["relu"].m_FusedActivation == fusedActivation);
+
+    NetworkId netId;
+    REQUIRE(runtime->LoadNetwork(netId, CreateOptimizedNetwork(*rebuilt, mapper.m_Placements)) == Status::Success);
+
+    std::vector<float> inputData = { -1.0f, 2.0f, -3.0f, 4.0f };
+    std::vector<float> outputData(4, -1.0f);
+    InputTensors inputTensors{ { 0, ConstTensor(TensorInfo({ 1, 4 }, DataType::Float32, 0.0f, 0, true),
+                                                inputData.data()) } };
+    OutputTensors outputTensors{ { 0, Tensor(TensorInfo({ 1, 4 }, DataType::Float32), outputData.data()) } };
+    REQUIRE(runtime->EnqueueWorkload(netId, inputTensors, outputTensors) == Status::Success);
+    CHECK(outputData == std::vector<float>({ 0.0f, 2.0f, 0.0f, 4.0f }));
+}
+
+TEST_CASE("LoadUnloadNetworksWhileRunningInferences")
+{
+    using namespace armnn;
+
+    IRuntime::CreationOptions options;
+    IRuntimePtr runtime(IRuntime::Create(options));
+
+    const TensorInfo tensorInfo({ 1, 16 }, DataType::Float32);
+    std::vector<BackendId> backends = { Compute::CpuRef };
+
+    // output = scale * input
+    auto loadNetwork = [&](float scale)
+    {
+        INetworkPtr net(INetwork::Create());
+        IConnectableLayer* input = net->AddInputLayer(0);
+        ActivationDescriptor linearDesc;
+        linearDesc.m_Function = ActivationFunction::Linear;
+        linearDesc.m_A = scale;
+        IConnectableLayer* linear = net->AddActivationLayer(linearDesc);
+        IConnectableLayer* output = net->AddOutputLayer(0);
+        input->GetOutputSlot(0).Connect(linear->GetInputSlot(0));
+        linear->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+        input->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+        linear->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+
+        NetworkId netId;
+        Status status = runtime->LoadNetwork(netId, Optimize(*net, backends, runtime->GetDeviceSpec()));
+        return std::make_pair(status, netId);
+    };
+
+    // Whether running the network gives the expected outputs
+    auto runInference = [&](NetworkId netId, float scale)
+    {
+        std::vector<float> inputData(tensorInfo.GetNumElements());
+        for (unsigned int i = 0; i < inputData.size(); ++i)
+        {
+            inputData[i] = static_cast<float>(i);
+        }
+        std::vector<float> outputData(tensorInfo.GetNumElements(), -1.0f);
+
+        TensorInfo inputInfo = tensorInfo;
+        inputInfo.SetConstant(true);
+        InputTensors inputTensors{ { 0, ConstTensor(inputInfo, inputData.data()) } };
+        OutputTensors outputTensors{ { 0, Tensor(tensorInfo, outputData.data()) } };
+        if (runtime->EnqueueWorkload(netId, inputTensors, outputTensors) != Status::Success)
+        {
+            return false;
+        }
+        for (unsigned int i = 0; i < outputData.size(); ++i)
+        {
+            if (outputData[i] != inputData[i] * scale)
+            {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    // A network for each thread, as networks run by EnqueueWorkload can't be shared between threads
+    constexpr unsigned int numThreads = 8;
+    std::vector<NetworkId> netIds;
+    for (unsigned int i = 0; i < numThreads; ++i)
+    {
+        auto loaded = loadNetwork(static_cast<float>(i + 1));
+        REQUIRE(loaded.first == Status::Success);
+        netIds.push_back(loaded.second);
+    }
+
+    // Doctest assertions aren't thread safe, so the threads count the failures instead
+    std::atomic<bool> stop(false);
+    std::atomic<unsigned int> numFailures(0);
+    std::vector<std::atomic<unsigned int>> numInferences(numThreads);
+    std::vector<std::thread> threads;
+    for (unsigned int i = 0; i < numThreads; ++i)
+    {
+        threads.emplace_back([&, i]()
+        {
+            while (!stop.load())
+            {
+                if (!runInference(netIds[i], static_cast<float>(i + 1)))
+                {
+                    ++numFailures;
+                }
+                ++numInferences[i];
+            }
+        });
+    }
+
+    // Models being swapped while the other networks keep running
+    std::vector<unsigned int> numInferencesBefore(numThreads);
+    for (unsigned int i = 0; i < numThreads; ++i)
+    {
+        numInferencesBefore[i] = numInferences[i].load();
+    }
+    for (unsigned int swap = 0; swap < 20; ++swap)
+    {
+        const float scale = 100.0f + static_cast<float>(swap);
+        auto loaded = loadNetwork(scale);
+        CHECK(loaded.first == Status::Success);
+        CHECK(std::find(netIds.begin(), netIds.end(), loaded.second) == netIds.end());
+        CHECK(runInference(loaded.second, scale));
+        CHECK(runtime->UnloadNetwork(loaded.second) == Status::Success);
+        CHECK(runtime->UnloadNetwork(loaded.second) == Status::Failure);
+    }
+
+    // Every thread keeps running inferences while networks are loaded and unloaded
+    for (unsigned int i = 0; i < numThreads; ++i)
+    {
+        while (numInferences[i].load() == numInferencesBefore[i])
+        {
+            std::this_thread::yield();
+        }
+    }
+    stop = true;
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    CHECK(numFailures.load() == 0);
+
+    for (NetworkId netId : netIds)
+    {
+        CHECK(runtime->UnloadNetwork(netId) == Status::Success);
+    }
+}
+
+TEST_CASE("UnloadNetworkWhileRunningInference")
+{
+    using namespace armnn;
+
+    auto numUnloads = std::make_shared<std::atomic<unsigned int>>(0);
+    BackendRegistryInstance().Register(UnloadCountingBackend::GetIdStatic(), [numUnloads]()
+    {
+        return std::make_unique<UnloadCountingBackend>(numUnloads);
+    });
+
+    {
+        IRuntime::CreationOptions options;
+        IRuntimePtr runtime(IRuntime::Create(options));
+
+        // output = 2 * input, with debug layers so that the inference can be held up in the debug callback
+        const TensorInfo tensorInfo({ 1, 4 }, DataType::Float32);
+        INetworkPtr net(INetwork::Create());
+        IConnectableLayer* input = net->AddInputLayer(0);
+        ActivationDescriptor linearDesc;
+        linearDesc.m_Function = ActivationFunction::Linear;
+        linearDesc.m_A = 2.0f;
+        IConnectableLayer* linear = net->AddActivationLayer(linearDesc);
+        IConnectableLayer* output = net->AddOutputLayer(0);
+        input->GetOutputSlot(0).Connect(linear->GetInputSlot(0));
+        linear->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+        input->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+        linear->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+
+        OptimizerOptionsOpaque optimizerOptions(false, true);
+        std::vector<BackendId> backends = { Compute::CpuRef };
+        NetworkId netId;
+        REQUIRE(runtime->LoadNetwork(netId, Optimize(*net, backends, runtime->GetDeviceSpec(), optimizerOptions))
+                == Status::Success);
+
+        // The first debug layer waits for the network to be unloaded
+        std::mutex mutex;
+        std::condition_variable condition;
+        bool running = false;
+        bool unloaded = false;
+        runtime->RegisterDebugCallback(netId, [&](LayerGuid, unsigned int, ITensorHandle*)
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            running = true;
+            condition.notify_all();
+            condition.wait(lock, [&] { return unloaded; });
+        });
+
+        std::vector<float> inputData({ -2.0f, -1.0f, 1.0f, 2.0f });
+        std::vector<float> outputData(4);
+        TensorInfo inputInfo = tensorInfo;
+        inputInfo.SetConstant(true);
+        InputTensors inputTensors{ { 0, ConstTensor(inputInfo, inputData.data()) } };
+        OutputTensors outputTensors{ { 0, Tensor(tensorInfo, outputData.data()) } };
+
+        Status inferenceStatus = Status::Failure;
+        std::thread inference([&]()
+        {
+            inferenceStatus = runtime->EnqueueWorkload(netId, inputTensors, outputTensors);
+        });
+
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            condition.wait(lock, [&] { return running; });
+        }
+
+        // The network is unloaded straight away, but it is only freed, and the backends told about it, once the
+        // inference is done
+        CHECK(runtime->UnloadNetwork(netId) == Status::Success);
+        CHECK(runtime->UnloadNetwork(netId) == Status::Failure);
+        CHECK(numUnloads->load() == 0);
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            unloaded = true;
+            condition.notify_all();
+        }
+        inference.join();
+
+        CHECK(inferenceStatus == Status::Success);
+        CHECK(outputData == std::vector<float>({ -4.0f, -2.0f, 2.0f, 4.0f }));
+        CHECK(numUnloads->load() == 1);
+    }
+
+    BackendRegistryInstance().Deregister(UnloadCountingBackend::GetIdStatic());
+}
+
 }
@@ -0,0 +1,573 @@
+//
+// Copyright © 2024 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#if !defined(ARMNN_DISABLE_THREADS)
+
+#include <armnn/Descriptors.hpp>
+#include <armnn/IAsyncExecutionCallback.hpp>
+#include <armnn/INetwork.hpp>
+#include <armnn/IRuntime.hpp>
+#include <armnn/IWorkingMemHandle.hpp>
+#include <armnn/Threadpool.hpp>
+#include <armnn/utility/Timer.hpp>
+
+#include <AsyncExecutionCallback.hpp>
+
+#include <doctest/doctest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+TEST_SUITE("ThreadpoolTests")
+{
+using namespace armnn;
+using namespace armnn::experimental;
+
+namespace
+{
+
+const TensorInfo g_TensorInfo({ 1, 16 }, DataType::Float32);
+
+/// Loads a network computing output = scale * input for asynchronous execution
+NetworkId LoadLinearNetwork(IRuntime& runtime, float scale)
+{
+    INetworkPtr net(INetwork::Create());
+    IConnectableLayer* input = net->AddInputLayer(0);
+    ActivationDescriptor linearDesc;
+    linearDesc.m_Function = ActivationFunction::Linear;
+    linearDesc.m_A = scale;
+    IConnectableLayer* linear = net->AddActivationLayer(linearDesc);
+    IConnectableLayer* output = net->AddOutputLayer(0);
+    input->GetOutputSlot(0).Connect(linear->GetInputSlot(0));
+    linear->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+    input->GetOutputSlot(0).SetTensorInfo(g_TensorInfo);
+    linear->GetOutputSlot(0).SetTensorInfo(g_TensorInfo);
+
+    std::vector<BackendId> backends = { Compute::CpuRef };
+    NetworkId networkId;
+    std::string errorMessage;
+    const INetworkProperties networkProperties(true, MemorySource::Undefined, MemorySource::Undefined);
+    REQUIRE(runtime.LoadNetwork(networkId, Optimize(*net, backends, runtime.GetDeviceSpec()),
+                                errorMessage, networkProperties) == Status::Success);
+    return networkId;
+}
+
+std::vector<std::shared_ptr<IWorkingMemHandle>> CreateMemHandles(IRuntime& runtime,
+                                                                 NetworkId networkId,
+                                                                 unsigned int numMemHandles)
+{
+    std::vector<std::shared_ptr<IWorkingMemHandle>> memHandles;
+    for (unsigned int i = 0; i < numMemHandles; ++i)
+    {
+        memHandles.emplace_back(runtime.CreateWorkingMemHandle(networkId));
+    }
+    return memHandles;
+}
+
+/// The input, output and expected output of an inference
+struct Inference
+{
+    Inference(NetworkId networkId, float scale)
+        : m_NetworkId(networkId)
+        , m_InputData(g_TensorInfo.GetNumElements())
+        , m_OutputData(g_TensorInfo.GetNumElements(), -1.0f)
+        , m_ExpectedOutputData(g_TensorInfo.GetNumElements())
+    {
+        for (unsigned int i = 0; i < m_InputData.size(); ++i)
+        {
+            m_InputData[i] = static_cast<float>(i) + scale;
+            m_ExpectedOutputData[i] = m_InputData[i] * scale;
+        }
+        TensorInfo inputInfo = g_TensorInfo;
+        inputInfo.SetConstant(true);
+        m_InputTensors = { { 0, ConstTensor(inputInfo, m_InputData.data()) } };
+        m_OutputTensors = { { 0, Tensor(g_TensorInfo, m_OutputData.data()) } };
+    }
+
+    NetworkId m_NetworkId;
+    std::vector<float> m_InputData;
+    std::vector<float> m_OutputData;
+    std::vector<float> m_ExpectedOutputData;
+    InputTensors m_InputTensors;
+    OutputTensors m_OutputTensors;
+};
+
+#if defined(__linux__)
+/// Records the CPU the callback is notified on, which is the CPU of the thread which ran the inference
+class CpuRecordingCallback : public IAsyncExecutionCallback
+{
+public:
+    void Notify(Status status, InferenceTimingPair) override
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Statuses.push_back(status);
+        m_Cpus.push_back(sched_getcpu());
+        m_Notified.notify_all();
+    }
+
+    void WaitForNotifications(size_t count)
+    {
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        m_Notified.wait(lock, [&] { return m_Statuses.size() >= count; });
+    }
+
+    std::mutex m_Mutex;
+    std::condition_variable m_Notified;
+    std::vector<Status> m_Statuses;
+    std::vector<int> m_Cpus;
+};
+#endif
+
+/// Holds up the thread which runs its inference until it is released, so that the inferences scheduled in the meantime
+/// queue up
+class BlockingCallback : public IAsyncExecutionCallback
+{
+public:
+    void Notify(Status, InferenceTimingPair) override
+    {
+        Block();
+    }
+
+    void WaitUntilBlocking()
+    {
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        m_Changed.wait(lock, [this] { return m_Blocking; });
+    }
+
+    void Release()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_Released = true;
+        }
+        m_Changed.notify_all();
+    }
+
+protected:
+    void Block()
+    {
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        m_Blocking = true;
+        m_Changed.notify_all();
+        m_Changed.wait(lock, [this] { return m_Released; });
+    }
+
+private:
+    std::mutex m_Mutex;
+    std::condition_variable m_Changed;
+    bool m_Blocking = false;
+    bool m_Released = false;
+};
+
+/// Holds up the thread which runs its inference before the inference starts, keeping the working memory handle it
+/// acquired, until it is released. The notification of the end of the inference is passed on to another callback
+class HandleHoldingCallback : public BlockingCallback
+{
+public:
+    explicit HandleHoldingCallback(std::shared_ptr<IAsyncExecutionCallback> callback)
+        : m_Callback(std::move(callback))
+    {}
+
+    void NotifyQueueingTime(InferenceTimingPair) override
+    {
+        Block();
+    }
+
+    void Notify(Status status, InferenceTimingPair timeTaken) override
+    {
+        m_Callback->Notify(status, timeTaken);
+    }
+
+private:
+    std::shared_ptr<IAsyncExecutionCallback> m_Callback;
+};
+
+/// Records the order in which the inferences are run, by the index given to their callback
+class RunOrder
+{
+public:
+    class Callback : public IAsyncExecutionCallback
+    {
+    public:
+        Callback(RunOrder& runOrder, unsigned int index)
+            : m_RunOrder(runOrder)
+            , m_Index(index)
+        {}
+
+        void Notify(Status status, InferenceTimingPair) override
+        {
+            m_RunOrder.Add(m_Index, status);
+        }
+
+    private:
+        RunOrder& m_RunOrder;
+        unsigned int m_Index;
+    };
+
+    std::shared_ptr<IAsyncExecutionCallback> GetNewCallback(unsigned int index)
+    {
+        return std::make_shared<Callback>(*this, index);
+    }
+
+    std::vector<unsigned int> WaitForAll(size_t count)
+    {
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        m_Added.wait(lock, [&] { return m_Indices.size() >= count; });
+        return m_Indices;
+    }
+
+    unsigned int GetNumFailures()
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        return m_NumFailures;
+    }
+
+private:
+    void Add(unsigned int index, Status status)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_Indices.push_back(index);
+            m_NumFailures += status == Status::Success ? 0 : 1;
+        }
+        m_Added.notify_all();
+    }
+
+    std::mutex m_Mutex;
+    std::condition_variable m_Added;
+    std::vector<unsigned int> m_Indices;
+    unsigned int m_NumFailures = 0;
+};
+
+} // anonymous namespace
+
+TEST_CASE("ThreadpoolRunsInferencesWithFewerMemHandlesThanThreads")
+{
+    IRuntimePtr runtime(IRuntime::Create(IRuntime::CreationOptions()));
+    NetworkId networkId = LoadLinearNetwork(*runtime, 2.0f);
+
+    // The inferences share a single working memory handle between the threads
+    constexpr unsigned int numThreads = 4;
+    Threadpool threadpool(numThreads, runtime.get(), CreateMemHandles(*runtime, networkId, 1));
+    AsyncCallbackManager callbackManager;
+
+    constexpr unsigned int numInferences = 32;
+    std::vector<std::unique_ptr<Inference>> inferences;
+    for (unsigned int i = 0; i < numInferences; ++i)
+    {
+        inferences.emplace_back(std::make_unique<Inference>(networkId, 2.0f));
+        threadpool.Schedule(networkId,
+                            inferences.back()->m_InputTensors,
+                            inferences.back()->m_OutputTensors,
+                            static_cast<QosExecPriority>(i % 3),
+                            callbackManager.GetNewCallback());
+    }
+
+    for (unsigned int i = 0; i < numInferences; ++i)
+    {
+        auto cb = callbackManager.GetNotifiedCallback();
+        CHECK(cb->GetStatus() == Status::Success);
+        CHECK(cb->GetStartTime() <= cb->GetEndTime());
+    }
+    for (auto& inference : inferences)
+    {
+        CHECK(inference->m_OutputData == inference->m_ExpectedOutputData);
+    }
+}
+
+TEST_CASE("ThreadpoolRunsInferencesOfSeveralNetworks")
+{
+    IRuntimePtr runtime(IRuntime::Create(IRuntime::CreationOptions()));
+    NetworkId firstNetworkId = LoadLinearNetwork(*runtime, 2.0f);
+    NetworkId secondNetworkId = LoadLinearNetwork(*runtime, 3.0f);
+
+    Threadpool threadpool(3, runtime.get(), CreateMemHandles(*runtime, firstNetworkId, 2));
+    threadpool.LoadMemHandles(CreateMemHandles(*runtime, secondNetworkId, 1));
+    // Handles of a network which already has some are added to its pool
+    threadpool.LoadMemHandles(CreateMemHandles(*runtime, secondNetworkId, 1));
+
+    AsyncCallbackManager callbackManager;
+    constexpr unsigned int numInferences = 64;
+    std::vector<std::unique_ptr<Inference>> inferences;
+    for (unsigned int i = 0; i < numInferences; ++i)
+    {
+        const bool first = i % 2 == 0;
+        inferences.emplace_back(std::make_unique<Inference>(first ? firstNetworkId : secondNetworkId,
+                                                            first ? 2.0f : 3.0f));
+        threadpool.Schedule(inferences.back()->m_NetworkId,
+                            inferences.back()->m_InputTensors,
+                            inferences.back()->m_OutputTensors,
+                            QosExecPriority::Medium,
+                            callbackManager.GetNewCallback());
+    }
+
+    for (unsigned int i = 0; i < numInferences; ++i)
+    {
+        CHECK(callbackManager.GetNotifiedCallback()->GetStatus() == Status::Success);
+    }
+    for (auto& inference : inferences)
+    {
+        CHECK(inference->m_OutputData == inference->m_ExpectedOutputData);
+    }
+}
+
+TEST_CASE("ThreadpoolRunsOtherNetworksWhileANetworkHasNoFreeMemHandle")
+{
+    IRuntimePtr runtime(IRuntime::Create(IRuntime::CreationOptions()));
+    NetworkId firstNetworkId = LoadLinearNetwork(*runtime, 2.0f);
+    NetworkId secondNetworkId = LoadLinearNetwork(*runtime, 3.0f);
+
+    Threadpool threadpool(2, runtime.get(), CreateMemHandles(*runtime, firstNetworkId, 1));
+    threadpool.LoadMemHandles(CreateMemHandles(*runtime, secondNetworkId, 1));
+
+    // Holds the only handle of the first network
+    RunOrder runOrder;
+    Inference blockingInference(firstNetworkId, 2.0f);
+    auto blockingCallback = std::make_shared<HandleHoldingCallback>(runOrder.GetNewCallback(2));
+    threadpool.Schedule(firstNetworkId, blockingInference.m_InputTensors, blockingInference.m_OutputTensors,
+                        QosExecPriority::Medium, blockingCallback);
+    blockingCallback->WaitUntilBlocking();
+
+    // The other thread passes over the inference of the first network, which can't start, rather than waiting for
+    // its handle with the inference of the second network queued behind it
+    Inference firstInference(firstNetworkId, 2.0f);
+    Inference secondInference(secondNetworkId, 3.0f);
+    threadpool.Schedule(firstNetworkId, firstInference.m_InputTensors, firstInference.m_OutputTensors,
+                        QosExecPriority::High, runOrder.GetNewCallback(0));
+    threadpool.Schedule(secondNetworkId, secondInference.m_InputTensors, secondInference.m_OutputTensors,
+                        QosExecPriority::Low, runOrder.GetNewCallback(1));
+    CHECK(runOrder.WaitForAll(1) == std::vector<unsigned int>{ 1 });
+
+    blockingCallback->Release();
+    std::vector<unsigned int> order = runOrder.WaitForAll(3);
+    std::sort(order.begin() + 1, order.end());
+    CHECK(order == std::vector<unsigned int>{ 1, 0, 2 });
+    CHECK(runOrder.GetNumFailures() == 0);
+    CHECK(blockingInference.m_OutputData == blockingInference.m_ExpectedOutputData);
+    CHECK(firstInference.m_OutputData == firstInference.m_ExpectedOutputData);
+    CHECK(secondInference.m_OutputData == secondInference.m_ExpectedOutputData);
+}
+
+TEST_CASE("ThreadpoolScheduleOnUnknownNetworkThrows")
+{
+    IRuntimePtr runtime(IRuntime::Create(IRuntime::CreationOptions()));
+    NetworkId networkId = LoadLinearNetwork(*runtime, 2.0f);
+
+    Threadpool threadpool(2, runtime.get(), CreateMemHandles(*runtime, networkId, 1));
+    AsyncCallbackManager callbackManager;
+    Inference inference(networkId, 2.0f);
+
+    CHECK_THROWS_AS(threadpool.Schedule(networkId + 1, inference.m_InputTensors, inference.m_OutputTensors,
+                                        QosExecPriority::Medium, callbackManager.GetNewCallback()),
+                    armnn::RuntimeException);
+    CHECK_THROWS_AS(threadpool.LoadMemHandles({}), armnn::RuntimeException);
+
+    threadpool.UnloadMemHandles(networkId);
+    CHECK_THROWS_AS(threadpool.Schedule(networkId, inference.m_InputTensors, inference.m_OutputTensors,
+                                        QosExecPriority::Medium, callbackManager.GetNewCallback()),
+                    armnn::RuntimeException);
+    CHECK_THROWS_AS(threadpool.UnloadMemHandles(networkId), armnn::RuntimeException);
+}
+
+TEST_CASE("ThreadpoolRunsEarliestDeadlineFirst")
+{
+    IRuntimePtr runtime(IRuntime::Create(IRuntime::CreationOptions()));
+    NetworkId networkId = LoadLinearNetwork(*runtime, 2.0f);
+
+    Threadpool threadpool(1, runtime.get(), CreateMemHandles(*runtime, networkId, 1), {},
+                          SchedulingPolicy::EarliestDeadlineFirst);
+
+    Inference blockingInference(networkId, 2.0f);
+    auto blockingCallback = std::make_shared<BlockingCallback>();
+    threadpool.Schedule(networkId, blockingInference.m_InputTensors, blockingInference.m_OutputTensors,
+                        QosExecPriority::High, blockingCallback);
+    blockingCallback->WaitUntilBlocking();
+
+    // Deadlines in a different order than the inferences are scheduled in, far enough away to be met
+    const std::vector<unsigned int> deadlineOrder = { 3, 0, 4, 2, 1 };
+    const HighResolutionClock now = armnn::GetTimeNow();
+    RunOrder runOrder;
+    std::vector<std::unique_ptr<Inference>> inferences;
+    for (unsigned int i = 0; i < deadlineOrder.size(); ++i)
+    {
+        inferences.emplace_back(std::make_unique<Inference>(networkId, 2.0f));
+        threadpool.Schedule(networkId,
+                            inferences.back()->m_InputTensors,
+                            inferences.back()->m_OutputTensors,
+                            now + std::chrono::hours(1 + deadlineOrder[i]),
+                            runOrder.GetNewCallback(deadlineOrder[i]));
+    }
+    // Without a deadline it runs after all of them
+    inferences.emplace_back(std::make_unique<Inference>(networkId, 2.0f));
+    threadpool.Schedule(networkId, inferences.back()->m_InputTensors, inferences.back()->m_OutputTensors,
+                        QosExecPriority::High, runOrder.GetNewCallback(5));
+
+    blockingCallback->Release();
+
+    CHECK(runOrder.WaitForAll(inferences.size()) == std::vector<unsigned int>{ 0, 1, 2, 3, 4, 5 });
+    CHECK(runOrder.GetNumFailures() == 0);
+}
+
+TEST_CASE("ThreadpoolSharesThreadsBetweenNetworksByWeight")
+{
+    IRuntimePtr runtime(IRuntime::Create(IRuntime::CreationOptions()));
+    NetworkId blockingNetworkId = LoadLinearNetwork(*runtime, 1.0f);
+    NetworkId heavyNetworkId = LoadLinearNetwork(*runtime, 2.0f);
+    NetworkId lightNetworkId = LoadLinearNetwork(*runtime, 3.0f);
+
+    Threadpool threadpool(1, runtime.get(), CreateMemHandles(*runtime, blockingNetworkId, 1), {},
+                          SchedulingPolicy::WeightedFairQueuing);
+    threadpool.LoadMemHandles(CreateMemHandles(*runtime, heavyNetworkId, 1));
+    threadpool.LoadMemHandles(CreateMemHandles(*runtime, lightNetworkId, 1));
+    threadpool.SetNetworkWeight(heavyNetworkId, 3);
+    CHECK_THROWS_AS(threadpool.SetNetworkWeight(lightNetworkId, 0), armnn::InvalidArgumentException);
+
+    Inference blockingInference(blockingNetworkId, 1.0f);
+    auto blockingCallback = std::make_shared<BlockingCallback>();
+    threadpool.Schedule(blockingNetworkId, blockingInference.m_InputTensors, blockingInference.m_OutputTensors,
+                        QosExecPriority::Medium, blockingCallback);
+    blockingCallback->WaitUntilBlocking();
+
+    // The inferences of both networks are scheduled in turn, indices below numInferences being the heavy network's
+    constexpr unsigned int numInferences = 12;
+    RunOrder runOrder;
+    std::vector<std::unique_ptr<Inference>> inferences;
+    for (unsigned int i = 0; i < numInferences; ++i)
+    {
+        for (NetworkId networkId : { lightNetworkId, heavyNetworkId })
+        {
+            const bool heavy = networkId == heavyNetworkId;
+            inferences.emplace_back(std::make_unique<Inference>(networkId, heavy ? 2.0f : 3.0f));
+            threadpool.Schedule(networkId,
+                                inferences.back()->m_InputTensors,
+                                inferences.back()->m_OutputTensors,
+                                QosExecPriority::Medium,
+                                runOrder.GetNewCallback(heavy ? i : numInferences + i));
+        }
+    }
+
+    blockingCallback->Release();
+
+    std::vector<unsigned int> order = runOrder.WaitForAll(inferences.size());
+    CHECK(runOrder.GetNumFailures() == 0);
+    // The heavy network gets three times the share of the light one while both have inferences waiting
+    auto numHeavy = std::count_if(order.begin(), order.begin() + 8, [](unsigned int i) { return i < numInferences; });
+    CHECK(numHeavy == 6);
+    for (auto& inference : inferences)
+    {
+        CHECK(inference->m_OutputData == inference->m_ExpectedOutputData);
+    }
+}
+
+TEST_CASE("ThreadpoolRejectsInferencesWhichCantMeetTheirDeadline")
+{
+    IRuntimePtr runtime(IRuntime::Create(IRuntime::CreationOptions()));
+    NetworkId networkId = LoadLinearNetwork(*runtime, 2.0f);
+
+    for (SchedulingPolicy policy : { SchedulingPolicy::Priority,
+                                     SchedulingPolicy::EarliestDeadlineFirst,
+                                     SchedulingPolicy::WeightedFairQueuing })
+    {
+        Threadpool threadpool(2, runtime.get(), CreateMemHandles(*runtime, networkId, 2), {}, policy);
+        AsyncCallbackManager callbackManager;
+
+        // The deadline has passed already
+        Inference lateInference(networkId, 2.0f);
+        threadpool.Schedule(networkId, lateInference.m_InputTensors, lateInference.m_OutputTensors,
+                            armnn::GetTimeNow() - std::chrono::milliseconds(1), callbackManager.GetNewCallback());
+        auto lateCallback = callbackManager.GetNotifiedCallback();
+        CHECK(lateCallback->IsRejected());
+        CHECK(lateCallback->GetStatus() == Status::Failure);
+        CHECK(lateInference.m_OutputData != lateInference.m_ExpectedOutputData);
+
+        Inference inference(networkId, 2.0f);
+        threadpool.Schedule(networkId, inference.m_InputTensors, inference.m_OutputTensors,
+                            armnn::GetTimeNow() + std::chrono::hours(1), callbackManager.GetNewCallback());
+        auto callback = callbackManager.GetNotifiedCallback();
+        CHECK(!callback->IsRejected());
+        CHECK(callback->GetStatus() == Status::Success);
+        CHECK(inference.m_OutputData == inference.m_ExpectedOutputData);
+    }
+}
+
+TEST_CASE("ThreadpoolReportsQueueingTime")
+{
+    IRuntimePtr runtime(IRuntime::Create(IRuntime::CreationOptions()));
+    NetworkId networkId = LoadLinearNetwork(*runtime, 2.0f);
+
+    Threadpool threadpool(1, runtime.get(), CreateMemHandles(*runtime, networkId, 1));
+
+    Inference blockingInference(networkId, 2.0f);
+    auto blockingCallback = std::make_shared<BlockingCallback>();
+    threadpool.Schedule(networkId, blockingInference.m_InputTensors, blockingInference.m_OutputTensors,
+                        QosExecPriority::Medium, blockingCallback);
+    blockingCallback->WaitUntilBlocking();
+
+    AsyncCallbackManager callbackManager;
+    Inference inference(networkId, 2.0f);
+    threadpool.Schedule(networkId, inference.m_InputTensors, inference.m_OutputTensors,
+                        QosExecPriority::Medium, callbackManager.GetNewCallback());
+
+    // The inference can't start until the thread is released
+    const auto blockedFor = std::chrono::milliseconds(50);
+    std::this_thread::sleep_for(blockedFor);
+    blockingCallback->Release();
+
+    auto callback = callbackManager.GetNotifiedCallback();
+    CHECK(callback->GetStatus() == Status::Success);
+    CHECK(callback->GetStartTime() - callback->GetScheduledTime() >= blockedFor);
+    CHECK(callback->GetStartTime() <= callback->GetEndTime());
+}
+
+#if defined(__linux__)
+TEST_CASE("ThreadpoolPinsThreadsToCpus")
+{
+    cpu_set_t allowedCpus;
+    CPU_ZERO(&allowedCpus);
+    if (sched_getaffinity(0, sizeof(allowedCpus), &allowedCpus) != 0 || !CPU_ISSET(0, &allowedCpus))
+    {
+        MESSAGE("CPU 0 isn't available to the process, skipping the test");
+        return;
+    }
+
+    IRuntimePtr runtime(IRuntime::Create(IRuntime::CreationOptions()));
+    NetworkId networkId = LoadLinearNetwork(*runtime, 2.0f);
+
+    auto callback = std::make_shared<CpuRecordingCallback>();
+    constexpr unsigned int numInferences = 8;
+    std::vector<std::unique_ptr<Inference>> inferences;
+    {
+        Threadpool threadpool(2, runtime.get(), CreateMemHandles(*runtime, networkId, 2), { 0 });
+        for (unsigned int i = 0; i < numInferences; ++i)
+        {
+            inferences.emplace_back(std::make_unique<Inference>(networkId, 2.0f));
+            threadpool.Schedule(networkId,
+                                inferences.back()->m_InputTensors,
+                                inferences.back()->m_OutputTensors,
+                                QosExecPriority::High,
+                                callback);
+        }
+        callback->WaitForNotifications(numInferences);
+    }
+
+    for (unsigned int i = 0; i < numInferences; ++i)
+    {
+        CHECK(callback->m_Statuses[i] == Status::Success);
+        CHECK(callback->m_Cpus[i] == 0);
+    }
+}
+#endif
+
+}
+
+#endif
@@ -0,0 +1,190 @@
+//
+// Copyright © 2024 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include <GraphUtils.hpp>
+#include <TestUtils.hpp>
+
+#include <Optimizer.hpp>
+
+#include <doctest/doctest.h>
+
+using namespace armnn;
+
+TEST_SUITE("Optimizer")
+{
+using namespace armnn::optimizations;
+
+TEST_CASE("CommonSubexpressionEliminationMergesChainsTest")
+{
+    Graph graph;
+
+    const TensorInfo info({ 1, 2, 3, 5 }, DataType::Float32);
+
+    auto input0 = graph.AddLayer<InputLayer>(0, "input0");
+    input0->GetOutputSlot().SetTensorInfo(info);
+    auto input1 = graph.AddLayer<InputLayer>(1, "input1");
+    input1->GetOutputSlot().SetTensorInfo(info);
+
+    auto mul = graph.AddLayer<ElementwiseBinaryLayer>(ElementwiseBinaryDescriptor(BinaryOperation::Mul), "mul");
+    mul->GetOutputSlot().SetTensorInfo(info);
+    mul->GetOutputSlot().Connect(graph.AddLayer<OutputLayer>(0, "output")->GetInputSlot(0));
+
+    // Two identical branches: input0 -> abs -> add(input1) -> mul.
+    for (unsigned int branch = 0; branch < 2; ++branch)
+    {
+        std::string suffix = std::to_string(branch);
+
+        auto abs = graph.AddLayer<ElementwiseUnaryLayer>(ElementwiseUnaryDescriptor(UnaryOperation::Abs),
+                                                         ("abs" + suffix).c_str());
+        abs->GetOutputSlot().SetTensorInfo(info);
+        auto add = graph.AddLayer<ElementwiseBinaryLayer>(ElementwiseBinaryDescriptor(BinaryOperation::Add),
+                                                          ("add" + suffix).c_str());
+        add->GetOutputSlot().SetTensorInfo(info);
+
+        input0->GetOutputSlot().Connect(abs->GetInputSlot(0));
+        abs->GetOutputSlot().Connect(add->GetInputSlot(0));
+        input1->GetOutputSlot().Connect(add->GetInputSlot(1));
+        add->GetOutputSlot().Connect(mul->GetInputSlot(branch));
+    }
+
+    CHECK(graph.GetNumLayers() == 8);
+
+    armnn::Optimizer::Pass(graph, armnn::MakeOptimizations(CommonSubexpressionElimination()));
+
+    // Both branches are merged and the remaining add feeds both inputs of the mul.
+    CHECK(CheckSequence(graph.cbegin(), graph.cend(),
+                        &IsLayerOfType<InputLayer>,
+                        &IsLayerOfType<InputLayer>,
+                        &IsLayerOfType<ElementwiseUnaryLayer>,
+                        &IsLayerOfType<ElementwiseBinaryLayer>,
+                        &IsLayerOfType<ElementwiseBinaryLayer>,
+                        &IsLayerOfType<OutputLayer>));
+
+    CHECK(mul->GetInputSlot(0).GetConnectedOutputSlot() == mul->GetInputSlot(1).GetConnectedOutputSlot());
+}
+
+TEST_CASE("CommonSubexpressionEliminationKeepsDifferentLayersTest")
+{
+    Graph graph;
+
+    const TensorInfo info({ 1, 2, 3, 5 }, DataType::Float32);
+
+    auto input0 = graph.AddLayer<InputLayer>(0, "input0");
+    input0->GetOutputSlot().SetTensorInfo(info);
+    auto input1 = graph.AddLayer<InputLayer>(1, "input1");
+    input1->GetOutputSlot().SetTensorInfo(info);
+
+    ActivationDescriptor reluDescriptor;
+    reluDescriptor.m_Function = ActivationFunction::ReLu;
+    ActivationDescriptor boundedReluDescriptor;
+    boundedReluDescriptor.m_Function = ActivationFunction::BoundedReLu;
+    boundedReluDescriptor.m_A = 6.0f;
+
+    // Different descriptors.
+    auto relu = graph.AddLayer<ActivationLayer>(reluDescriptor, "relu");
+    relu->GetOutputSlot().SetTensorInfo(info);
+    auto boundedRelu = graph.AddLayer<ActivationLayer>(boundedReluDescriptor, "boundedRelu");
+    boundedRelu->GetOutputSlot().SetTensorInfo(info);
+    input0->GetOutputSlot().Connect(relu->GetInputSlot(0));
+    input0->GetOutputSlot().Connect(boundedRelu->GetInputSlot(0));
+
+    // Same descriptor but different inputs.
+    auto add0 = graph.AddLayer<ElementwiseBinaryLayer>(ElementwiseBinaryDescriptor(BinaryOperation::Add), "add0");
+    add0->GetOutputSlot().SetTensorInfo(info);
+    auto add1 = graph.AddLayer<ElementwiseBinaryLayer>(ElementwiseBinaryDescriptor(BinaryOperation::Add), "add1");
+    add1->GetOutputSlot().SetTensorInfo(info);
+    relu->GetOutputSlot().Connect(add0->GetInputSlot(0));
+    boundedRelu->GetOutputSlot().Connect(add0->GetInputSlot(1));
+    relu->GetOutputSlot().Connect(add1->GetInputSlot(0));
+    relu->GetOutputSlot().Connect(add1->GetInputSlot(1));
+
+    auto sub = graph.AddLayer<ElementwiseBinaryLayer>(ElementwiseBinaryDescriptor(BinaryOperation::Sub), "sub");
+    sub->GetOutputSlot().SetTensorInfo(info);
+    add0->GetOutputSlot().Connect(sub->GetInputSlot(0));
+    add1->GetOutputSlot().Connect(sub->GetInputSlot(1));
+    sub->GetOutputSlot().Connect(graph.AddLayer<OutputLayer>(0, "output")->GetInputSlot(0));
+
+    // Identical layers producing network outputs are kept.
+    auto abs0 = graph.AddLayer<ElementwiseUnaryLayer>(ElementwiseUnaryDescriptor(UnaryOperation::Abs), "abs0");
+    abs0->GetOutputSlot().SetTensorInfo(info);
+    auto abs1 = graph.AddLayer<ElementwiseUnaryLayer>(ElementwiseUnaryDescriptor(UnaryOperation::Abs), "abs1");
+    abs1->GetOutputSlot().SetTensorInfo(info);
+    input1->GetOutputSlot().Connect(abs0->GetInputSlot(0));
+    input1->GetOutputSlot().Connect(abs1->GetInputSlot(0));
+    abs0->GetOutputSlot().Connect(graph.AddLayer<OutputLayer>(1, "output1")->GetInputSlot(0));
+    abs1->GetOutputSlot().Connect(graph.AddLayer<OutputLayer>(2, "output2")->GetInputSlot(0));
+
+    const size_t numLayers = graph.GetNumLayers();
+
+    armnn::Optimizer::Pass(graph, armnn::MakeOptimizations(CommonSubexpressionElimination()));
+
+    CHECK(graph.GetNumLayers() == numLayers);
+}
+
+TEST_CASE("CommonSubexpressionEliminationComparesDescriptorsExactlyTest")
+{
+    Graph graph;
+
+    const TensorInfo info({ 1, 2, 3, 5 }, DataType::Float32);
+
+    auto input0 = graph.AddLayer<InputLayer>(0, "input0");
+    input0->GetOutputSlot().SetTensorInfo(info);
+    auto input1 = graph.AddLayer<InputLayer>(1, "input1");
+    input1->GetOutputSlot().SetTensorInfo(info);
+
+    // Each pair of layers differs only in its descriptor, by less than a printed float would show, and is combined
+    // by an add so that neither of them produces a network output.
+    LayerBindingId nextOutputId = 0;
+    auto connectPair = [&](Layer* layer0, Layer* layer1, OutputSlot& inputA, OutputSlot* inputB)
+    {
+        for (Layer* layer : { layer0, layer1 })
+        {
+            layer->GetOutputSlot().SetTensorInfo(info);
+            inputA.Connect(layer->GetInputSlot(0));
+            if (inputB)
+            {
+                inputB->Connect(layer->GetInputSlot(1));
+            }
+        }
+        auto add = graph.AddLayer<ElementwiseBinaryLayer>(ElementwiseBinaryDescriptor(BinaryOperation::Add), "");
+        add->GetOutputSlot().SetTensorInfo(info);
+        layer0->GetOutputSlot().Connect(add->GetInputSlot(0));
+        layer1->GetOutputSlot().Connect(add->GetInputSlot(1));
+        add->GetOutputSlot().Connect(graph.AddLayer<OutputLayer>(nextOutputId++, "")->GetInputSlot(0));
+    };
+
+    InstanceNormalizationDescriptor instanceNormDescriptor0;
+    instanceNormDescriptor0.m_Eps = 1e-5f;
+    InstanceNormalizationDescriptor instanceNormDescriptor1;
+    instanceNormDescriptor1.m_Eps = 1e-7f;
+    connectPair(graph.AddLayer<InstanceNormalizationLayer>(instanceNormDescriptor0, "instanceNorm0"),
+                graph.AddLayer<InstanceNormalizationLayer>(instanceNormDescriptor1, "instanceNorm1"),
+                input0->GetOutputSlot(), nullptr);
+
+    ActivationDescriptor linearDescriptor0;
+    linearDescriptor0.m_Function = ActivationFunction::Linear;
+    linearDescriptor0.m_A = 1e-7f;
+    ActivationDescriptor linearDescriptor1;
+    linearDescriptor1.m_Function = ActivationFunction::Linear;
+    linearDescriptor1.m_A = 0.0f;
+    connectPair(graph.AddLayer<ActivationLayer>(linearDescriptor0, "linear0"),
+                graph.AddLayer<ActivationLayer>(linearDescriptor1, "linear1"),
+                input0->GetOutputSlot(), nullptr);
+
+    BatchMatMulDescriptor batchMatMulDescriptor0;
+    BatchMatMulDescriptor batchMatMulDescriptor1;
+    batchMatMulDescriptor1.m_DataLayoutX = DataLayout::NHWC;
+    connectPair(graph.AddLayer<BatchMatMulLayer>(batchMatMulDescriptor0, "batchMatMul0"),
+                graph.AddLayer<BatchMatMulLayer>(batchMatMulDescriptor1, "batchMatMul1"),
+                input0->GetOutputSlot(), &input1->GetOutputSlot());
+
+    const size_t numLayers = graph.GetNumLayers();
+
+    armnn::Optimizer::Pass(graph, armnn::MakeOptimizations(CommonSubexpressionElimination()));
+
+    CHECK(graph.GetNumLayers() == numLayers);
+}
+
+}
@@ -0,0 +1,236 @@
+//
+// Copyright © 2024 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "LayersFwd.hpp"
+
+#include <Graph.hpp>
+#include <Optimizer.hpp>
+#include <TestUtils.hpp>
+#include <armnn/INetwork.hpp>
+#include <armnn/IRuntime.hpp>
+#include <armnn/backends/TensorHandle.hpp>
+
+#include <doctest/doctest.h>
+
+#include <algorithm>
+
+TEST_SUITE("Optimizer")
+{
+using namespace armnn;
+using namespace armnn::optimizations;
+
+namespace
+{
+
+ConstantLayer* AddConstant(Graph& graph, const TensorInfo& info, const std::vector<float>& values, const char* name)
+{
+    auto constantLayer = graph.AddLayer<ConstantLayer>(name);
+    constantLayer->m_LayerOutput = std::make_shared<ScopedTensorHandle>(ConstTensor(info, values));
+    constantLayer->GetOutputSlot().SetTensorInfo(info);
+    return constantLayer;
+}
+
+std::vector<float> GetConstantValues(const Layer* layer)
+{
+    auto constantLayer = PolymorphicDowncast<const ConstantLayer*>(layer);
+    const float* data = constantLayer->m_LayerOutput->GetConstTensor<float>();
+    return std::vector<float>(data, data + constantLayer->m_LayerOutput->GetTensorInfo().GetNumElements());
+}
+
+/// Optimizes a network with a constant scaled by an activation, the constant also being an output of the network so
+/// that folding the activation grows the model, and returns whether the activation was folded.
+bool IsSharedConstantFolded(const OptimizerOptionsOpaque& options)
+{
+    const TensorInfo info({ 4 }, DataType::Float32, 0.0f, 0, true);
+    std::vector<float> values = { 1.0f, 2.0f, 3.0f, 4.0f };
+
+    INetworkPtr network = INetwork::Create();
+    IConnectableLayer* constant = network->AddConstantLayer(ConstTensor(info, values), "constant");
+    ActivationDescriptor descriptor;
+    descriptor.m_Function = ActivationFunction::Linear;
+    descriptor.m_A = 2.0f;
+    IConnectableLayer* activation = network->AddActivationLayer(descriptor, "activation");
+    IConnectableLayer* output0 = network->AddOutputLayer(0, "output0");
+    IConnectableLayer* output1 = network->AddOutputLayer(1, "output1");
+    constant->GetOutputSlot(0).Connect(activation->GetInputSlot(0));
+    constant->GetOutputSlot(0).Connect(output1->GetInputSlot(0));
+    activation->GetOutputSlot(0).Connect(output0->GetInputSlot(0));
+    constant->GetOutputSlot(0).SetTensorInfo(info);
+    activation->GetOutputSlot(0).SetTensorInfo(info);
+
+    IRuntimePtr runtime = IRuntime::Create(IRuntime::CreationOptions());
+    IOptimizedNetworkPtr optNet = Optimize(*network, { Compute::CpuRef }, runtime->GetDeviceSpec(), options);
+    Graph& graph = GetGraphForTesting(optNet.get());
+    return std::none_of(graph.cbegin(), graph.cend(),
+                        [](const Layer* layer) { return layer->GetType() == LayerType::Activation; });
+}
+
+} // namespace
+
+TEST_CASE("FoldConstantLayersOptimizerOptions")
+{
+    // The 16 bytes of the activation output are within the default limit
+    OptimizerOptionsOpaque options;
+    CHECK(options.GetFoldConstantLayersEnabled());
+    CHECK(IsSharedConstantFolded(options));
+
+    // Over the limit
+    options.SetMaxFoldedTensorBytes(8);
+    CHECK(options.GetMaxFoldedTensorBytes() == 8);
+    CHECK(!IsSharedConstantFolded(options));
+
+    // Disabled
+    options.SetMaxFoldedTensorBytes(1024);
+    options.SetFoldConstantLayersEnabled(false);
+    CHECK(!IsSharedConstantFolded(options));
+}
+
+TEST_CASE("FoldConstantReshapeAddChain")
+{
+    Graph graph;
+
+    const TensorInfo inputInfo({ 4 }, DataType::Float32, 0.0f, 0, true);
+    const TensorInfo outputInfo({ 2, 2 }, DataType::Float32, 0.0f, 0, true);
+
+    auto constant0 = AddConstant(graph, inputInfo, { 1.0f, 2.0f, 3.0f, 4.0f }, "constant0");
+    auto constant1 = AddConstant(graph, outputInfo, { 10.0f, 20.0f, 30.0f, 40.0f }, "constant1");
+
+    ReshapeDescriptor reshapeDescriptor;
+    reshapeDescriptor.m_TargetShape = outputInfo.GetShape();
+    auto reshape = graph.AddLayer<ReshapeLayer>(reshapeDescriptor, "reshape");
+    reshape->GetOutputSlot().SetTensorInfo(outputInfo);
+
+    auto add = graph.AddLayer<ElementwiseBinaryLayer>(ElementwiseBinaryDescriptor(BinaryOperation::Add), "add");
+    add->GetOutputSlot().SetTensorInfo(outputInfo);
+
+    auto output = graph.AddLayer<OutputLayer>(0, "output");
+
+    constant0->GetOutputSlot().Connect(reshape->GetInputSlot(0));
+    reshape->GetOutputSlot().Connect(add->GetInputSlot(0));
+    constant1->GetOutputSlot().Connect(add->GetInputSlot(1));
+    add->GetOutputSlot().Connect(output->GetInputSlot(0));
+
+    CHECK(CheckSequence(graph.cbegin(), graph.cend(),
+                        &IsLayerOfType<ConstantLayer>,
+                        &IsLayerOfType<ConstantLayer>,
+                        &IsLayerOfType<ReshapeLayer>,
+                        &IsLayerOfType<ElementwiseBinaryLayer>,
+                        &IsLayerOfType<OutputLayer>));
+
+    armnn::Optimizer::Pass(graph, MakeOptimizations(FoldConstantLayers()));
+
+    CHECK(CheckSequence(graph.cbegin(), graph.cend(),
+                        &IsLayerOfType<ConstantLayer>,
+                        &IsLayerOfType<OutputLayer>));
+
+    const Layer* folded = &output->GetInputSlot(0).GetConnectedOutputSlot()->GetOwningLayer();
+    CHECK(folded->GetNameStr() == "folded-add");
+    CHECK(folded->GetOutputSlot(0).GetTensorInfo().GetShape() == outputInfo.GetShape());
+    CHECK(folded->GetOutputSlot(0).GetTensorInfo().IsConstant());
+    CHECK(GetConstantValues(folded) == std::vector<float>({ 11.0f, 22.0f, 33.0f, 44.0f }));
+}
+
+TEST_CASE("FoldConstantIgnoresNonConstantInputs")
+{
+    Graph graph;
+
+    const TensorInfo info({ 4 }, DataType::Float32, 0.0f, 0, true);
+    TensorInfo nonConstInfo = info;
+    nonConstInfo.SetConstant(false);
+
+    auto input = graph.AddLayer<InputLayer>(0, "input");
+    input->GetOutputSlot().SetTensorInfo(nonConstInfo);
+    auto constant = AddConstant(graph, info, { 1.0f, 2.0f, 3.0f, 4.0f }, "constant");
+
+    auto add = graph.AddLayer<ElementwiseBinaryLayer>(ElementwiseBinaryDescriptor(BinaryOperation::Add), "add");
+    add->GetOutputSlot().SetTensorInfo(nonConstInfo);
+    auto output = graph.AddLayer<OutputLayer>(0, "output");
+
+    input->GetOutputSlot().Connect(add->GetInputSlot(0));
+    constant->GetOutputSlot().Connect(add->GetInputSlot(1));
+    add->GetOutputSlot().Connect(output->GetInputSlot(0));
+
+    armnn::Optimizer::Pass(graph, MakeOptimizations(FoldConstantLayers()));
+
+    CHECK(graph.GetNumLayers() == 4);
+    CHECK(&output->GetInputSlot(0).GetConnectedOutputSlot()->GetOwningLayer() == add);
+}
+
+TEST_CASE("FoldConstantRespectsSizeLimit")
+{
+    Graph graph;
+
+    const TensorInfo inputInfo({ 4 }, DataType::Float32, 0.0f, 0, true);
+    const TensorInfo outputInfo({ 2, 2 }, DataType::Float32, 0.0f, 0, true);
+
+    // The constant is shared with a second consumer so folding the reshape would duplicate its data.
+    auto constant = AddConstant(graph, inputInfo, { 1.0f, 2.0f, 3.0f, 4.0f }, "constant");
+
+    ReshapeDescriptor reshapeDescriptor;
+    reshapeDescriptor.m_TargetShape = outputInfo.GetShape();
+    auto reshape = graph.AddLayer<ReshapeLayer>(reshapeDescriptor, "reshape");
+    reshape->GetOutputSlot().SetTensorInfo(outputInfo);
+
+    auto output0 = graph.AddLayer<OutputLayer>(0, "output0");
+    auto output1 = graph.AddLayer<OutputLayer>(1, "output1");
+
+    constant->GetOutputSlot().Connect(reshape->GetInputSlot(0));
+    constant->GetOutputSlot().Connect(output1->GetInputSlot(0));
+    reshape->GetOutputSlot().Connect(output0->GetInputSlot(0));
+
+    armnn::Optimizer::Pass(graph, MakeOptimizations(FoldConstantLayers(0)));
+
+    CHECK(graph.GetNumLayers() == 4);
+    CHECK(&output0->GetInputSlot(0).GetConnectedOutputSlot()->GetOwningLayer() == reshape);
+
+    // Once the constant is only used by the reshape, folding it does not grow the model.
+    constant->GetOutputSlot().Disconnect(output1->GetInputSlot(0));
+    graph.EraseLayer(output1);
+
+    armnn::Optimizer::Pass(graph, MakeOptimizations(FoldConstantLayers(0)));
+
+    CHECK(CheckSequence(graph.cbegin(), graph.cend(),
+                        &IsLayerOfType<ConstantLayer>,
+                        &IsLayerOfType<OutputLayer>));
+    const Layer* folded = &output0->GetInputSlot(0).GetConnectedOutputSlot()->GetOwningLayer();
+    CHECK(folded->GetOutputSlot(0).GetTensorInfo().GetShape() == outputInfo.GetShape());
+    CHECK(GetConstantValues(folded) == std::vector<float>({ 1.0f, 2.0f, 3.0f, 4.0f }));
+}
+
+TEST_CASE("FoldConstantLongChain")
+{
+    Graph graph;
+
+    const TensorInfo info({ 2 }, DataType::Float32, 0.0f, 0, true);
+    auto constant = AddConstant(graph, info, { 1.0f, 2.0f }, "constant");
+
+    // Each layer adds one. The chain is deeper than a recursive walk of the layers could go on the call stack.
+    constexpr unsigned int chainLength = 20000;
+    ActivationDescriptor descriptor;
+    descriptor.m_Function = ActivationFunction::Linear;
+    descriptor.m_A = 1.0f;
+    descriptor.m_B = 1.0f;
+
+    OutputSlot* previous = &constant->GetOutputSlot();
+    for (unsigned int i = 0; i < chainLength; ++i)
+    {
+        auto activation = graph.AddLayer<ActivationLayer>(descriptor, ("activation" + std::to_string(i)).c_str());
+        activation->GetOutputSlot().SetTensorInfo(info);
+        previous->Connect(activation->GetInputSlot(0));
+        previous = &activation->GetOutputSlot();
+    }
+    auto output = graph.AddLayer<OutputLayer>(0, "output");
+    previous->Connect(output->GetInputSlot(0));
+
+    armnn::Optimizer::Pass(graph, MakeOptimizations(FoldConstantLayers()));
+
+    CHECK(CheckSequence(graph.cbegin(), graph.cend(),
+                        &IsLayerOfType<ConstantLayer>,
+                        &IsLayerOfType<OutputLayer>));
+    const Layer* folded = &output->GetInputSlot(0).GetConnectedOutputSlot()->GetOwningLayer();
+    CHECK(GetConstantValues(folded) == std::vector<float>({ 1.0f + chainLength, 2.0f + chainLength }));
+}
+
+}
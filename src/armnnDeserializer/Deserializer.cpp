@@ -1,5 +1,5 @@
 //
-// Copyright © 2017,2019-2023 Arm Ltd and Contributors. All rights reserved.
+// Copyright © 2017,2019-2024 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 
@@ -25,9 +25,18 @@
 
 #include <fstream>
 #include <algorithm>
+#include <cstring>
 #include <limits>
 #include <numeric>
 
+#if defined(__linux__)
+#define DESERIALIZER_USE_MMAP 1
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
 using armnn::ParseException;
 using namespace armnn;
 using namespace armnnSerializer;
@@ -64,6 +73,17 @@ armnn::INetworkPtr IDeserializer::CreateNetworkFromBinary(std::istream &binaryCo
     return pDeserializerImpl->CreateNetworkFromBinary(binaryContent);
 }
 
+armnn::INetworkPtr IDeserializer::CreateNetworkFromBinaryFile(const char* graphFile)
+{
+    return pDeserializerImpl->CreateNetworkFromBinaryFile(graphFile);
+}
+
+armnn::IOptimizedNetworkPtr IDeserializer::CreateOptimizedNetworkFromBinary(const std::vector<uint8_t>& binaryContent,
+                                                                            const armnn::ModelOptions& modelOptions)
+{
+    return pDeserializerImpl->CreateOptimizedNetworkFromBinary(binaryContent, modelOptions);
+}
+
 BindingPointInfo IDeserializer::GetNetworkInputBindingInfo(unsigned int layerId, const std::string &name) const
 {
     return pDeserializerImpl->GetNetworkInputBindingInfo(layerId, name);
@@ -183,6 +203,47 @@ void CheckConstTensorSize(const unsigned int constTensorSize,
 
 #define CHECK_GRAPH(GRAPH, LAYERS_INDEX) \
     CheckGraph(GRAPH, LAYERS_INDEX, CHECK_LOCATION())
+
+// The layout of the external data section which may follow the SerializedGraph, written by the serializer.
+// These values must match the ones in Serializer.hpp.
+constexpr size_t ExternalDataSectionAlignment = 4096;
+constexpr char ExternalDataMagic[8] = { 'A', 'R', 'M', 'N', 'E', 'X', 'T', '1' };
+constexpr size_t ExternalDataTrailerSize = sizeof(uint64_t) + sizeof(ExternalDataMagic);
+
+/// Returns the size of the SerializedGraph at the start of the binary content, finding the external data section
+/// which follows it if there is one.
+size_t SplitExternalData(const uint8_t* binaryContent,
+                         size_t len,
+                         const uint8_t*& externalData,
+                         size_t& externalDataSize)
+{
+    externalData = nullptr;
+    externalDataSize = 0;
+    if (binaryContent == nullptr || len < ExternalDataTrailerSize ||
+        std::memcmp(binaryContent + len - sizeof(ExternalDataMagic), ExternalDataMagic, sizeof(ExternalDataMagic)) != 0)
+    {
+        return len;
+    }
+
+    const uint8_t* trailer = binaryContent + len - ExternalDataTrailerSize;
+    uint64_t sectionOffset = 0;
+    for (unsigned int i = 0; i < sizeof(uint64_t); ++i)
+    {
+        sectionOffset |= static_cast<uint64_t>(trailer[i]) << (8 * i);
+    }
+    if (sectionOffset == 0 || sectionOffset % ExternalDataSectionAlignment != 0 ||
+        sectionOffset > len - ExternalDataTrailerSize)
+    {
+        throw ParseException(fmt::format("Invalid external data section offset {0} in a binary of {1} bytes {2}",
+                                         sectionOffset,
+                                         len,
+                                         CHECK_LOCATION().AsString()));
+    }
+
+    externalData = binaryContent + sectionOffset;
+    externalDataSize = len - ExternalDataTrailerSize - static_cast<size_t>(sectionOffset);
+    return static_cast<size_t>(sectionOffset);
+}
 }
 
 bool CheckShape(const armnn::TensorShape& actual, const std::vector<uint32_t>& expected)
@@ -222,6 +283,8 @@ m_ParserFunctions(Layer_MAX+1, &IDeserializer::DeserializerImpl::ParseUnsupporte
     m_ParserFunctions[Layer_ComparisonLayer]             = &DeserializerImpl::ParseComparison;
     m_ParserFunctions[Layer_ConcatLayer]                 = &DeserializerImpl::ParseConcat;
     m_ParserFunctions[Layer_ConstantLayer]               = &DeserializerImpl::ParseConstant;
+    m_ParserFunctions[Layer_ConvertFp16ToFp32Layer]      = &DeserializerImpl::ParseConvertFp16ToFp32;
+    m_ParserFunctions[Layer_ConvertFp32ToFp16Layer]      = &DeserializerImpl::ParseConvertFp32ToFp16;
     m_ParserFunctions[Layer_Convolution2dLayer]          = &DeserializerImpl::ParseConvolution2d;
     m_ParserFunctions[Layer_Convolution3dLayer]          = &DeserializerImpl::ParseConvolution3d;
     m_ParserFunctions[Layer_DepthToSpaceLayer]           = &DeserializerImpl::ParseDepthToSpace;
@@ -247,6 +310,8 @@ m_ParserFunctions(Layer_MAX+1, &IDeserializer::DeserializerImpl::ParseUnsupporte
     m_ParserFunctions[Layer_MeanLayer]                   = &DeserializerImpl::ParseMean;
     m_ParserFunctions[Layer_MinimumLayer]                = &DeserializerImpl::ParseMinimum;
     m_ParserFunctions[Layer_MergeLayer]                  = &DeserializerImpl::ParseMerge;
+    m_ParserFunctions[Layer_MemCopyLayer]                = &DeserializerImpl::ParseMemCopy;
+    m_ParserFunctions[Layer_MemImportLayer]              = &DeserializerImpl::ParseMemImport;
     m_ParserFunctions[Layer_MergerLayer]                 = &DeserializerImpl::ParseConcat;
     m_ParserFunctions[Layer_MultiplicationLayer]         = &DeserializerImpl::ParseMultiplication;
     m_ParserFunctions[Layer_NormalizationLayer]          = &DeserializerImpl::ParseNormalization;
@@ -312,6 +377,10 @@ LayerBaseRawPtr IDeserializer::DeserializerImpl::GetBaseLayer(const GraphPtr& gr
             return graphPtr->layers()->Get(layerIndex)->layer_as_ConcatLayer()->base();
         case Layer::Layer_ConstantLayer:
             return graphPtr->layers()->Get(layerIndex)->layer_as_ConstantLayer()->base();
+        case Layer::Layer_ConvertFp16ToFp32Layer:
+            return graphPtr->layers()->Get(layerIndex)->layer_as_ConvertFp16ToFp32Layer()->base();
+        case Layer::Layer_ConvertFp32ToFp16Layer:
+            return graphPtr->layers()->Get(layerIndex)->layer_as_ConvertFp32ToFp16Layer()->base();
         case Layer::Layer_Convolution2dLayer:
             return graphPtr->layers()->Get(layerIndex)->layer_as_Convolution2dLayer()->base();
         case Layer::Layer_Convolution3dLayer:
@@ -362,6 +431,10 @@ LayerBaseRawPtr IDeserializer::DeserializerImpl::GetBaseLayer(const GraphPtr& gr
             return graphPtr->layers()->Get(layerIndex)->layer_as_MinimumLayer()->base();
         case Layer::Layer_MaximumLayer:
             return graphPtr->layers()->Get(layerIndex)->layer_as_MaximumLayer()->base();
+        case Layer::Layer_MemCopyLayer:
+            return graphPtr->layers()->Get(layerIndex)->layer_as_MemCopyLayer()->base();
+        case Layer::Layer_MemImportLayer:
+            return graphPtr->layers()->Get(layerIndex)->layer_as_MemImportLayer()->base();
         case Layer::Layer_MergeLayer:
             return graphPtr->layers()->Get(layerIndex)->layer_as_MergeLayer()->base();
         case Layer::Layer_MergerLayer:
@@ -757,7 +830,7 @@ armnn::TensorInfo ToTensorInfo(TensorRawPtr tensorPtr)
     return result;
 }
 
-armnn::ConstTensor ToConstTensor(ConstTensorRawPtr constTensorPtr)
+armnn::ConstTensor IDeserializer::DeserializerImpl::ToConstTensor(ConstTensorRawPtr constTensorPtr) const
 {
     CHECK_CONST_TENSOR_PTR(constTensorPtr);
     armnn::TensorInfo tensorInfo = ToTensorInfo(constTensorPtr->info());
@@ -765,6 +838,20 @@ armnn::ConstTensor ToConstTensor(ConstTensorRawPtr constTensorPtr)
 
     switch (constTensorPtr->data_type())
     {
+        case ConstTensorData_ExternalData:
+        {
+            auto externalData = constTensorPtr->data_as_ExternalData();
+            if (m_ExternalData == nullptr ||
+                externalData->offset() > m_ExternalDataSize ||
+                externalData->size() > m_ExternalDataSize - externalData->offset())
+            {
+                throw ParseException(fmt::format("Constant tensor data is outside of the external data section. {}",
+                                                 CHECK_LOCATION().AsString()));
+            }
+            CHECK_CONST_TENSOR_SIZE(armnn::numeric_cast<unsigned int>(externalData->size()),
+                                    tensorInfo.GetNumBytes());
+            return armnn::ConstTensor(tensorInfo, m_ExternalData + externalData->offset());
+        }
         case ConstTensorData_ByteData:
         {
             auto byteData = constTensorPtr->data_as_ByteData()->data();
@@ -848,14 +935,27 @@ void IDeserializer::DeserializerImpl::ResetParser()
     m_Network = armnn::INetworkPtr(nullptr, nullptr);
     m_InputBindings.clear();
     m_OutputBindings.clear();
+    m_ExternalData = nullptr;
+    m_ExternalDataSize = 0;
+    m_Placements.clear();
 }
 
 
 INetworkPtr IDeserializer::DeserializerImpl::CreateNetworkFromBinary(const std::vector<uint8_t>& binaryContent)
 {
      ResetParser();
-     GraphPtr graph = LoadGraphFromBinary(binaryContent.data(), binaryContent.size());
-     return CreateNetworkFromGraph(graph);
+     return CreateNetworkFromMemory(binaryContent.data(), binaryContent.size());
+}
+
+INetworkPtr IDeserializer::DeserializerImpl::CreateNetworkFromMemory(const uint8_t* binaryContent, size_t len)
+{
+    // The constant tensor data is copied into the network as it is built, so the content is only needed until then.
+    const size_t graphSize = SplitExternalData(binaryContent, len, m_ExternalData, m_ExternalDataSize);
+    GraphPtr graph = LoadGraphFromBinary(binaryContent, graphSize);
+    INetworkPtr network = CreateNetworkFromGraph(graph);
+    m_ExternalData = nullptr;
+    m_ExternalDataSize = 0;
+    return network;
 }
 
 armnn::INetworkPtr IDeserializer::DeserializerImpl::CreateNetworkFromBinary(std::istream& binaryContent)
@@ -870,8 +970,68 @@ armnn::INetworkPtr IDeserializer::DeserializerImpl::CreateNetworkFromBinary(std:
     std::vector<char> content(static_cast<size_t>(size));
     binaryContent.seekg(0);
     binaryContent.read(content.data(), static_cast<std::streamsize>(size));
-    GraphPtr graph = LoadGraphFromBinary(reinterpret_cast<uint8_t*>(content.data()), static_cast<size_t>(size));
-    return CreateNetworkFromGraph(graph);
+    return CreateNetworkFromMemory(reinterpret_cast<uint8_t*>(content.data()), static_cast<size_t>(size));
+}
+
+armnn::INetworkPtr IDeserializer::DeserializerImpl::CreateNetworkFromBinaryFile(const char* graphFile)
+{
+    if (graphFile == nullptr)
+    {
+        throw InvalidArgumentException(fmt::format("Invalid (null) file name {}", CHECK_LOCATION().AsString()));
+    }
+#if DESERIALIZER_USE_MMAP
+    ResetParser();
+    int fileDescriptor = open(graphFile, O_RDONLY);
+    if (fileDescriptor < 0)
+    {
+        throw FileNotFoundException(fmt::format("Cannot open file {0} {1}", graphFile, CHECK_LOCATION().AsString()));
+    }
+    struct stat fileStat;
+    if (fstat(fileDescriptor, &fileStat) != 0 || fileStat.st_size <= 0)
+    {
+        close(fileDescriptor);
+        throw ParseException(fmt::format("Cannot read file {0} {1}", graphFile, CHECK_LOCATION().AsString()));
+    }
+    const size_t fileSize = static_cast<size_t>(fileStat.st_size);
+    void* mapping = mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+    close(fileDescriptor);
+    if (mapping == MAP_FAILED)
+    {
+        throw ParseException(fmt::format("Cannot map file {0} {1}", graphFile, CHECK_LOCATION().AsString()));
+    }
+
+    try
+    {
+        INetworkPtr network = CreateNetworkFromMemory(static_cast<const uint8_t*>(mapping), fileSize);
+        munmap(mapping, fileSize);
+        return network;
+    }
+    catch (...)
+    {
+        munmap(mapping, fileSize);
+        throw;
+    }
+#else
+    std::ifstream file(graphFile, std::ios::binary);
+    if (!file)
+    {
+        throw FileNotFoundException(fmt::format("Cannot open file {0} {1}", graphFile, CHECK_LOCATION().AsString()));
+    }
+    return CreateNetworkFromBinary(file);
+#endif
+}
+
+armnn::IOptimizedNetworkPtr IDeserializer::DeserializerImpl::CreateOptimizedNetworkFromBinary(
+    const std::vector<uint8_t>& binaryContent,
+    const armnn::ModelOptions& modelOptions)
+{
+    INetworkPtr network = CreateNetworkFromBinary(binaryContent);
+    if (m_Placements.empty())
+    {
+        throw ParseException(fmt::format("The binary content is not of an optimized network {}",
+                                         CHECK_LOCATION().AsString()));
+    }
+    return armnn::CreateOptimizedNetwork(*network, m_Placements, modelOptions);
 }
 
 GraphPtr IDeserializer::DeserializerImpl::LoadGraphFromBinary(const uint8_t* binaryContent, size_t len)
@@ -1145,6 +1305,7 @@ void IDeserializer::DeserializerImpl::RegisterOutputSlots(GraphPtr graph,
         // layerIndex is not necessarily the same as baseLayer->index(). The latter is needed here
         RegisterOutputSlotOfConnection(baseLayer->index(), slotIndex, outputSlot);
     }
+    RegisterPlacement(graph, layerIndex, layer);
 }
 
 void IDeserializer::DeserializerImpl::RegisterInputSlots(GraphPtr graph,
@@ -1188,6 +1349,48 @@ void IDeserializer::DeserializerImpl::RegisterInputSlots(GraphPtr graph,
             RegisterInputSlotOfConnection(fbConnection->sourceLayerIndex(), fbConnection->outputSlotIndex(), inputSlot);
         }
     }
+    RegisterPlacement(graph, layerIndex, layer);
+}
+
+void IDeserializer::DeserializerImpl::RegisterPlacement(GraphPtr graph,
+                                                        uint32_t layerIndex,
+                                                        armnn::IConnectableLayer* layer)
+{
+    LayerBaseRawPtr baseLayer = GetBaseLayer(graph, layerIndex);
+    if (baseLayer->backendId() == nullptr)
+    {
+        return;
+    }
+
+    armnn::OptimizedLayerPlacement placement;
+    placement.m_BackendId = baseLayer->backendId()->str();
+    placement.m_OutputTensorHandleFactoryIds.resize(layer->GetNumOutputSlots(),
+                                                    armnn::ITensorHandleFactory::LegacyFactoryId);
+    for (auto fbOutputSlot : *baseLayer->outputSlots())
+    {
+        if (fbOutputSlot->tensorHandleFactoryId() && fbOutputSlot->index() < layer->GetNumOutputSlots())
+        {
+            placement.m_OutputTensorHandleFactoryIds[fbOutputSlot->index()] =
+                fbOutputSlot->tensorHandleFactoryId()->str();
+        }
+    }
+    placement.m_InputEdgeStrategies.resize(layer->GetNumInputSlots(), armnn::EdgeStrategy::Undefined);
+    for (auto fbInputSlot : *baseLayer->inputSlots())
+    {
+        if (fbInputSlot->index() < layer->GetNumInputSlots())
+        {
+            placement.m_InputEdgeStrategies[fbInputSlot->index()] =
+                static_cast<armnn::EdgeStrategy>(fbInputSlot->edgeStrategy());
+        }
+    }
+    if (auto fusedActivation = baseLayer->fusedActivation())
+    {
+        placement.m_FusedActivation = std::make_shared<armnn::ActivationDescriptor>();
+        placement.m_FusedActivation->m_Function = ToActivationFunction(fusedActivation->activationFunction());
+        placement.m_FusedActivation->m_A = fusedActivation->a();
+        placement.m_FusedActivation->m_B = fusedActivation->b();
+    }
+    m_Placements[layer->GetGuid()] = std::move(placement);
 }
 
 void IDeserializer::DeserializerImpl::RegisterInputSlotOfConnection(uint32_t sourceLayerIndex,
@@ -3656,6 +3859,86 @@ void IDeserializer::DeserializerImpl::ParseMerge(GraphPtr graph, unsigned int la
     RegisterOutputSlots(graph, layerIndex, layer);
 }
 
+void IDeserializer::DeserializerImpl::ParseMemCopy(GraphPtr graph, unsigned int layerIndex)
+{
+    CHECK_LAYERS(graph, 0, layerIndex);
+
+    TensorRawPtrVector inputs = GetInputs(graph, layerIndex);
+    CHECK_VALID_SIZE(inputs.size(), 1);
+
+    TensorRawPtrVector outputs = GetOutputs(graph, layerIndex);
+    CHECK_VALID_SIZE(outputs.size(), 1);
+
+    const std::string layerName = GetLayerName(graph, layerIndex);
+    IConnectableLayer* layer = m_Network->AddMemCopyLayer(layerName.c_str());
+
+    armnn::TensorInfo outputTensorInfo = ToTensorInfo(outputs[0]);
+    layer->GetOutputSlot(0).SetTensorInfo(outputTensorInfo);
+
+    RegisterInputSlots(graph, layerIndex, layer);
+    RegisterOutputSlots(graph, layerIndex, layer);
+}
+
+void IDeserializer::DeserializerImpl::ParseMemImport(GraphPtr graph, unsigned int layerIndex)
+{
+    CHECK_LAYERS(graph, 0, layerIndex);
+
+    TensorRawPtrVector inputs = GetInputs(graph, layerIndex);
+    CHECK_VALID_SIZE(inputs.size(), 1);
+
+    TensorRawPtrVector outputs = GetOutputs(graph, layerIndex);
+    CHECK_VALID_SIZE(outputs.size(), 1);
+
+    const std::string layerName = GetLayerName(graph, layerIndex);
+    IConnectableLayer* layer = m_Network->AddMemImportLayer(layerName.c_str());
+
+    armnn::TensorInfo outputTensorInfo = ToTensorInfo(outputs[0]);
+    layer->GetOutputSlot(0).SetTensorInfo(outputTensorInfo);
+
+    RegisterInputSlots(graph, layerIndex, layer);
+    RegisterOutputSlots(graph, layerIndex, layer);
+}
+
+void IDeserializer::DeserializerImpl::ParseConvertFp16ToFp32(GraphPtr graph, unsigned int layerIndex)
+{
+    CHECK_LAYERS(graph, 0, layerIndex);
+
+    TensorRawPtrVector inputs = GetInputs(graph, layerIndex);
+    CHECK_VALID_SIZE(inputs.size(), 1);
+
+    TensorRawPtrVector outputs = GetOutputs(graph, layerIndex);
+    CHECK_VALID_SIZE(outputs.size(), 1);
+
+    const std::string layerName = GetLayerName(graph, layerIndex);
+    IConnectableLayer* layer = m_Network->AddConvertFp16ToFp32Layer(layerName.c_str());
+
+    armnn::TensorInfo outputTensorInfo = ToTensorInfo(outputs[0]);
+    layer->GetOutputSlot(0).SetTensorInfo(outputTensorInfo);
+
+    RegisterInputSlots(graph, layerIndex, layer);
+    RegisterOutputSlots(graph, layerIndex, layer);
+}
+
+void IDeserializer::DeserializerImpl::ParseConvertFp32ToFp16(GraphPtr graph, unsigned int layerIndex)
+{
+    CHECK_LAYERS(graph, 0, layerIndex);
+
+    TensorRawPtrVector inputs = GetInputs(graph, layerIndex);
+    CHECK_VALID_SIZE(inputs.size(), 1);
+
+    TensorRawPtrVector outputs = GetOutputs(graph, layerIndex);
+    CHECK_VALID_SIZE(outputs.size(), 1);
+
+    const std::string layerName = GetLayerName(graph, layerIndex);
+    IConnectableLayer* layer = m_Network->AddConvertFp32ToFp16Layer(layerName.c_str());
+
+    armnn::TensorInfo outputTensorInfo = ToTensorInfo(outputs[0]);
+    layer->GetOutputSlot(0).SetTensorInfo(outputTensorInfo);
+
+    RegisterInputSlots(graph, layerIndex, layer);
+    RegisterOutputSlots(graph, layerIndex, layer);
+}
+
 void IDeserializer::DeserializerImpl::ParseSwitch(GraphPtr graph, unsigned int layerIndex)
 {
     CHECK_LAYERS(graph, 0, layerIndex);
@@ -41,6 +41,13 @@ public:
     /// Create an input network from a binary input stream
     armnn::INetworkPtr CreateNetworkFromBinary(std::istream& binaryContent);
 
+    /// Create an input network from a binary file, memory mapped where possible
+    armnn::INetworkPtr CreateNetworkFromBinaryFile(const char* graphFile);
+
+    /// Create an optimized network from binary file contents written for an optimized network
+    armnn::IOptimizedNetworkPtr CreateOptimizedNetworkFromBinary(const std::vector<uint8_t>& binaryContent,
+                                                                 const armnn::ModelOptions& modelOptions);
+
     /// Retrieve binding info (layer id and tensor info) for the network input identified by the given layer name
     BindingPointInfo GetNetworkInputBindingInfo(unsigned int layerId, const std::string& name) const;
 
@@ -77,9 +84,15 @@ public:
                                                   const std::vector<uint32_t> & targetDimsIn);
 
 private:
+    /// Create the network from binary content which is only needed until the network has been built
+    armnn::INetworkPtr CreateNetworkFromMemory(const uint8_t* binaryContent, size_t len);
+
     /// Create the network from an already loaded flatbuffers graph
     armnn::INetworkPtr CreateNetworkFromGraph(GraphPtr graph);
 
+    /// Points at the data of the constant tensor, which may be in the external data section
+    armnn::ConstTensor ToConstTensor(ConstTensorRawPtr constTensorPtr) const;
+
     // signature for the parser functions
     using LayerParsingFunction = void(DeserializerImpl::*)(GraphPtr graph, unsigned int layerIndex);
 
@@ -120,6 +133,10 @@ private:
     void ParseMean(GraphPtr graph, unsigned int layerIndex);
     void ParseMinimum(GraphPtr graph, unsigned int layerIndex);
     void ParseMerge(GraphPtr graph, unsigned int layerIndex);
+    void ParseMemCopy(GraphPtr graph, unsigned int layerIndex);
+    void ParseMemImport(GraphPtr graph, unsigned int layerIndex);
+    void ParseConvertFp16ToFp32(GraphPtr graph, unsigned int layerIndex);
+    void ParseConvertFp32ToFp16(GraphPtr graph, unsigned int layerIndex);
     void ParseMultiplication(GraphPtr graph, unsigned int layerIndex);
     void ParseNormalization(GraphPtr graph, unsigned int layerIndex);
     void ParseLstm(GraphPtr graph, unsigned int layerIndex);
@@ -162,6 +179,9 @@ private:
                              uint32_t layerIndex,
                              armnn::IConnectableLayer* layer);
 
+    /// Records the placement of the layer if the graph is of an optimized network
+    void RegisterPlacement(GraphPtr graph, uint32_t layerIndex, armnn::IConnectableLayer* layer);
+
     // NOTE index here must be from flatbuffer object index property
     void RegisterOutputSlotOfConnection(uint32_t sourceLayerIndex, uint32_t outputSlotIndex, armnn::IOutputSlot* slot);
     void RegisterInputSlotOfConnection(uint32_t sourceLayerIndex, uint32_t outputSlotIndex, armnn::IInputSlot* slot);
@@ -196,10 +216,17 @@ private:
     armnn::INetworkPtr                    m_Network;
     std::vector<LayerParsingFunction>     m_ParserFunctions;
 
+    /// The external data section of the binary being deserialized, if it has one
+    const uint8_t*                        m_ExternalData = nullptr;
+    size_t                                m_ExternalDataSize = 0;
+
     using NameToBindingInfo = std::pair<std::string, BindingPointInfo >;
     std::vector<NameToBindingInfo>    m_InputBindings;
     std::vector<NameToBindingInfo>    m_OutputBindings;
 
+    /// The placement of each layer of m_Network, by layer guid, when it is an optimized network
+    armnn::OptimizedLayerPlacements   m_Placements;
+
     /// This struct describe connections for each layer
     struct Connections
     {
@@ -1,5 +1,5 @@
 //
-// Copyright © 2017,2019-2023 Arm Ltd and Contributors. All rights reserved.
+// Copyright © 2017,2019-2024 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 #include "Serializer.hpp"
@@ -12,6 +12,8 @@
 #include <armnn/utility/NumericCast.hpp>
 
 #include <fmt/format.h>
+
+#include <algorithm>
 #include <iostream>
 
 using namespace armnn;
@@ -47,6 +49,16 @@ void ISerializer::Serialize(const armnn::INetwork& inNetwork)
     pSerializerImpl->Serialize(inNetwork);
 }
 
+void ISerializer::Serialize(const armnn::INetwork& inNetwork, bool externalConstantData)
+{
+    pSerializerImpl->Serialize(inNetwork, externalConstantData);
+}
+
+void ISerializer::Serialize(const armnn::IOptimizedNetwork& optimizedNetwork, bool externalConstantData)
+{
+    pSerializerImpl->Serialize(optimizedNetwork, externalConstantData);
+}
+
 bool ISerializer::SaveSerializedToStream(std::ostream& stream)
 {
     return pSerializerImpl->SaveSerializedToStream(stream);
@@ -859,6 +871,46 @@ void SerializerStrategy::SerializeMergeLayer(const armnn::IConnectableLayer* lay
     CreateAnyLayer(fbMergeLayer.o, serializer::Layer::Layer_MergeLayer);
 }
 
+void SerializerStrategy::SerializeMemCopyLayer(const armnn::IConnectableLayer* layer, const char* name)
+{
+    IgnoreUnused(name);
+
+    auto fbMemCopyBaseLayer = CreateLayerBase(layer, serializer::LayerType::LayerType_MemCopy);
+    auto fbMemCopyLayer     = serializer::CreateMemCopyLayer(m_flatBufferBuilder, fbMemCopyBaseLayer);
+
+    CreateAnyLayer(fbMemCopyLayer.o, serializer::Layer::Layer_MemCopyLayer);
+}
+
+void SerializerStrategy::SerializeMemImportLayer(const armnn::IConnectableLayer* layer, const char* name)
+{
+    IgnoreUnused(name);
+
+    auto fbMemImportBaseLayer = CreateLayerBase(layer, serializer::LayerType::LayerType_MemImport);
+    auto fbMemImportLayer     = serializer::CreateMemImportLayer(m_flatBufferBuilder, fbMemImportBaseLayer);
+
+    CreateAnyLayer(fbMemImportLayer.o, serializer::Layer::Layer_MemImportLayer);
+}
+
+void SerializerStrategy::SerializeConvertFp16ToFp32Layer(const armnn::IConnectableLayer* layer, const char* name)
+{
+    IgnoreUnused(name);
+
+    auto fbBaseLayer = CreateLayerBase(layer, serializer::LayerType::LayerType_ConvertFp16ToFp32);
+    auto fbLayer     = serializer::CreateConvertFp16ToFp32Layer(m_flatBufferBuilder, fbBaseLayer);
+
+    CreateAnyLayer(fbLayer.o, serializer::Layer::Layer_ConvertFp16ToFp32Layer);
+}
+
+void SerializerStrategy::SerializeConvertFp32ToFp16Layer(const armnn::IConnectableLayer* layer, const char* name)
+{
+    IgnoreUnused(name);
+
+    auto fbBaseLayer = CreateLayerBase(layer, serializer::LayerType::LayerType_ConvertFp32ToFp16);
+    auto fbLayer     = serializer::CreateConvertFp32ToFp16Layer(m_flatBufferBuilder, fbBaseLayer);
+
+    CreateAnyLayer(fbLayer.o, serializer::Layer::Layer_ConvertFp32ToFp16Layer);
+}
+
 void SerializerStrategy::SerializeConcatLayer(const armnn::IConnectableLayer* layer,
                                          const armnn::ConcatDescriptor& concatDescriptor,
                                          const char* name)
@@ -1830,15 +1882,35 @@ fb::Offset<serializer::LayerBase> SerializerStrategy::CreateLayerBase(const ICon
 
     uint32_t fbIndex = GetSerializedId(layer->GetGuid());
 
-    std::vector<fb::Offset<serializer::InputSlot>> inputSlots = CreateInputSlots(layer);
-    std::vector<fb::Offset<serializer::OutputSlot>> outputSlots = CreateOutputSlots(layer);
+    armnn::Optional<armnn::OptimizedLayerPlacement> placement;
+    if (m_OptimizedNetwork)
+    {
+        placement = m_OptimizedNetwork->GetLayerPlacement(*layer);
+    }
+    const armnn::OptimizedLayerPlacement* placementPtr = placement.has_value() ? &placement.value() : nullptr;
+
+    std::vector<fb::Offset<serializer::InputSlot>> inputSlots = CreateInputSlots(layer, placementPtr);
+    std::vector<fb::Offset<serializer::OutputSlot>> outputSlots = CreateOutputSlots(layer, placementPtr);
+
+    fb::Offset<serializer::ActivationDescriptor> fusedActivation = 0;
+    if (placementPtr && placementPtr->m_FusedActivation)
+    {
+        const armnn::ActivationDescriptor& descriptor = *placementPtr->m_FusedActivation;
+        fusedActivation = CreateActivationDescriptor(m_flatBufferBuilder,
+                                                     GetFlatBufferActivationFunction(descriptor.m_Function),
+                                                     descriptor.m_A,
+                                                     descriptor.m_B);
+    }
 
     return serializer::CreateLayerBase(m_flatBufferBuilder,
                                        fbIndex,
                                        m_flatBufferBuilder.CreateString(layer->GetName()),
                                        layerType,
                                        m_flatBufferBuilder.CreateVector(inputSlots),
-                                       m_flatBufferBuilder.CreateVector(outputSlots));
+                                       m_flatBufferBuilder.CreateVector(outputSlots),
+                                       placementPtr ? m_flatBufferBuilder.CreateString(placementPtr->m_BackendId.Get())
+                                                    : 0,
+                                       fusedActivation);
 }
 
 void SerializerStrategy::CreateAnyLayer(const flatbuffers::Offset<void>& layer, const serializer::Layer serializerLayer)
@@ -1914,6 +1986,26 @@ flatbuffers::Offset<serializer::ConstTensor>
 {
     armnn::TensorInfo tensorInfo = constTensor.GetInfo();
 
+    if (m_ExternalConstantData)
+    {
+        // Each tensor starts on a 64 byte boundary of the section so that it can be used in place.
+        const uint64_t offset = (m_ExternalData.size() + ExternalTensorAlignment - 1) / ExternalTensorAlignment *
+                                ExternalTensorAlignment;
+        const uint8_t* data = static_cast<const uint8_t*>(constTensor.GetMemoryArea());
+        m_ExternalData.resize(offset);
+        m_ExternalData.insert(m_ExternalData.end(), data, data + constTensor.GetNumBytes());
+
+        flatbuffers::Offset<serializer::ExternalData> flatBuffersData = serializer::CreateExternalData(
+                m_flatBufferBuilder,
+                offset,
+                constTensor.GetNumBytes());
+        return serializer::CreateConstTensor(
+                m_flatBufferBuilder,
+                CreateTensorInfo(tensorInfo),
+                serializer::ConstTensorData::ConstTensorData_ExternalData,
+                flatBuffersData.o);
+    }
+
     flatbuffers::Offset<void> fbPayload;
 
     switch (tensorInfo.GetDataType())
@@ -1982,7 +2074,8 @@ flatbuffers::Offset<armnnSerializer::FeatureCompatibilityVersions> SerializerStr
 }
 
 std::vector<fb::Offset<serializer::InputSlot>>
-    SerializerStrategy::CreateInputSlots(const armnn::IConnectableLayer* layer)
+    SerializerStrategy::CreateInputSlots(const armnn::IConnectableLayer* layer,
+                                         const armnn::OptimizedLayerPlacement* placement)
 {
     std::vector<fb::Offset<serializer::InputSlot>> inputSlots;
 
@@ -2000,15 +2093,20 @@ std::vector<fb::Offset<serializer::InputSlot>>
         // Create FlatBuffer Connection
         serializer::Connection conn(GetSerializedId(inputSlot.GetConnection()->GetOwningLayerGuid()),
                                     connection->CalculateIndexOnOwner());
+        serializer::EdgeStrategy edgeStrategy = placement
+            ? static_cast<serializer::EdgeStrategy>(placement->m_InputEdgeStrategies[slotIndex])
+            : serializer::EdgeStrategy::EdgeStrategy_Undefined;
+
         // Create FlatBuffer InputSlot
         inputSlots.push_back(serializer::CreateInputSlot(m_flatBufferBuilder, slotIndex, &conn, isOverridden,
-                                                         overriddenTensorInfo));
+                                                         overriddenTensorInfo, edgeStrategy));
     }
     return inputSlots;
 }
 
 std::vector<fb::Offset<serializer::OutputSlot>>
-    SerializerStrategy::CreateOutputSlots(const armnn::IConnectableLayer* layer)
+    SerializerStrategy::CreateOutputSlots(const armnn::IConnectableLayer* layer,
+                                          const armnn::OptimizedLayerPlacement* placement)
 {
     std::vector<fb::Offset<serializer::OutputSlot>> outputSlots;
 
@@ -2019,9 +2117,11 @@ std::vector<fb::Offset<serializer::OutputSlot>>
         const armnn::TensorInfo& tensorInfo = outputSlot.GetTensorInfo();
 
         // Create FlatBuffer Outputslot
-        outputSlots.push_back(serializer::CreateOutputSlot(m_flatBufferBuilder,
-                                                           slotIndex,
-                                                           CreateTensorInfo(tensorInfo)));
+        outputSlots.push_back(serializer::CreateOutputSlot(
+            m_flatBufferBuilder,
+            slotIndex,
+            CreateTensorInfo(tensorInfo),
+            placement ? m_flatBufferBuilder.CreateString(placement->m_OutputTensorHandleFactoryIds[slotIndex]) : 0));
     }
     return outputSlots;
 }
@@ -2285,6 +2385,26 @@ void SerializerStrategy::ExecuteStrategy(const armnn::IConnectableLayer* layer,
             SerializeMergeLayer(layer, name);
             break;
         }
+        case armnn::LayerType::MemCopy :
+        {
+            SerializeMemCopyLayer(layer, name);
+            break;
+        }
+        case armnn::LayerType::MemImport :
+        {
+            SerializeMemImportLayer(layer, name);
+            break;
+        }
+        case armnn::LayerType::ConvertFp16ToFp32 :
+        {
+            SerializeConvertFp16ToFp32Layer(layer, name);
+            break;
+        }
+        case armnn::LayerType::ConvertFp32ToFp16 :
+        {
+            SerializeConvertFp32ToFp16Layer(layer, name);
+            break;
+        }
         case armnn::LayerType::Minimum :
         {
             SerializeMinimumLayer(layer, name);
@@ -2490,6 +2610,13 @@ void SerializerStrategy::ExecuteStrategy(const armnn::IConnectableLayer* layer,
 
 void ISerializer::SerializerImpl::Serialize(const INetwork& inNetwork)
 {
+    Serialize(inNetwork, false);
+}
+
+void ISerializer::SerializerImpl::Serialize(const INetwork& inNetwork, bool externalConstantData)
+{
+    m_SerializerStrategy.Reset(externalConstantData);
+
     // Iterate through to network
     inNetwork.ExecuteStrategy(m_SerializerStrategy);
     flatbuffers::FlatBufferBuilder& fbBuilder = m_SerializerStrategy.GetFlatBufferBuilder();
@@ -2506,6 +2633,28 @@ void ISerializer::SerializerImpl::Serialize(const INetwork& inNetwork)
     fbBuilder.Finish(serializedGraph);
 }
 
+void ISerializer::SerializerImpl::Serialize(const IOptimizedNetwork& optimizedNetwork, bool externalConstantData)
+{
+    m_SerializerStrategy.Reset(externalConstantData);
+    m_SerializerStrategy.SetOptimizedNetwork(&optimizedNetwork);
+
+    // Iterate through to network
+    optimizedNetwork.ExecuteStrategy(m_SerializerStrategy);
+    m_SerializerStrategy.SetOptimizedNetwork(nullptr);
+    flatbuffers::FlatBufferBuilder& fbBuilder = m_SerializerStrategy.GetFlatBufferBuilder();
+
+    // Create FlatBuffer SerializedGraph
+    auto serializedGraph = serializer::CreateSerializedGraph(
+            fbBuilder,
+            fbBuilder.CreateVector(m_SerializerStrategy.GetSerializedLayers()),
+            fbBuilder.CreateVector(m_SerializerStrategy.GetInputIds()),
+            fbBuilder.CreateVector(m_SerializerStrategy.GetOutputIds()),
+            m_SerializerStrategy.GetVersionTable());
+
+    // Serialize the graph
+    fbBuilder.Finish(serializedGraph);
+}
+
 
 bool ISerializer::SerializerImpl::SaveSerializedToStream(std::ostream& stream)
 {
@@ -2513,6 +2662,26 @@ bool ISerializer::SerializerImpl::SaveSerializedToStream(std::ostream& stream)
 
     auto bytesToWrite = armnn::numeric_cast<std::streamsize>(fbBuilder.GetSize());
     stream.write(reinterpret_cast<const char*>(fbBuilder.GetBufferPointer()), bytesToWrite);
+
+    const std::vector<uint8_t>& externalData = m_SerializerStrategy.GetExternalData();
+    if (!externalData.empty())
+    {
+        // See Serializer.hpp for the layout.
+        const uint64_t sectionOffset = (fbBuilder.GetSize() + ExternalDataSectionAlignment - 1) /
+                                       ExternalDataSectionAlignment * ExternalDataSectionAlignment;
+        const std::vector<char> padding(sectionOffset - fbBuilder.GetSize(), 0);
+        stream.write(padding.data(), armnn::numeric_cast<std::streamsize>(padding.size()));
+        stream.write(reinterpret_cast<const char*>(externalData.data()),
+                     armnn::numeric_cast<std::streamsize>(externalData.size()));
+
+        char trailer[sizeof(uint64_t) + sizeof(ExternalDataMagic)];
+        for (unsigned int i = 0; i < sizeof(uint64_t); ++i)
+        {
+            trailer[i] = static_cast<char>((sectionOffset >> (8 * i)) & 0xFF);
+        }
+        std::copy(std::begin(ExternalDataMagic), std::end(ExternalDataMagic), trailer + sizeof(uint64_t));
+        stream.write(trailer, sizeof(trailer));
+    }
     return !stream.bad();
 }
 
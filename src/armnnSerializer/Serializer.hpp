@@ -1,16 +1,19 @@
 //
-// Copyright © 2017,2019-2023 Arm Ltd and Contributors. All rights reserved.
+// Copyright © 2017,2019-2024 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 #pragma once
 
+#include <armnn/INetwork.hpp>
 #include <armnn/IStrategy.hpp>
 
 #include <armnnSerializer/ISerializer.hpp>
 
 #include <common/include/ProfilingGuid.hpp>
 
+#include <cstdint>
 #include <unordered_map>
+#include <vector>
 
 #include "ArmnnSchema_generated.h"
 
@@ -19,6 +22,15 @@
 namespace armnnSerializer
 {
 
+// When constant tensors are serialized as external data the file is laid out as:
+//   - the SerializedGraph flatbuffer, padded with zeros to a multiple of ExternalDataSectionAlignment;
+//   - the external data section, where each tensor starts at a multiple of ExternalTensorAlignment;
+//   - a trailer holding the offset of the section in the file, as a little endian uint64, and ExternalDataMagic.
+// The deserializer has a copy of these values.
+constexpr uint64_t ExternalDataSectionAlignment = 4096;
+constexpr uint64_t ExternalTensorAlignment = 64;
+constexpr char ExternalDataMagic[8] = { 'A', 'R', 'M', 'N', 'E', 'X', 'T', '1' };
+
 class SerializerStrategy : public armnn::IStrategy
 {
 public:
@@ -53,6 +65,32 @@ public:
 
     flatbuffers::Offset<armnnSerializer::FeatureCompatibilityVersions> GetVersionTable();
 
+    /// Clears what was serialized before, so that a serializer can be used for more than one network.
+    /// @param externalConstantData Store the data of constant tensors in the external data section rather than in
+    ///                             the flatbuffer.
+    void Reset(bool externalConstantData)
+    {
+        m_flatBufferBuilder.Clear();
+        m_serializedLayers.clear();
+        m_inputIds.clear();
+        m_outputIds.clear();
+        m_guidMap.clear();
+        m_layerId = 0;
+        m_ExternalConstantData = externalConstantData;
+        m_ExternalData.clear();
+    }
+
+    const std::vector<uint8_t>& GetExternalData() const
+    {
+        return m_ExternalData;
+    }
+
+    /// Record the placement of each layer in this optimized network along with the layer.
+    void SetOptimizedNetwork(const armnn::IOptimizedNetwork* optimizedNetwork)
+    {
+        m_OptimizedNetwork = optimizedNetwork;
+    }
+
 private:
     /// Creates the Input Slots and Output Slots and LayerBase for the layer.
     flatbuffers::Offset<armnnSerializer::LayerBase> CreateLayerBase(
@@ -75,13 +113,15 @@ private:
     ///Function which maps Guid to an index
     uint32_t GetSerializedId(LayerGuid guid);
 
-    /// Creates the serializer InputSlots for the layer.
+    /// Creates the serializer InputSlots for the layer. placement is null unless the network is optimized.
     std::vector<flatbuffers::Offset<armnnSerializer::InputSlot>> CreateInputSlots(
-    const armnn::IConnectableLayer* layer);
+    const armnn::IConnectableLayer* layer,
+    const armnn::OptimizedLayerPlacement* placement);
 
-    /// Creates the serializer OutputSlots for the layer.
+    /// Creates the serializer OutputSlots for the layer. placement is null unless the network is optimized.
     std::vector<flatbuffers::Offset<armnnSerializer::OutputSlot>> CreateOutputSlots(
-    const armnn::IConnectableLayer* layer);
+    const armnn::IConnectableLayer* layer,
+    const armnn::OptimizedLayerPlacement* placement);
 
     /// FlatBufferBuilder to create our layers' FlatBuffers.
     flatbuffers::FlatBufferBuilder m_flatBufferBuilder;
@@ -101,6 +141,15 @@ private:
     /// layer within our FlatBuffer index.
     uint32_t m_layerId;
 
+    /// Whether the data of constant tensors goes to m_ExternalData.
+    bool m_ExternalConstantData = false;
+
+    /// The external data section, written after the flatbuffer.
+    std::vector<uint8_t> m_ExternalData;
+
+    /// The optimized network being serialized, if it is one.
+    const armnn::IOptimizedNetwork* m_OptimizedNetwork = nullptr;
+
 private:
     void SerializeActivationLayer(const armnn::IConnectableLayer* layer,
                                   const armnn::ActivationDescriptor& descriptor,
@@ -236,6 +285,18 @@ private:
     void SerializeMergeLayer(const armnn::IConnectableLayer* layer,
                              const char* name = nullptr);
 
+    void SerializeMemCopyLayer(const armnn::IConnectableLayer* layer,
+                               const char* name = nullptr);
+
+    void SerializeMemImportLayer(const armnn::IConnectableLayer* layer,
+                                 const char* name = nullptr);
+
+    void SerializeConvertFp16ToFp32Layer(const armnn::IConnectableLayer* layer,
+                                         const char* name = nullptr);
+
+    void SerializeConvertFp32ToFp16Layer(const armnn::IConnectableLayer* layer,
+                                         const char* name = nullptr);
+
     void SerializeMultiplicationLayer(const armnn::IConnectableLayer* layer,
                                       const char* name = nullptr);
 
@@ -368,6 +429,13 @@ public:
     /// @param [in] inNetwork The network to be serialized.
     void Serialize(const armnn::INetwork& inNetwork);
 
+    /// Serializes the network to ArmNN SerializedGraph, with the data of constant tensors stored outside of it
+    /// if externalConstantData is true.
+    void Serialize(const armnn::INetwork& inNetwork, bool externalConstantData);
+
+    /// Serializes the optimized network to ArmNN SerializedGraph, along with the placement of its layers.
+    void Serialize(const armnn::IOptimizedNetwork& optimizedNetwork, bool externalConstantData);
+
     /// Serializes the SerializedGraph to the stream.
     /// @param [stream] the stream to save to
     /// @return true if graph is Serialized to the Stream, false otherwise
@@ -1,5 +1,5 @@
 //
-// Copyright © 2017,2020-2023 Arm Ltd and Contributors. All rights reserved.
+// Copyright © 2017,2020-2024 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 
@@ -8,13 +8,20 @@
 
 #include <armnn/Descriptors.hpp>
 #include <armnn/INetwork.hpp>
+#include <armnn/IRuntime.hpp>
 #include <armnn/TypesUtils.hpp>
 #include <armnn/LstmParams.hpp>
 #include <armnn/QuantizedLstmParams.hpp>
 #include <armnnDeserializer/IDeserializer.hpp>
 #include <armnn/utility/IgnoreUnused.hpp>
+#include <armnn/utility/NumericCast.hpp>
+#include <armnnUtils/Filesystem.hpp>
 
+#include <algorithm>
+#include <cstring>
+#include <fstream>
 #include <random>
+#include <sstream>
 #include <vector>
 
 #include <doctest/doctest.h>
@@ -379,6 +386,264 @@ TEST_CASE("SerializeConstant")
     deserializedNetwork->ExecuteStrategy(verifier);
 }
 
+TEST_CASE("SerializeConstantsAsExternalData")
+{
+    class ConstantsVerifier : public armnn::IStrategy
+    {
+    public:
+        explicit ConstantsVerifier(const std::vector<armnn::ConstTensor>& constants)
+            : m_Constants(constants) {}
+
+        void ExecuteStrategy(const armnn::IConnectableLayer* layer,
+                             const armnn::BaseDescriptor& descriptor,
+                             const std::vector<armnn::ConstTensor>& constants,
+                             const char* name,
+                             const armnn::LayerBindingId id = 0) override
+        {
+            armnn::IgnoreUnused(descriptor, name, id);
+            if (layer->GetType() == armnn::LayerType::Constant)
+            {
+                REQUIRE(constants.size() == 1);
+                CompareConstTensor(constants[0], m_Constants[m_NumConstants++]);
+            }
+        }
+
+        unsigned int m_NumConstants = 0;
+
+    private:
+        const std::vector<armnn::ConstTensor> m_Constants;
+    };
+
+    const armnn::TensorInfo floatInfo({ 2, 3 }, armnn::DataType::Float32, 0.0f, 0, true);
+    const armnn::TensorInfo byteInfo({ 5 }, armnn::DataType::QAsymmS8, 0.5f, 1, true);
+    std::vector<float> floatData = GenerateRandomData<float>(floatInfo.GetNumElements());
+    std::vector<int8_t> byteData = GenerateRandomData<int8_t>(byteInfo.GetNumElements());
+    const std::vector<armnn::ConstTensor> constants = { armnn::ConstTensor(floatInfo, floatData),
+                                                        armnn::ConstTensor(byteInfo, byteData) };
+
+    armnn::INetworkPtr network(armnn::INetwork::Create());
+    for (unsigned int i = 0; i < constants.size(); ++i)
+    {
+        armnn::IConnectableLayer* constant = network->AddConstantLayer(constants[i]);
+        armnn::IConnectableLayer* output = network->AddOutputLayer(armnn::numeric_cast<armnn::LayerBindingId>(i));
+        constant->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+        constant->GetOutputSlot(0).SetTensorInfo(constants[i].GetInfo());
+    }
+
+    armnnSerializer::ISerializerPtr serializer = armnnSerializer::ISerializer::Create();
+    serializer->Serialize(*network, true);
+    std::stringstream stream;
+    serializer->SaveSerializedToStream(stream);
+    const std::string serialized = stream.str();
+
+    // The section is page aligned and each tensor in it starts on a 64 byte boundary.
+    const size_t trailerSize = sizeof(uint64_t) + sizeof(armnnSerializer::ExternalDataMagic);
+    REQUIRE(serialized.size() > armnnSerializer::ExternalDataSectionAlignment + trailerSize);
+    CHECK(std::equal(std::begin(armnnSerializer::ExternalDataMagic), std::end(armnnSerializer::ExternalDataMagic),
+                     serialized.end() - sizeof(armnnSerializer::ExternalDataMagic)));
+    uint64_t sectionOffset = 0;
+    for (unsigned int i = 0; i < sizeof(uint64_t); ++i)
+    {
+        sectionOffset |= static_cast<uint64_t>(static_cast<uint8_t>(serialized[serialized.size() - trailerSize + i]))
+                         << (8 * i);
+    }
+    CHECK(sectionOffset % armnnSerializer::ExternalDataSectionAlignment == 0);
+    CHECK(std::memcmp(serialized.data() + sectionOffset, floatData.data(), floatInfo.GetNumBytes()) == 0);
+    CHECK(std::memcmp(serialized.data() + sectionOffset + armnnSerializer::ExternalTensorAlignment,
+                      byteData.data(),
+                      byteInfo.GetNumBytes()) == 0);
+
+    armnn::INetworkPtr deserializedNetwork = DeserializeNetwork(serialized);
+    REQUIRE(deserializedNetwork);
+    ConstantsVerifier verifier(constants);
+    deserializedNetwork->ExecuteStrategy(verifier);
+    CHECK(verifier.m_NumConstants == constants.size());
+
+    const fs::path fileName = armnnUtils::Filesystem::NamedTempFile("Armnn-SerializeConstantsAsExternalData.armnn");
+    {
+        std::ofstream file(fileName, std::ios::binary);
+        file.write(serialized.data(), armnn::numeric_cast<std::streamsize>(serialized.size()));
+    }
+    armnn::INetworkPtr networkFromFile =
+        IDeserializer::Create()->CreateNetworkFromBinaryFile(fileName.string().c_str());
+    fs::remove(fileName);
+    REQUIRE(networkFromFile);
+    ConstantsVerifier fileVerifier(constants);
+    networkFromFile->ExecuteStrategy(fileVerifier);
+    CHECK(fileVerifier.m_NumConstants == constants.size());
+}
+
+TEST_CASE("SerializerReuse")
+{
+    const armnn::TensorInfo info({ 2, 3 }, armnn::DataType::Float32, 0.0f, 0, true);
+    std::vector<float> data = GenerateRandomData<float>(info.GetNumElements());
+    armnn::ConstTensor constTensor(info, data);
+
+    armnn::INetworkPtr network(armnn::INetwork::Create());
+    armnn::IConnectableLayer* constant = network->AddConstantLayer(constTensor);
+    armnn::IConnectableLayer* output = network->AddOutputLayer(0);
+    constant->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+    constant->GetOutputSlot(0).SetTensorInfo(info);
+
+    // Nothing of the network serialized first, nor of its external data, is left in the second one.
+    armnnSerializer::ISerializerPtr serializer = armnnSerializer::ISerializer::Create();
+    serializer->Serialize(*network, true);
+    std::stringstream externalStream;
+    serializer->SaveSerializedToStream(externalStream);
+
+    serializer->Serialize(*network);
+    std::stringstream stream;
+    serializer->SaveSerializedToStream(stream);
+    const std::string serialized = stream.str();
+
+    CHECK(serialized == SerializeNetwork(*network));
+    CHECK(!std::equal(std::begin(armnnSerializer::ExternalDataMagic), std::end(armnnSerializer::ExternalDataMagic),
+                      serialized.end() - sizeof(armnnSerializer::ExternalDataMagic)));
+    CHECK(DeserializeNetwork(serialized));
+}
+
+TEST_CASE("SerializeOptimizedNetwork")
+{
+    armnn::IRuntimePtr runtime(armnn::IRuntime::Create(armnn::IRuntime::CreationOptions()));
+
+    const armnn::TensorInfo info({ 1, 4 }, armnn::DataType::Float32);
+    armnn::INetworkPtr network(armnn::INetwork::Create());
+    armnn::IConnectableLayer* input = network->AddInputLayer(0, "input");
+    armnn::ActivationDescriptor reluDesc;
+    reluDesc.m_Function = armnn::ActivationFunction::ReLu;
+    armnn::IConnectableLayer* relu = network->AddActivationLayer(reluDesc, "relu");
+    armnn::IConnectableLayer* output = network->AddOutputLayer(0, "output");
+    input->GetOutputSlot(0).Connect(relu->GetInputSlot(0));
+    relu->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+    input->GetOutputSlot(0).SetTensorInfo(info);
+    relu->GetOutputSlot(0).SetTensorInfo(info);
+
+    armnn::IOptimizedNetworkPtr optimizedNetwork =
+        armnn::Optimize(*network, { armnn::Compute::CpuRef }, runtime->GetDeviceSpec());
+    armnnSerializer::ISerializerPtr serializer = armnnSerializer::ISerializer::Create();
+    serializer->Serialize(*optimizedNetwork);
+    std::stringstream stream;
+    serializer->SaveSerializedToStream(stream);
+    const std::string serialized = stream.str();
+    const std::vector<uint8_t> binary(serialized.begin(), serialized.end());
+
+    // A network which isn't optimized has no placements to rebuild an optimized network from.
+    armnnSerializer::ISerializerPtr networkSerializer = armnnSerializer::ISerializer::Create();
+    networkSerializer->Serialize(*network);
+    std::stringstream networkStream;
+    networkSerializer->SaveSerializedToStream(networkStream);
+    const std::string networkSerialized = networkStream.str();
+    CHECK_THROWS_AS(IDeserializer::Create()->CreateOptimizedNetworkFromBinary(
+                        std::vector<uint8_t>(networkSerialized.begin(), networkSerialized.end())),
+                    armnn::ParseException);
+
+    armnn::IOptimizedNetworkPtr deserialized = IDeserializer::Create()->CreateOptimizedNetworkFromBinary(binary);
+    REQUIRE(deserialized);
+    armnn::NetworkId networkId;
+    REQUIRE(runtime->LoadNetwork(networkId, std::move(deserialized)) == armnn::Status::Success);
+
+    std::vector<float> inputData = { -1.0f, 2.0f, -3.0f, 4.0f };
+    std::vector<float> outputData(4, -1.0f);
+    armnn::TensorInfo inputInfo = info;
+    inputInfo.SetConstant(true);
+    armnn::InputTensors inputTensors{ { 0, armnn::ConstTensor(inputInfo, inputData.data()) } };
+    armnn::OutputTensors outputTensors{ { 0, armnn::Tensor(info, outputData.data()) } };
+    REQUIRE(runtime->EnqueueWorkload(networkId, inputTensors, outputTensors) == armnn::Status::Success);
+    CHECK(outputData == std::vector<float>({ 0.0f, 2.0f, 0.0f, 4.0f }));
+}
+
+#if defined(ARMCOMPUTENEON_ENABLED)
+TEST_CASE("SerializeOptimizedNetworkWithFusedActivation")
+{
+    // Takes the activation fused into the convolution of an optimized network.
+    class FusedActivationCollector : public armnn::IStrategy
+    {
+    public:
+        explicit FusedActivationCollector(const armnn::IOptimizedNetwork& optimizedNetwork)
+            : m_OptimizedNetwork(optimizedNetwork) {}
+
+        void ExecuteStrategy(const armnn::IConnectableLayer* layer,
+                             const armnn::BaseDescriptor& descriptor,
+                             const std::vector<armnn::ConstTensor>& constants,
+                             const char* name,
+                             const armnn::LayerBindingId id = 0) override
+        {
+            armnn::IgnoreUnused(descriptor, constants, name, id);
+            if (layer->GetType() == armnn::LayerType::Convolution2d)
+            {
+                m_FusedActivation = m_OptimizedNetwork.GetLayerPlacement(*layer).m_FusedActivation;
+            }
+        }
+
+        const armnn::IOptimizedNetwork& m_OptimizedNetwork;
+        std::shared_ptr<armnn::ActivationDescriptor> m_FusedActivation;
+    };
+
+    armnn::IRuntimePtr runtime(armnn::IRuntime::Create(armnn::IRuntime::CreationOptions()));
+
+    const armnn::TensorInfo info({ 1, 2, 2, 1 }, armnn::DataType::Float32);
+    const armnn::TensorInfo weightsInfo({ 1, 1, 1, 1 }, armnn::DataType::Float32, 0.0f, 0, true);
+    std::vector<float> weightsData = { 2.0f };
+    armnn::ConstTensor weights(weightsInfo, weightsData);
+
+    armnn::Convolution2dDescriptor convDesc;
+    convDesc.m_StrideX = 1;
+    convDesc.m_StrideY = 1;
+    convDesc.m_BiasEnabled = false;
+    convDesc.m_DataLayout = armnn::DataLayout::NHWC;
+    armnn::ActivationDescriptor reluDesc;
+    reluDesc.m_Function = armnn::ActivationFunction::ReLu;
+
+    armnn::INetworkPtr network(armnn::INetwork::Create());
+    armnn::IConnectableLayer* input = network->AddInputLayer(0, "input");
+    armnn::IConnectableLayer* weightsLayer = network->AddConstantLayer(weights, "weights");
+    armnn::IConnectableLayer* conv = network->AddConvolution2dLayer(convDesc, "conv");
+    armnn::IConnectableLayer* relu = network->AddActivationLayer(reluDesc, "relu");
+    armnn::IConnectableLayer* output = network->AddOutputLayer(0, "output");
+    input->GetOutputSlot(0).Connect(conv->GetInputSlot(0));
+    weightsLayer->GetOutputSlot(0).Connect(conv->GetInputSlot(1));
+    conv->GetOutputSlot(0).Connect(relu->GetInputSlot(0));
+    relu->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+    input->GetOutputSlot(0).SetTensorInfo(info);
+    weightsLayer->GetOutputSlot(0).SetTensorInfo(weightsInfo);
+    conv->GetOutputSlot(0).SetTensorInfo(info);
+    relu->GetOutputSlot(0).SetTensorInfo(info);
+
+    // CpuAcc fuses the activation into the convolution.
+    armnn::IOptimizedNetworkPtr optimizedNetwork =
+        armnn::Optimize(*network, { armnn::Compute::CpuAcc }, runtime->GetDeviceSpec());
+    FusedActivationCollector collector(*optimizedNetwork);
+    optimizedNetwork->ExecuteStrategy(collector);
+    REQUIRE(collector.m_FusedActivation);
+
+    armnnSerializer::ISerializerPtr serializer = armnnSerializer::ISerializer::Create();
+    serializer->Serialize(*optimizedNetwork);
+    std::stringstream stream;
+    serializer->SaveSerializedToStream(stream);
+    const std::string serialized = stream.str();
+
+    armnn::IOptimizedNetworkPtr deserialized = IDeserializer::Create()->CreateOptimizedNetworkFromBinary(
+        std::vector<uint8_t>(serialized.begin(), serialized.end()));
+    REQUIRE(deserialized);
+    FusedActivationCollector deserializedCollector(*deserialized);
+    deserialized->ExecuteStrategy(deserializedCollector);
+    REQUIRE(deserializedCollector.m_FusedActivation);
+    CHECK(*deserializedCollector.m_FusedActivation == reluDesc);
+
+    armnn::NetworkId networkId;
+    REQUIRE(runtime->LoadNetwork(networkId, std::move(deserialized)) == armnn::Status::Success);
+
+    std::vector<float> inputData = { -1.0f, 2.0f, -3.0f, 4.0f };
+    std::vector<float> outputData(4, -1.0f);
+    armnn::TensorInfo inputInfo = info;
+    inputInfo.SetConstant(true);
+    armnn::InputTensors inputTensors{ { 0, armnn::ConstTensor(inputInfo, inputData.data()) } };
+    armnn::OutputTensors outputTensors{ { 0, armnn::Tensor(info, outputData.data()) } };
+    REQUIRE(runtime->EnqueueWorkload(networkId, inputTensors, outputTensors) == armnn::Status::Success);
+    CHECK(outputData == std::vector<float>({ 0.0f, 4.0f, 0.0f, 8.0f }));
+}
+#endif
+
 using Convolution2dDescriptor = armnn::Convolution2dDescriptor;
 class Convolution2dLayerVerifier : public LayerVerifierBaseWithDescriptor<Convolution2dDescriptor>
 {
@@ -0,0 +1,165 @@
+//
+// Copyright © 2024 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "ChromeTraceWriter.hpp"
+
+#include <iomanip>
+#include <ios>
+#include <sstream>
+
+namespace armnnUtils
+{
+
+namespace
+{
+
+std::string Escape(const std::string& value)
+{
+    std::stringstream escaped;
+    for (char c : value)
+    {
+        switch (c)
+        {
+            case '"':  escaped << "\\\""; break;
+            case '\\': escaped << "\\\\"; break;
+            case '\n': escaped << "\\n";  break;
+            case '\r': escaped << "\\r";  break;
+            case '\t': escaped << "\\t";  break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20)
+                {
+                    escaped << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c);
+                }
+                else
+                {
+                    escaped << c;
+                }
+        }
+    }
+    return escaped.str();
+}
+
+} // anonymous namespace
+
+ChromeTraceWriter::ChromeTraceWriter(std::ostream& stream)
+    : m_Stream(stream)
+    , m_FirstEvent(true)
+    , m_Closed(false)
+{
+    m_Stream << "[";
+}
+
+ChromeTraceWriter::~ChromeTraceWriter()
+{
+    Close();
+}
+
+void ChromeTraceWriter::WriteCompleteEvent(const std::string& name,
+                                           const std::string& category,
+                                           int processId,
+                                           int threadId,
+                                           double timestampUs,
+                                           double durationUs,
+                                           const Args& args)
+{
+    BeginEvent("X", name, processId, threadId);
+    m_Stream << ",\"cat\":\"" << Escape(category) << "\"";
+    WriteTimestamp("ts", timestampUs);
+    WriteTimestamp("dur", durationUs);
+    WriteArgs(args);
+    EndEvent();
+}
+
+void ChromeTraceWriter::WriteAsyncBeginEvent(const std::string& name,
+                                             const std::string& category,
+                                             uint64_t id,
+                                             int processId,
+                                             int threadId,
+                                             double timestampUs,
+                                             const Args& args)
+{
+    BeginEvent("b", name, processId, threadId);
+    m_Stream << ",\"cat\":\"" << Escape(category) << "\",\"id\":\"" << id << "\"";
+    WriteTimestamp("ts", timestampUs);
+    WriteArgs(args);
+    EndEvent();
+}
+
+void ChromeTraceWriter::WriteAsyncEndEvent(const std::string& name,
+                                           const std::string& category,
+                                           uint64_t id,
+                                           int processId,
+                                           int threadId,
+                                           double timestampUs)
+{
+    BeginEvent("e", name, processId, threadId);
+    m_Stream << ",\"cat\":\"" << Escape(category) << "\",\"id\":\"" << id << "\"";
+    WriteTimestamp("ts", timestampUs);
+    EndEvent();
+}
+
+void ChromeTraceWriter::WriteProcessName(int processId, const std::string& name)
+{
+    BeginEvent("M", "process_name", processId, 0);
+    WriteArgs({ { "name", name } });
+    EndEvent();
+}
+
+void ChromeTraceWriter::WriteThreadName(int processId, int threadId, const std::string& name)
+{
+    BeginEvent("M", "thread_name", processId, threadId);
+    WriteArgs({ { "name", name } });
+    EndEvent();
+}
+
+void ChromeTraceWriter::Close()
+{
+    if (!m_Closed)
+    {
+        m_Stream << "\n]\n";
+        m_Stream.flush();
+        m_Closed = true;
+    }
+}
+
+void ChromeTraceWriter::BeginEvent(const char* phase, const std::string& name, int processId, int threadId)
+{
+    m_Stream << (m_FirstEvent ? "\n" : ",\n");
+    m_FirstEvent = false;
+    m_Stream << "{\"ph\":\"" << phase << "\",\"name\":\"" << Escape(name) << "\""
+             << ",\"pid\":" << processId << ",\"tid\":" << threadId;
+}
+
+void ChromeTraceWriter::WriteTimestamp(const char* key, double valueUs)
+{
+    // Down to the nanosecond, without the exponents which some viewers don't parse
+    const std::ios_base::fmtflags oldFlags = m_Stream.flags();
+    const std::streamsize oldPrecision = m_Stream.precision(3);
+    m_Stream.setf(std::ios::fixed, std::ios::floatfield);
+    m_Stream << ",\"" << key << "\":" << valueUs;
+    m_Stream.flags(oldFlags);
+    m_Stream.precision(oldPrecision);
+}
+
+void ChromeTraceWriter::WriteArgs(const Args& args)
+{
+    if (args.empty())
+    {
+        return;
+    }
+    m_Stream << ",\"args\":{";
+    for (size_t i = 0; i < args.size(); ++i)
+    {
+        m_Stream << (i == 0 ? "" : ",") << "\"" << Escape(args[i].first) << "\":\"" << Escape(args[i].second) << "\"";
+    }
+    m_Stream << "}";
+}
+
+void ChromeTraceWriter::EndEvent()
+{
+    m_Stream << "}";
+}
+
+} // namespace armnnUtils
@@ -0,0 +1,81 @@
+//
+// Copyright © 2024 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace armnnUtils
+{
+
+/// Writes events in the Chrome Trace Event format, which chrome://tracing, Perfetto and other trace viewers load.
+/// Each event is written out as soon as it is added, using the JSON array form of the format whose closing bracket
+/// is optional, so that a trace which is cut short still loads.
+/// Timestamps and durations are in microseconds. Events sharing a process and thread id are drawn on the same track.
+class ChromeTraceWriter
+{
+public:
+    /// Extra information shown with an event, as name and value pairs.
+    using Args = std::vector<std::pair<std::string, std::string>>;
+
+    explicit ChromeTraceWriter(std::ostream& stream);
+
+    /// Closes the trace.
+    ~ChromeTraceWriter();
+
+    ChromeTraceWriter(const ChromeTraceWriter&) = delete;
+    ChromeTraceWriter& operator=(const ChromeTraceWriter&) = delete;
+
+    /// An event with a known duration, nested under the events of the same thread it falls within.
+    void WriteCompleteEvent(const std::string& name,
+                            const std::string& category,
+                            int processId,
+                            int threadId,
+                            double timestampUs,
+                            double durationUs,
+                            const Args& args = {});
+
+    /// The start of a span which is drawn on a track of its own, so that spans may overlap, e.g. inferences running
+    /// at the same time. The span with the same category and id is ended by WriteAsyncEndEvent().
+    void WriteAsyncBeginEvent(const std::string& name,
+                              const std::string& category,
+                              uint64_t id,
+                              int processId,
+                              int threadId,
+                              double timestampUs,
+                              const Args& args = {});
+
+    void WriteAsyncEndEvent(const std::string& name,
+                            const std::string& category,
+                            uint64_t id,
+                            int processId,
+                            int threadId,
+                            double timestampUs);
+
+    /// Names the track of a process.
+    void WriteProcessName(int processId, const std::string& name);
+
+    /// Names the track of a thread.
+    void WriteThreadName(int processId, int threadId, const std::string& name);
+
+    /// Ends the trace. Nothing can be written afterwards.
+    void Close();
+
+private:
+    void BeginEvent(const char* phase, const std::string& name, int processId, int threadId);
+    void WriteTimestamp(const char* key, double valueUs);
+    void WriteArgs(const Args& args);
+    void EndEvent();
+
+    std::ostream& m_Stream;
+    bool m_FirstEvent;
+    bool m_Closed;
+};
+
+} // namespace armnnUtils
@@ -73,10 +73,6 @@ bool IWorkloadFactory::IsLayerConfigurationSupported(const BackendId& backendId,
                                                      std::string& outReasonIfUnsupported,
                                                      const ModelOptions& modelOptions)
 {
-    Optional<std::string&> reason = outReasonIfUnsupported;
-    bool result;
-    const Layer& layer = *(PolymorphicDowncast<const Layer*>(&connectableLayer));
-
     auto const& backendRegistry = BackendRegistryInstance();
     if (!backendRegistry.IsBackendRegistered(backendId))
     {
@@ -91,6 +87,19 @@ bool IWorkloadFactory::IsLayerConfigurationSupported(const BackendId& backendId,
     auto backendFactory = backendRegistry.GetFactory(backendId);
     auto backendObject = backendFactory();
     auto layerSupport = backendObject->GetLayerSupport(modelOptions);
+    return IsLayerConfigurationSupported(backendId, layerSupport, connectableLayer, dataType, outReasonIfUnsupported);
+}
+
+bool IWorkloadFactory::IsLayerConfigurationSupported(const BackendId& backendId,
+                                                     const std::shared_ptr<ILayerSupport>& layerSupport,
+                                                     const IConnectableLayer& connectableLayer,
+                                                     Optional<DataType> dataType,
+                                                     std::string& outReasonIfUnsupported)
+{
+    Optional<std::string&> reason = outReasonIfUnsupported;
+    bool result;
+    const Layer& layer = *(PolymorphicDowncast<const Layer*>(&connectableLayer));
+
     auto layerSupportObject = LayerSupportHandle(layerSupport, backendId);
 
     switch(layer.GetType())
@@ -1653,4 +1662,17 @@ bool IWorkloadFactory::IsLayerSupported(const BackendId& backendId,
                                          modelOptions);
 }
 
+bool IWorkloadFactory::IsLayerSupported(const BackendId& backendId,
+                                        const std::shared_ptr<ILayerSupport>& layerSupport,
+                                        const IConnectableLayer& connectableLayer,
+                                        Optional<DataType> dataType,
+                                        std::string& outReasonIfUnsupported)
+{
+    return IsLayerConfigurationSupported(backendId,
+                                         layerSupport,
+                                         connectableLayer,
+                                         dataType,
+                                         outReasonIfUnsupported);
+}
+
 } // namepsace armnn
@@ -1,5 +1,5 @@
 //
-// Copyright © 2017, 2023 Arm Ltd and Contributors. All rights reserved.
+// Copyright © 2017, 2023-2024 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 
@@ -1389,6 +1389,58 @@ LayerTestResult<T, 4> IgnorePaddingL2Pooling2dSize3TestCommon(
         input, outputExpected, inputTensorInfo.GetShape(), outputTensorInfo.GetShape());
 }
 
+//
+// Runs the pooling on the same data in NCHW and NHWC, which take different code paths in the reference backend, and
+// checks they agree.
+//
+template<armnn::DataType ArmnnType, typename T = armnn::ResolveType<ArmnnType>>
+LayerTestResult<T, 4> Pooling2dNhwcMatchesNchwTestCommon(
+    armnn::IWorkloadFactory& workloadFactory,
+    const armnn::IBackendInternal::IMemoryManagerSharedPtr& memoryManager,
+    const armnn::ITensorHandleFactory& tensorHandleFactory,
+    armnn::Pooling2dDescriptor descriptor,
+    unsigned int inputHeight,
+    unsigned int inputWidth)
+{
+    const unsigned int batches = 2;
+    const unsigned int channels = 3;
+    const unsigned int outputHeight = (inputHeight + descriptor.m_PadTop + descriptor.m_PadBottom -
+                                       descriptor.m_PoolHeight) / descriptor.m_StrideY + 1;
+    const unsigned int outputWidth = (inputWidth + descriptor.m_PadLeft + descriptor.m_PadRight -
+                                      descriptor.m_PoolWidth) / descriptor.m_StrideX + 1;
+
+    armnn::TensorInfo inputTensorInfo  = armnnUtils::GetTensorInfo(
+        batches, channels, inputHeight, inputWidth, armnn::DataLayout::NCHW, ArmnnType);
+    armnn::TensorInfo outputTensorInfo = armnnUtils::GetTensorInfo(
+        batches, channels, outputHeight, outputWidth, armnn::DataLayout::NCHW, ArmnnType);
+
+    std::vector<T> inputData = MakeRandomTensor<T>(inputTensorInfo, 20240);
+
+    // The output in NCHW, permuted, is the expected output in NHWC.
+    descriptor.m_DataLayout = armnn::DataLayout::NCHW;
+    LayerTestResult<T, 4> nchwResult = SimplePooling2dTestImpl<ArmnnType>(
+        workloadFactory, memoryManager, tensorHandleFactory, descriptor, 1.0f, 0,
+        inputData, std::vector<T>(outputTensorInfo.GetNumElements()),
+        inputTensorInfo.GetShape(), outputTensorInfo.GetShape());
+    if (!nchwResult.m_Supported)
+    {
+        return nchwResult;
+    }
+
+    const armnn::PermutationVector NCHWToNHWC = { 0, 3, 1, 2 };
+    const armnn::TensorShape nhwcInputShape = armnnUtils::Permuted(inputTensorInfo.GetShape(), NCHWToNHWC);
+    const armnn::TensorShape nhwcOutputShape = armnnUtils::Permuted(outputTensorInfo.GetShape(), NCHWToNHWC);
+    std::vector<T> nhwcInputData(inputData.size());
+    armnnUtils::Permute(nhwcInputShape, NCHWToNHWC, inputData.data(), nhwcInputData.data(), sizeof(T));
+    std::vector<T> nhwcOutputData(nchwResult.m_ActualData.size());
+    armnnUtils::Permute(nhwcOutputShape, NCHWToNHWC, nchwResult.m_ActualData.data(), nhwcOutputData.data(), sizeof(T));
+
+    descriptor.m_DataLayout = armnn::DataLayout::NHWC;
+    return SimplePooling2dTestImpl<ArmnnType>(
+        workloadFactory, memoryManager, tensorHandleFactory, descriptor, 1.0f, 0,
+        nhwcInputData, nhwcOutputData, nhwcInputShape, nhwcOutputShape);
+}
+
 } // anonymous namespace
 
 LayerTestResult<float, 4> SimpleMaxPooling2dSize2x2Stride2x2Test(
@@ -1961,3 +2013,60 @@ LayerTestResult<int16_t, 4> ComparePooling2dInt16Test(
     return ComparePooling2dTestCommon<armnn::DataType::QSymmS16>(
         workloadFactory, memoryManager,  refWorkloadFactory, tensorHandleFactory, refTensorHandleFactory, poolingType);
 }
+
+LayerTestResult<float, 4> OverlappingPooling2dNhwcMatchesNchwTest(
+    armnn::IWorkloadFactory& workloadFactory,
+    const armnn::IBackendInternal::IMemoryManagerSharedPtr& memoryManager,
+    const armnn::ITensorHandleFactory& tensorHandleFactory,
+    armnn::PoolingAlgorithm poolType)
+{
+    armnn::Pooling2dDescriptor descriptor;
+    descriptor.m_PoolType = poolType;
+    descriptor.m_PoolWidth = descriptor.m_PoolHeight = 3;
+    descriptor.m_StrideX = descriptor.m_StrideY = 1;
+
+    return Pooling2dNhwcMatchesNchwTestCommon<armnn::DataType::Float32>(
+        workloadFactory, memoryManager, tensorHandleFactory, descriptor, 7, 6);
+}
+
+LayerTestResult<float, 4> PaddedPooling2dNhwcMatchesNchwTest(
+    armnn::IWorkloadFactory& workloadFactory,
+    const armnn::IBackendInternal::IMemoryManagerSharedPtr& memoryManager,
+    const armnn::ITensorHandleFactory& tensorHandleFactory,
+    armnn::PoolingAlgorithm poolType,
+    armnn::PaddingMethod paddingMethod)
+{
+    armnn::Pooling2dDescriptor descriptor;
+    descriptor.m_PoolType = poolType;
+    descriptor.m_PaddingMethod = paddingMethod;
+    descriptor.m_PoolWidth = descriptor.m_PoolHeight = 3;
+    descriptor.m_StrideX = 2;
+    descriptor.m_StrideY = 1;
+    descriptor.m_PadLeft = descriptor.m_PadTop = 1;
+    descriptor.m_PadRight = descriptor.m_PadBottom = 2;
+
+    return Pooling2dNhwcMatchesNchwTestCommon<armnn::DataType::Float32>(
+        workloadFactory, memoryManager, tensorHandleFactory, descriptor, 5, 8);
+}
+
+LayerTestResult<float, 4> PaddingOnlyWindowsPooling2dNhwcMatchesNchwTest(
+    armnn::IWorkloadFactory& workloadFactory,
+    const armnn::IBackendInternal::IMemoryManagerSharedPtr& memoryManager,
+    const armnn::ITensorHandleFactory& tensorHandleFactory,
+    armnn::PoolingAlgorithm poolType,
+    armnn::PaddingMethod paddingMethod)
+{
+    armnn::Pooling2dDescriptor descriptor;
+    descriptor.m_PoolType = poolType;
+    descriptor.m_PaddingMethod = paddingMethod;
+    descriptor.m_PoolWidth = 2;
+    descriptor.m_PoolHeight = 3;
+    descriptor.m_StrideX = descriptor.m_StrideY = 2;
+    descriptor.m_PadLeft = 2;
+    descriptor.m_PadRight = 2;
+    descriptor.m_PadTop = 3;
+    descriptor.m_PadBottom = 2;
+
+    return Pooling2dNhwcMatchesNchwTestCommon<armnn::DataType::Float32>(
+        workloadFactory, memoryManager, tensorHandleFactory, descriptor, 6, 5);
+}
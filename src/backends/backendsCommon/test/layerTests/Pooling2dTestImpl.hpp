@@ -1,5 +1,5 @@
 //
-// Copyright © 2017 Arm Ltd. All rights reserved.
+// Copyright © 2017, 2024 Arm Ltd. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 
@@ -341,3 +341,26 @@ LayerTestResult<int16_t, 4> ComparePooling2dInt16Test(
     const armnn::ITensorHandleFactory& tensorHandleFactory,
     const armnn::ITensorHandleFactory& refTensorHandleFactory,
     armnn::PoolingAlgorithm  poolingType);
+
+// Pooling with overlapping windows and no padding.
+LayerTestResult<float, 4> OverlappingPooling2dNhwcMatchesNchwTest(
+    armnn::IWorkloadFactory& workloadFactory,
+    const armnn::IBackendInternal::IMemoryManagerSharedPtr& memoryManager,
+    const armnn::ITensorHandleFactory& tensorHandleFactory,
+    armnn::PoolingAlgorithm poolType);
+
+// Pooling with padding on every side, with windows partially over the padding.
+LayerTestResult<float, 4> PaddedPooling2dNhwcMatchesNchwTest(
+    armnn::IWorkloadFactory& workloadFactory,
+    const armnn::IBackendInternal::IMemoryManagerSharedPtr& memoryManager,
+    const armnn::ITensorHandleFactory& tensorHandleFactory,
+    armnn::PoolingAlgorithm poolType,
+    armnn::PaddingMethod paddingMethod);
+
+// Pooling with padding as large as the window, so some windows only cover padding.
+LayerTestResult<float, 4> PaddingOnlyWindowsPooling2dNhwcMatchesNchwTest(
+    armnn::IWorkloadFactory& workloadFactory,
+    const armnn::IBackendInternal::IMemoryManagerSharedPtr& memoryManager,
+    const armnn::ITensorHandleFactory& tensorHandleFactory,
+    armnn::PoolingAlgorithm poolType,
+    armnn::PaddingMethod paddingMethod);
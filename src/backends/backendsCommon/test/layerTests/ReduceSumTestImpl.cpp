@@ -1,6 +1,6 @@
 //
 // Copyright © 2020 Samsung Electronics Co Ltd and Contributors. All rights reserved.
-// Copyright © 2021-2022 Arm Ltd and Contributors. All rights reserved.
+// Copyright © 2021-2022, 2024 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 
@@ -79,6 +79,32 @@ LayerTestResult<float, 4> ReduceTestCommon(
                                      outputTensorInfo.GetShape());
 }
 
+// Sums a 4D tensor over the given axes one element at a time, keeping the reduced dimensions as size 1.
+std::vector<float> NaiveReduceSum(const std::vector<float>& input,
+                                  const armnn::TensorShape& inputShape,
+                                  const armnn::TensorShape& outputShape)
+{
+    std::vector<float> output(outputShape.GetNumElements(), 0.0f);
+    unsigned int index[4];
+    for (unsigned int i = 0; i < input.size(); ++i)
+    {
+        unsigned int remainder = i;
+        for (unsigned int dim = 4; dim-- > 0; )
+        {
+            index[dim] = remainder % inputShape[dim];
+            remainder /= inputShape[dim];
+        }
+
+        unsigned int outputIndex = 0;
+        for (unsigned int dim = 0; dim < 4; ++dim)
+        {
+            outputIndex = outputIndex * outputShape[dim] + (outputShape[dim] == 1 ? 0 : index[dim]);
+        }
+        output[outputIndex] += input[i];
+    }
+    return output;
+}
+
 } // namespace
 
 template<armnn::DataType ArmnnType, typename T>
@@ -319,6 +345,40 @@ LayerTestResult<float, 4> ReduceSumMultipleAxisTest(
                                        armnn::ReduceOperation::Sum);
 }
 
+LayerTestResult<float, 4> ReduceSumMatchesNaiveTest(
+        armnn::IWorkloadFactory& workloadFactory,
+        const armnn::IBackendInternal::IMemoryManagerSharedPtr& memoryManager,
+        const armnn::ITensorHandleFactory& tensorHandleFactory,
+        const armnn::TensorShape& inputShape,
+        const std::vector<int32_t>& vAxis)
+{
+    armnn::TensorShape outputShape = inputShape;
+    for (int32_t axis : vAxis)
+    {
+        outputShape[static_cast<unsigned int>(axis)] = 1;
+    }
+
+    armnn::TensorInfo inputTensorInfo(inputShape, armnn::DataType::Float32);
+    armnn::TensorInfo outputTensorInfo(outputShape, armnn::DataType::Float32);
+
+    std::vector<float> inputValues(inputTensorInfo.GetNumElements());
+    for (unsigned int i = 0; i < inputValues.size(); ++i)
+    {
+        inputValues[i] = static_cast<float>(i % 13) - 6.0f;
+    }
+    std::vector<float> outputValues = NaiveReduceSum(inputValues, inputShape, outputShape);
+
+    return ReduceTestCommon<armnn::DataType::Float32>(workloadFactory,
+                                                      memoryManager,
+                                                      tensorHandleFactory,
+                                                      inputTensorInfo,
+                                                      outputTensorInfo,
+                                                      inputValues,
+                                                      outputValues,
+                                                      vAxis,
+                                                      armnn::ReduceOperation::Sum);
+}
+
 // Explicit template specializations
 
 template LayerTestResult<float, 4>
@@ -1,5 +1,5 @@
 //
-// Copyright © 2019 Arm Ltd and Contributors. All rights reserved.
+// Copyright © 2019, 2024 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 
@@ -7,6 +7,8 @@
 
 #include <armnnUtils/QuantizeHelper.hpp>
 
+#include <armnn/TypesUtils.hpp>
+
 
 #include <armnnUtils/TensorUtils.hpp>
 #include <armnnUtils/DataLayoutIndexed.hpp>
@@ -674,6 +676,49 @@ LayerTestResult<T, 4> AlignCornersResizeNearestNeighbourTest(
     return ResizeTestImpl<4, ArmnnType>(workloadFactory, memoryManager, tensorHandleFactory, testParams);
 }
 
+LayerTestResult<uint8_t, 4> ResizeBilinearQAsymmU8MatchesFloatTest(
+    armnn::IWorkloadFactory& workloadFactory,
+    const armnn::IBackendInternal::IMemoryManagerSharedPtr& memoryManager,
+    const armnn::ITensorHandleFactory& tensorHandleFactory,
+    const armnn::DataLayout dataLayout,
+    unsigned int inputHeight,
+    unsigned int inputWidth,
+    unsigned int outputHeight,
+    unsigned int outputWidth,
+    bool alignCorners,
+    bool halfPixelCenters)
+{
+    const float quantScale = 0.25f;
+    const int32_t quantOffset = 100;
+
+    ResizeTestParams testParams;
+    testParams.m_ResizeMethod     = armnn::ResizeMethod::Bilinear;
+    testParams.m_AlignCorners     = alignCorners;
+    testParams.m_HalfPixelCenters = halfPixelCenters;
+
+    testParams.m_InputShape  = { 2, 3, inputHeight, inputWidth };
+    testParams.m_OutputShape = { 2, 3, outputHeight, outputWidth };
+
+    // Inputs that are exactly representable in QAsymmU8, covering its whole range.
+    armnn::TensorInfo quantizedInputInfo(testParams.m_InputShape, armnn::DataType::QAsymmU8, quantScale, quantOffset);
+    std::vector<uint8_t> quantizedInput = MakeRandomTensor<uint8_t>(quantizedInputInfo, 20240, -25.0f, 38.75f);
+    for (uint8_t value : quantizedInput)
+    {
+        testParams.m_InputData.push_back(armnn::Dequantize(value, quantScale, quantOffset));
+    }
+
+    // The Float32 workload gives the expected output, which is then allowed to be off by one quantization step.
+    testParams.m_ExpectedOutputData = std::vector<float>(testParams.m_OutputShape.GetNumElements(), 0.0f);
+    LayerTestResult<float, 4> floatResult =
+        ResizeTestImpl<4, armnn::DataType::Float32>(workloadFactory, memoryManager, tensorHandleFactory, testParams);
+    testParams.m_DataLayout = dataLayout;
+    testParams.m_ExpectedOutputData = floatResult.m_ActualData;
+    testParams.SetInOutQuantParams(quantScale, quantOffset);
+
+    return ResizeTestImpl<4, armnn::DataType::QAsymmU8>(
+        workloadFactory, memoryManager, tensorHandleFactory, testParams);
+}
+
 //
 // Explicit template instantiations
 //
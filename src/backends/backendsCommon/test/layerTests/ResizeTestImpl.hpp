@@ -1,5 +1,5 @@
 //
-// Copyright © 2017 Arm Ltd. All rights reserved.
+// Copyright © 2017, 2024 Arm Ltd. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 
@@ -116,4 +116,17 @@ LayerTestResult<T, 4> AlignCornersResizeNearestNeighbourTest(
     armnn::IWorkloadFactory& workloadFactory,
     const armnn::IBackendInternal::IMemoryManagerSharedPtr& memoryManager,
     const armnn::ITensorHandleFactory& tensorHandleFactory,
-    const armnn::DataLayout dataLayout);
\ No newline at end of file
+    const armnn::DataLayout dataLayout);
+
+// Checks that a QAsymmU8 bilinear resize is within one quantization step of a Float32 resize of the same data.
+LayerTestResult<uint8_t, 4> ResizeBilinearQAsymmU8MatchesFloatTest(
+    armnn::IWorkloadFactory& workloadFactory,
+    const armnn::IBackendInternal::IMemoryManagerSharedPtr& memoryManager,
+    const armnn::ITensorHandleFactory& tensorHandleFactory,
+    const armnn::DataLayout dataLayout,
+    unsigned int inputHeight,
+    unsigned int inputWidth,
+    unsigned int outputHeight,
+    unsigned int outputWidth,
+    bool alignCorners,
+    bool halfPixelCenters);
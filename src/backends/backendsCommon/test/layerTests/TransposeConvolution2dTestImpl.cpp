@@ -1,5 +1,5 @@
 //
-// Copyright © 2019 Arm Ltd and Contributors. All rights reserved.
+// Copyright © 2019, 2024 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 
@@ -22,6 +22,7 @@
 
 #include <doctest/doctest.h>
 
+#include <algorithm>
 #include <string>
 #include <utility>
 #include <vector>
@@ -568,6 +569,126 @@ LayerTestResult<T, 4> MultiChannelTransposeConvolution2dTest(
                                                              biasesData);
 }
 
+LayerTestResult<float, 4> BatchedStridedPaddedTransposeConvolution2dTest(
+    armnn::IWorkloadFactory& workloadFactory,
+    const armnn::IBackendInternal::IMemoryManagerSharedPtr& memoryManager,
+    const armnn::ITensorHandleFactory& tensorHandleFactory,
+    const armnn::DataLayout layout)
+{
+    using namespace armnn;
+
+    constexpr unsigned int batches        = 2u;
+    constexpr unsigned int inputChannels  = 3u;
+    constexpr unsigned int outputChannels = 2u;
+
+    constexpr unsigned int hInput = 5u;
+    constexpr unsigned int wInput = 4u;
+
+    constexpr unsigned int hWeights = 3u;
+    constexpr unsigned int wWeights = 2u;
+
+    TransposeConvolution2dDescriptor descriptor;
+    descriptor.m_PadTop      = 1;
+    descriptor.m_PadBottom   = 2;
+    descriptor.m_PadLeft     = 1;
+    descriptor.m_PadRight    = 0;
+    descriptor.m_StrideY     = 2;
+    descriptor.m_StrideX     = 3;
+    descriptor.m_BiasEnabled = true;
+    descriptor.m_DataLayout  = layout;
+
+    // The stride along the width is larger than the kernel, so some outputs only get the bias.
+    const unsigned int hOutput =
+        (hInput - 1) * descriptor.m_StrideY + hWeights - descriptor.m_PadTop - descriptor.m_PadBottom;
+    const unsigned int wOutput =
+        (wInput - 1) * descriptor.m_StrideX + wWeights - descriptor.m_PadLeft - descriptor.m_PadRight;
+
+    // OIHW for NCHW; OHWI for NHWC
+    TensorInfo inputInfo({ batches, inputChannels, hInput, wInput }, DataType::Float32);
+    TensorInfo outputInfo({ batches, outputChannels, hOutput, wOutput }, DataType::Float32);
+    TensorInfo weightsInfo({ outputChannels, inputChannels, hWeights, wWeights }, DataType::Float32);
+    TensorInfo biasesInfo({ outputChannels }, DataType::Float32);
+
+    // Positive data, so that every output is well away from zero and compared with the relative tolerance.
+    std::vector<float> inputData(inputInfo.GetNumElements());
+    for (unsigned int i = 0; i < inputData.size(); ++i)
+    {
+        inputData[i] = 0.5f + 0.1f * static_cast<float>(i % 7);
+    }
+    std::vector<float> weightsData(weightsInfo.GetNumElements());
+    for (unsigned int i = 0; i < weightsData.size(); ++i)
+    {
+        weightsData[i] = 0.3f * static_cast<float>(1 + i % 5);
+    }
+    std::vector<float> biasesData = { 1.5f, 0.25f };
+
+    std::vector<float> expectedOutputData(outputInfo.GetNumElements());
+    for (unsigned int b = 0; b < batches; ++b)
+    {
+        for (unsigned int o = 0; o < outputChannels; ++o)
+        {
+            std::fill_n(expectedOutputData.begin() + (b * outputChannels + o) * hOutput * wOutput,
+                        hOutput * wOutput,
+                        biasesData[o]);
+        }
+    }
+    for (unsigned int b = 0; b < batches; ++b)
+    {
+        for (unsigned int i = 0; i < inputChannels; ++i)
+        {
+            for (unsigned int y = 0; y < hInput; ++y)
+            {
+                for (unsigned int x = 0; x < wInput; ++x)
+                {
+                    const float value = inputData[((b * inputChannels + i) * hInput + y) * wInput + x];
+                    for (unsigned int o = 0; o < outputChannels; ++o)
+                    {
+                        for (unsigned int ky = 0; ky < hWeights; ++ky)
+                        {
+                            for (unsigned int kx = 0; kx < wWeights; ++kx)
+                            {
+                                const int yOutput = static_cast<int>(y * descriptor.m_StrideY + ky) -
+                                                    static_cast<int>(descriptor.m_PadTop);
+                                const int xOutput = static_cast<int>(x * descriptor.m_StrideX + kx) -
+                                                    static_cast<int>(descriptor.m_PadLeft);
+                                if (yOutput < 0 || yOutput >= static_cast<int>(hOutput) ||
+                                    xOutput < 0 || xOutput >= static_cast<int>(wOutput))
+                                {
+                                    continue;
+                                }
+                                const unsigned int outputIndex =
+                                    ((b * outputChannels + o) * hOutput + static_cast<unsigned int>(yOutput)) *
+                                    wOutput + static_cast<unsigned int>(xOutput);
+                                expectedOutputData[outputIndex] +=
+                                    value * weightsData[((o * inputChannels + i) * hWeights + ky) * wWeights + kx];
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    // swizzle data if needed
+    if (layout == armnn::DataLayout::NHWC)
+    {
+        SwizzleData(inputInfo, inputData, outputInfo, expectedOutputData, weightsInfo, weightsData);
+    }
+
+    return TransposeConvolution2dTest<DataType::Float32, DataType::Float32>(workloadFactory,
+                                                                            memoryManager,
+                                                                            tensorHandleFactory,
+                                                                            descriptor,
+                                                                            inputInfo,
+                                                                            inputData,
+                                                                            outputInfo,
+                                                                            expectedOutputData,
+                                                                            weightsInfo,
+                                                                            weightsData,
+                                                                            biasesInfo,
+                                                                            biasesData);
+}
+
 LayerTestResult<uint8_t, 4> TransposeConvolution2dPerAxisQuantTest(
     armnn::IWorkloadFactory& workloadFactory,
     const armnn::IBackendInternal::IMemoryManagerSharedPtr& memoryManager,
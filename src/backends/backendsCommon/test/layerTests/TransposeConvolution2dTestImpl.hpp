@@ -1,5 +1,5 @@
 //
-// Copyright © 2017 Arm Ltd. All rights reserved.
+// Copyright © 2017, 2024 Arm Ltd. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 
@@ -48,3 +48,11 @@ LayerTestResult<uint8_t, 4> TransposeConvolution2dPerAxisQuantTest(
     const armnn::IBackendInternal::IMemoryManagerSharedPtr& memoryManager,
     const armnn::ITensorHandleFactory& tensorHandleFactory,
     const armnn::DataLayout layout);
+
+/// Compares a transpose convolution with several batches and channels, strides and padding which differ between
+/// the dimensions, and biases against a naive scatter of each input element through the kernel.
+LayerTestResult<float, 4> BatchedStridedPaddedTransposeConvolution2dTest(
+    armnn::IWorkloadFactory& workloadFactory,
+    const armnn::IBackendInternal::IMemoryManagerSharedPtr& memoryManager,
+    const armnn::ITensorHandleFactory& tensorHandleFactory,
+    const armnn::DataLayout layout);
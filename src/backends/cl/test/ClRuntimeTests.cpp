@@ -1,9 +1,9 @@
 //
-// Copyright © 2017 Arm Ltd. All rights reserved.
+// Copyright © 2017, 2024 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 
-#include <test/RuntimeTests.hpp>
+#include <Runtime.hpp>
 
 #include <LeakChecking.hpp>
 
@@ -48,7 +48,6 @@ TEST_CASE("RuntimeMemoryLeaksGpuAcc")
     CHECK(ARMNN_LEAK_CHECKER_IS_ACTIVE());
     armnn::IRuntime::CreationOptions options;
     armnn::RuntimeImpl runtime(options);
-    armnn::RuntimeLoadedNetworksReserve(&runtime);
 
     std::vector<armnn::BackendId> backends = {armnn::Compute::GpuAcc};
     {
@@ -98,7 +97,6 @@ TEST_CASE("RuntimeMemoryUsage")
     armnn::NetworkId networkIdentifier;
     armnn::IRuntime::CreationOptions options;
     armnn::Runtime runtime(options);
-    armnn::RuntimeLoadedNetworksReserve(&runtime);
 
     // Checks for leaks before we load the network and record them so that we can see the delta after unloading.
     VALGRIND_DO_QUICK_LEAK_CHECK;
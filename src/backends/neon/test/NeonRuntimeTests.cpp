@@ -1,9 +1,9 @@
 //
-// Copyright © 2017 Arm Ltd. All rights reserved.
+// Copyright © 2017, 2024 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 
-#include <test/RuntimeTests.hpp>
+#include <Runtime.hpp>
 
 #include <LeakChecking.hpp>
 
@@ -43,7 +43,6 @@ TEST_CASE("RuntimeMemoryLeaksCpuAcc")
     CHECK(ARMNN_LEAK_CHECKER_IS_ACTIVE());
     armnn::IRuntime::CreationOptions options;
     armnn::RuntimeImpl runtime(options);
-    armnn::RuntimeLoadedNetworksReserve(&runtime);
 
     std::vector<armnn::BackendId> backends = {armnn::Compute::CpuAcc};
     {
@@ -43,6 +43,7 @@ BACKEND_SOURCES := \
         workloads/LstmUtils.cpp \
         workloads/Concatenate.cpp \
         workloads/MirrorPad.cpp \
+        workloads/NpyFileWriter.cpp \
         workloads/Pad.cpp \
         workloads/Pooling2d.cpp \
         workloads/Pooling3d.cpp \
@@ -10,6 +10,9 @@
 
 #include <doctest/doctest.h>
 
+#include <algorithm>
+#include <vector>
+
 TEST_SUITE("RefDetectionPostProcess")
 {
 TEST_CASE("TopKSortTest")
@@ -69,6 +72,64 @@ TEST_CASE("NmsFunction")
     CHECK(result[2] == 5);
 }
 
+TEST_CASE("NmsMatchesPairwiseScan")
+{
+    // Many overlapping boxes with distinct scores, compared against a greedy scan where each kept box suppresses
+    // every lower scoring box it overlaps.
+    const unsigned int numBoxes = 400;
+    std::vector<float> boxCorners(numBoxes * 4);
+    std::vector<float> scores(numBoxes);
+    for (unsigned int i = 0; i < numBoxes; ++i)
+    {
+        const float y = static_cast<float>((i * 37) % 23);
+        const float x = static_cast<float>((i * 53) % 29);
+        const float size = 2.0f + static_cast<float>(i % 5);
+        boxCorners[i * 4]     = y;
+        boxCorners[i * 4 + 1] = x;
+        boxCorners[i * 4 + 2] = y + size;
+        boxCorners[i * 4 + 3] = x + size;
+        scores[i] = static_cast<float>((i * 7919) % numBoxes) / static_cast<float>(numBoxes);
+    }
+
+    for (unsigned int maxDetection : { 5u, 50u, numBoxes })
+    {
+        std::vector<unsigned int> sorted;
+        for (unsigned int i = 0; i < numBoxes; ++i)
+        {
+            if (scores[i] >= 0.2f)
+            {
+                sorted.push_back(i);
+            }
+        }
+        std::sort(sorted.begin(), sorted.end(), [&scores](unsigned int i, unsigned int j)
+        {
+            return scores[i] > scores[j];
+        });
+
+        std::vector<unsigned int> expected;
+        std::vector<bool> suppressed(numBoxes, false);
+        for (unsigned int i = 0; i < sorted.size() && expected.size() < maxDetection; ++i)
+        {
+            if (suppressed[sorted[i]])
+            {
+                continue;
+            }
+            expected.push_back(sorted[i]);
+            for (unsigned int j = i + 1; j < sorted.size(); ++j)
+            {
+                if (armnn::IntersectionOverUnion(&boxCorners[sorted[i] * 4], &boxCorners[sorted[j] * 4]) > 0.3f)
+                {
+                    suppressed[sorted[j]] = true;
+                }
+            }
+        }
+
+        std::vector<unsigned int> result =
+            armnn::NonMaxSuppression(numBoxes, boxCorners, scores, 0.2f, maxDetection, 0.3f);
+        CHECK(result == expected);
+    }
+}
+
 void DetectionPostProcessTestImpl(bool useRegularNms,
                                   const std::vector<float>& expectedDetectionBoxes,
                                   const std::vector<float>& expectedDetectionClasses,
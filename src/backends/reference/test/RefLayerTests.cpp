@@ -1,5 +1,5 @@
 //
-// Copyright © 2017,2022-2023 Arm Ltd and Contributors. All rights reserved.
+// Copyright © 2017,2022-2024 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 
@@ -510,6 +510,49 @@ ARMNN_AUTO_TEST_CASE_WITH_THF(LargeTensorsAveragePooling2d, LargeTensorsAverageP
 ARMNN_AUTO_TEST_CASE_WITH_THF(LargeTensorsAveragePooling2dUint8, LargeTensorsAveragePooling2dUint8Test)
 ARMNN_AUTO_TEST_CASE_WITH_THF(LargeTensorsAveragePooling2dInt16, LargeTensorsAveragePooling2dInt16Test)
 
+ARMNN_AUTO_TEST_CASE_WITH_THF(OverlappingMaxPooling2dNhwcMatchesNchw,
+                              OverlappingPooling2dNhwcMatchesNchwTest, PoolingAlgorithm::Max)
+ARMNN_AUTO_TEST_CASE_WITH_THF(OverlappingAveragePooling2dNhwcMatchesNchw,
+                              OverlappingPooling2dNhwcMatchesNchwTest, PoolingAlgorithm::Average)
+ARMNN_AUTO_TEST_CASE_WITH_THF(OverlappingL2Pooling2dNhwcMatchesNchw,
+                              OverlappingPooling2dNhwcMatchesNchwTest, PoolingAlgorithm::L2)
+ARMNN_AUTO_TEST_CASE_WITH_THF(PaddedIgnorePaddingMaxPooling2dNhwcMatchesNchw,
+                              PaddedPooling2dNhwcMatchesNchwTest,
+                              PoolingAlgorithm::Max, PaddingMethod::IgnoreValue)
+ARMNN_AUTO_TEST_CASE_WITH_THF(PaddedExcludePaddingMaxPooling2dNhwcMatchesNchw,
+                              PaddedPooling2dNhwcMatchesNchwTest,
+                              PoolingAlgorithm::Max, PaddingMethod::Exclude)
+ARMNN_AUTO_TEST_CASE_WITH_THF(PaddedIgnorePaddingAveragePooling2dNhwcMatchesNchw,
+                              PaddedPooling2dNhwcMatchesNchwTest,
+                              PoolingAlgorithm::Average, PaddingMethod::IgnoreValue)
+ARMNN_AUTO_TEST_CASE_WITH_THF(PaddedExcludePaddingAveragePooling2dNhwcMatchesNchw,
+                              PaddedPooling2dNhwcMatchesNchwTest,
+                              PoolingAlgorithm::Average, PaddingMethod::Exclude)
+ARMNN_AUTO_TEST_CASE_WITH_THF(PaddedIgnorePaddingL2Pooling2dNhwcMatchesNchw,
+                              PaddedPooling2dNhwcMatchesNchwTest,
+                              PoolingAlgorithm::L2, PaddingMethod::IgnoreValue)
+ARMNN_AUTO_TEST_CASE_WITH_THF(PaddedExcludePaddingL2Pooling2dNhwcMatchesNchw,
+                              PaddedPooling2dNhwcMatchesNchwTest,
+                              PoolingAlgorithm::L2, PaddingMethod::Exclude)
+ARMNN_AUTO_TEST_CASE_WITH_THF(PaddingOnlyWindowsIgnorePaddingMaxPooling2dNhwcMatchesNchw,
+                              PaddingOnlyWindowsPooling2dNhwcMatchesNchwTest,
+                              PoolingAlgorithm::Max, PaddingMethod::IgnoreValue)
+ARMNN_AUTO_TEST_CASE_WITH_THF(PaddingOnlyWindowsExcludePaddingMaxPooling2dNhwcMatchesNchw,
+                              PaddingOnlyWindowsPooling2dNhwcMatchesNchwTest,
+                              PoolingAlgorithm::Max, PaddingMethod::Exclude)
+ARMNN_AUTO_TEST_CASE_WITH_THF(PaddingOnlyWindowsIgnorePaddingAveragePooling2dNhwcMatchesNchw,
+                              PaddingOnlyWindowsPooling2dNhwcMatchesNchwTest,
+                              PoolingAlgorithm::Average, PaddingMethod::IgnoreValue)
+ARMNN_AUTO_TEST_CASE_WITH_THF(PaddingOnlyWindowsExcludePaddingAveragePooling2dNhwcMatchesNchw,
+                              PaddingOnlyWindowsPooling2dNhwcMatchesNchwTest,
+                              PoolingAlgorithm::Average, PaddingMethod::Exclude)
+ARMNN_AUTO_TEST_CASE_WITH_THF(PaddingOnlyWindowsIgnorePaddingL2Pooling2dNhwcMatchesNchw,
+                              PaddingOnlyWindowsPooling2dNhwcMatchesNchwTest,
+                              PoolingAlgorithm::L2, PaddingMethod::IgnoreValue)
+ARMNN_AUTO_TEST_CASE_WITH_THF(PaddingOnlyWindowsExcludePaddingL2Pooling2dNhwcMatchesNchw,
+                              PaddingOnlyWindowsPooling2dNhwcMatchesNchwTest,
+                              PoolingAlgorithm::L2, PaddingMethod::Exclude)
+
 //L2Pooling
 ARMNN_AUTO_TEST_CASE_WITH_THF(IgnorePaddingSimpleL2Pooling2d, IgnorePaddingSimpleL2Pooling2dTest)
 ARMNN_AUTO_TEST_CASE_WITH_THF(IgnorePaddingSimpleL2Pooling2dUint8, IgnorePaddingSimpleL2Pooling2dUint8Test)
@@ -1387,6 +1430,31 @@ ARMNN_AUTO_TEST_CASE_WITH_THF(AlignCornersResizeBilinearUint16Nhwc,
                               AlignCornersResizeBilinearTest<DataType::QSymmS16>,
                               DataLayout::NCHW)
 
+ARMNN_AUTO_TEST_CASE_WITH_THF(ResizeBilinearUpsampleUint8MatchesFloatNchw,
+                              ResizeBilinearQAsymmU8MatchesFloatTest,
+                              DataLayout::NCHW, 4u, 5u, 8u, 10u, false, false)
+ARMNN_AUTO_TEST_CASE_WITH_THF(ResizeBilinearDownsampleUint8MatchesFloatNchw,
+                              ResizeBilinearQAsymmU8MatchesFloatTest,
+                              DataLayout::NCHW, 9u, 7u, 4u, 3u, false, false)
+ARMNN_AUTO_TEST_CASE_WITH_THF(ResizeBilinearAlignCornersUint8MatchesFloatNchw,
+                              ResizeBilinearQAsymmU8MatchesFloatTest,
+                              DataLayout::NCHW, 3u, 5u, 7u, 6u, true, false)
+ARMNN_AUTO_TEST_CASE_WITH_THF(ResizeBilinearHalfPixelCentersUint8MatchesFloatNchw,
+                              ResizeBilinearQAsymmU8MatchesFloatTest,
+                              DataLayout::NCHW, 3u, 5u, 7u, 6u, false, true)
+ARMNN_AUTO_TEST_CASE_WITH_THF(ResizeBilinearUpsampleUint8MatchesFloatNhwc,
+                              ResizeBilinearQAsymmU8MatchesFloatTest,
+                              DataLayout::NHWC, 4u, 5u, 8u, 10u, false, false)
+ARMNN_AUTO_TEST_CASE_WITH_THF(ResizeBilinearDownsampleUint8MatchesFloatNhwc,
+                              ResizeBilinearQAsymmU8MatchesFloatTest,
+                              DataLayout::NHWC, 9u, 7u, 4u, 3u, false, false)
+ARMNN_AUTO_TEST_CASE_WITH_THF(ResizeBilinearAlignCornersUint8MatchesFloatNhwc,
+                              ResizeBilinearQAsymmU8MatchesFloatTest,
+                              DataLayout::NHWC, 3u, 5u, 7u, 6u, true, false)
+ARMNN_AUTO_TEST_CASE_WITH_THF(ResizeBilinearHalfPixelCentersUint8MatchesFloatNhwc,
+                              ResizeBilinearQAsymmU8MatchesFloatTest,
+                              DataLayout::NHWC, 3u, 5u, 7u, 6u, false, true)
+
 // Resize NearestNeighbor - NCHW
 ARMNN_AUTO_TEST_CASE_WITH_THF(SimpleResizeNearestNeighbor,
                               SimpleResizeNearestNeighborTest<DataType::Float32>,
@@ -2691,6 +2759,13 @@ ARMNN_AUTO_TEST_CASE_WITH_THF(MultiChannelTransposeConvolution2dInt16Nhwc,
                               MultiChannelTransposeConvolution2dTest<DataType::QSymmS16, DataType::Signed32>,
                               DataLayout::NCHW)
 
+ARMNN_AUTO_TEST_CASE_WITH_THF(BatchedStridedPaddedTransposeConvolution2dFloatNchw,
+                              BatchedStridedPaddedTransposeConvolution2dTest,
+                              DataLayout::NCHW)
+ARMNN_AUTO_TEST_CASE_WITH_THF(BatchedStridedPaddedTransposeConvolution2dFloatNhwc,
+                              BatchedStridedPaddedTransposeConvolution2dTest,
+                              DataLayout::NHWC)
+
 ARMNN_AUTO_TEST_CASE_WITH_THF(TransposeConvolution2dPerAxisQuantTestNchw,
                               TransposeConvolution2dPerAxisQuantTest,
                               DataLayout::NCHW);
@@ -2784,6 +2859,24 @@ ARMNN_AUTO_TEST_CASE_WITH_THF(ReduceSumSingleAxisFloat32_1, ReduceSumSingleAxisT
 ARMNN_AUTO_TEST_CASE_WITH_THF(ReduceSumSingleAxisFloat32_2, ReduceSumSingleAxisTest2<DataType::Float32>)
 ARMNN_AUTO_TEST_CASE_WITH_THF(ReduceSumSingleAxisFloat32_3, ReduceSumSingleAxisTest3<DataType::Float32>)
 ARMNN_AUTO_TEST_CASE_WITH_THF(ReduceSumMultipleAxisFloat32, ReduceSumMultipleAxisTest<DataType::Float32>)
+ARMNN_AUTO_TEST_CASE_WITH_THF(ReduceSumAxes12MatchesNaive, ReduceSumMatchesNaiveTest,
+                              TensorShape({ 2, 3, 4, 5 }), std::vector<int32_t>({ 1, 2 }))
+ARMNN_AUTO_TEST_CASE_WITH_THF(ReduceSumAxes01MatchesNaive, ReduceSumMatchesNaiveTest,
+                              TensorShape({ 2, 3, 4, 5 }), std::vector<int32_t>({ 0, 1 }))
+ARMNN_AUTO_TEST_CASE_WITH_THF(ReduceSumAxes23MatchesNaive, ReduceSumMatchesNaiveTest,
+                              TensorShape({ 2, 3, 4, 5 }), std::vector<int32_t>({ 2, 3 }))
+ARMNN_AUTO_TEST_CASE_WITH_THF(ReduceSumAxes02MatchesNaive, ReduceSumMatchesNaiveTest,
+                              TensorShape({ 2, 3, 4, 5 }), std::vector<int32_t>({ 0, 2 }))
+ARMNN_AUTO_TEST_CASE_WITH_THF(ReduceSumAxes13MatchesNaive, ReduceSumMatchesNaiveTest,
+                              TensorShape({ 2, 3, 4, 5 }), std::vector<int32_t>({ 1, 3 }))
+ARMNN_AUTO_TEST_CASE_WITH_THF(ReduceSumAllAxesMatchesNaive, ReduceSumMatchesNaiveTest,
+                              TensorShape({ 2, 3, 4, 5 }), std::vector<int32_t>({ 0, 1, 2, 3 }))
+ARMNN_AUTO_TEST_CASE_WITH_THF(ReduceSumLargeBatchedMatchesNaive, ReduceSumMatchesNaiveTest,
+                              TensorShape({ 16, 64, 64, 8 }), std::vector<int32_t>({ 1, 2 }))
+ARMNN_AUTO_TEST_CASE_WITH_THF(ReduceSumLargeSingleBatchMatchesNaive, ReduceSumMatchesNaiveTest,
+                              TensorShape({ 1, 128, 128, 16 }), std::vector<int32_t>({ 1, 2 }))
+ARMNN_AUTO_TEST_CASE_WITH_THF(ReduceSumLargeInnermostAxisMatchesNaive, ReduceSumMatchesNaiveTest,
+                              TensorShape({ 64, 8, 32, 32 }), std::vector<int32_t>({ 3 }))
 
 // ReduceProd
 ARMNN_AUTO_TEST_CASE_WITH_THF(ReduceProdFloat32, ReduceProdSimpleTest<DataType::Float32>)
@@ -1,5 +1,5 @@
 //
-// Copyright © 2017-2023 Arm Ltd and Contributors. All rights reserved.
+// Copyright © 2017-2024 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 
@@ -12,7 +12,11 @@
 #include <armnn/Tensor.hpp>
 #include <armnn/Types.hpp>
 #include <GraphUtils.hpp>
+#include <armnnUtils/Filesystem.hpp>
 #include <reference/RefWorkloadFactory.hpp>
+#include <reference/workloads/NpyFileWriter.hpp>
+#include <fstream>
+#include <iterator>
 #include <memory>
 #include <vector>
 
@@ -207,4 +211,77 @@ TEST_CASE("DebugTestOnCpuRef")
     CHECK(GraphHasNamedLayer(graph, "OutputLayer"));
 }
 
+#if !defined(ARMNN_DISABLE_FILESYSTEM)
+TEST_CASE("DebugToNpyFileOnCpuRef")
+{
+    armnn::INetworkPtr net(armnn::INetwork::Create());
+
+    armnn::ActivationDescriptor activationDescriptor;
+    activationDescriptor.m_Function = armnn::ActivationFunction::BoundedReLu;
+    activationDescriptor.m_A = 1.f;
+    activationDescriptor.m_B = -1.f;
+
+    auto input = net->AddInputLayer(0, "InputLayer");
+    auto activation = net->AddActivationLayer(activationDescriptor, "NpyActivationLayer");
+    auto output = net->AddOutputLayer(0, "OutputLayer");
+
+    input->GetOutputSlot(0).Connect(activation->GetInputSlot(0));
+    activation->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+
+    armnn::TensorInfo info({ 2, 2 }, armnn::DataType::Float32);
+    input->GetOutputSlot(0).SetTensorInfo(info);
+    activation->GetOutputSlot(0).SetTensorInfo(info);
+
+    armnn::IRuntime::CreationOptions options;
+    armnn::IRuntimePtr runtime(armnn::IRuntime::Create(options));
+
+    std::vector<armnn::BackendId> backends = {armnn::Compute::CpuRef};
+
+    armnn::OptimizerOptionsOpaque optimizerOptions;
+    optimizerOptions.SetDebugToFileEnabled(true);
+    optimizerOptions.SetDebugToNpyFileEnabled(true);
+    optimizerOptions.SetDebugToFileLayers({ "NpyActivationLayer" });
+
+    armnn::IOptimizedNetworkPtr optimizedNet = armnn::Optimize(*net, backends, runtime->GetDeviceSpec(),
+                                                               optimizerOptions);
+
+    // Only the selected layer has a debug layer after it.
+    armnn::Graph& graph = GetGraphForTesting(optimizedNet.get());
+    CHECK(graph.GetNumLayers() == 4);
+    CHECK(GraphHasNamedLayer(graph, "DebugLayerAfterNpyActivationLayer_0"));
+    CHECK(!GraphHasNamedLayer(graph, "DebugLayerAfterInputLayer_0"));
+
+    armnn::NetworkId networkId;
+    REQUIRE(runtime->LoadNetwork(networkId, std::move(optimizedNet)) == armnn::Status::Success);
+
+    std::vector<float> inputData({ -2.0f, -0.5f, 0.5f, 2.0f });
+    std::vector<float> outputData(4);
+    armnn::TensorInfo inputInfo = runtime->GetInputTensorInfo(networkId, 0);
+    inputInfo.SetConstant(true);
+    armnn::InputTensors inputTensors { { 0, armnn::ConstTensor(inputInfo, inputData.data()) } };
+    armnn::OutputTensors outputTensors
+        { { 0, armnn::Tensor(runtime->GetOutputTensorInfo(networkId, 0), outputData.data()) } };
+    CHECK(runtime->EnqueueWorkload(networkId, inputTensors, outputTensors) == armnn::Status::Success);
+
+    // The files are all written once the network is unloaded.
+    CHECK(runtime->UnloadNetwork(networkId) == armnn::Status::Success);
+
+    const std::string path = fs::temp_directory_path().generic_string() +
+                             "/ArmNNIntermediateLayerOutputs/NpyActivationLayer_0.npy";
+    std::ifstream file(path, std::ios::binary);
+    REQUIRE(file.good());
+    const std::vector<char> contents((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+    const std::string header = armnn::GetNpyHeader("<f4", info.GetShape());
+    CHECK(header.size() % 64 == 0);
+    CHECK(header.find("'shape': (2, 2)") != std::string::npos);
+    REQUIRE(contents.size() == header.size() + 4 * sizeof(float));
+    CHECK(std::string(contents.begin(), contents.begin() + static_cast<long>(header.size())) == header);
+
+    std::vector<float> values(4);
+    std::memcpy(values.data(), contents.data() + header.size(), 4 * sizeof(float));
+    CHECK(values == std::vector<float>({ -1.0f, -0.5f, 0.5f, 1.0f }));
+}
+#endif
+
 }
@@ -7,8 +7,10 @@
 
 #include <armnn/utility/Assert.hpp>
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
+#include <vector>
 
 namespace armnn
 {
@@ -235,4 +237,205 @@ void Convolve(const TensorShape& rInputShape,
     }
 }
 
+namespace
+{
+
+/// Range of filter positions which read inside the input, rather than in the padding, for one output position.
+struct ValidFilterRange
+{
+    unsigned int m_Begin;
+    unsigned int m_End;
+};
+
+/// Computes the valid filter range of every output position along one dimension.
+std::vector<ValidFilterRange> GetValidFilterRanges(unsigned int outputSize,
+                                                   unsigned int inputSize,
+                                                   unsigned int filterSize,
+                                                   unsigned int padding,
+                                                   unsigned int stride,
+                                                   unsigned int dilation)
+{
+    std::vector<ValidFilterRange> ranges(outputSize);
+    for (unsigned int output = 0; output < outputSize; ++output)
+    {
+        const unsigned int origin = output * stride;
+
+        unsigned int begin = 0;
+        while (begin < filterSize && origin + begin * dilation < padding)
+        {
+            ++begin;
+        }
+        unsigned int end = begin;
+        while (end < filterSize && origin + end * dilation < inputSize + padding)
+        {
+            ++end;
+        }
+        ranges[output] = { begin, end };
+    }
+    return ranges;
+}
+
+} // anonymous namespace
+
+void DepthwiseConvolve(const TensorShape& rInputShape,
+                       Decoder<float>& rInputDecoder,
+                       const TensorShape& rOutputShape,
+                       Encoder<float>& rOutputEncoder,
+                       const TensorShape& rFilterShape,
+                       Decoder<float>& rFilterDecoder,
+                       bool biasEnabled,
+                       Decoder<float>* pBiasDecoder,
+                       DataLayout dataLayout,
+                       unsigned int paddingTop,
+                       unsigned int paddingLeft,
+                       unsigned int xStride,
+                       unsigned int yStride,
+                       unsigned int xDilation,
+                       unsigned int yDilation)
+{
+    if (biasEnabled && !pBiasDecoder)
+    {
+        throw InvalidArgumentException("Bias is enabled but the bias data is invalid");
+    }
+    const armnnUtils::DataLayoutIndexed dataLayoutIndexed(dataLayout);
+
+    const unsigned int channelsIndex = dataLayoutIndexed.GetChannelsIndex();
+    const unsigned int heightIndex   = dataLayoutIndexed.GetHeightIndex();
+    const unsigned int widthIndex    = dataLayoutIndexed.GetWidthIndex();
+
+    // Weights layout: [1,H,W,O]
+    const unsigned int inputChannels   = rInputShape[channelsIndex];
+    const unsigned int outputChannels  = rOutputShape[channelsIndex];
+    const unsigned int depthMultiplier = outputChannels / inputChannels;
+
+    const unsigned int batchSize    = rOutputShape[0];
+    const unsigned int outputHeight = rOutputShape[heightIndex];
+    const unsigned int outputWidth  = rOutputShape[widthIndex];
+    const unsigned int inputHeight  = rInputShape[heightIndex];
+    const unsigned int inputWidth   = rInputShape[widthIndex];
+
+    const unsigned int filterHeight = rFilterShape[1];
+    const unsigned int filterWidth  = rFilterShape[2];
+
+    const std::vector<float> inputVec = rInputDecoder.DecodeTensor(rInputShape);
+    const std::vector<float> filterVec = rFilterDecoder.DecodeTensor(rFilterShape, true);
+
+    const TensorShape biasShape{outputChannels};
+    const std::vector<float> biasVec = biasEnabled ? pBiasDecoder->DecodeTensor(biasShape) : std::vector<float>();
+
+    // The filter positions reading the padding are skipped, rather than checked for every input element.
+    const std::vector<ValidFilterRange> yRanges =
+        GetValidFilterRanges(outputHeight, inputHeight, filterHeight, paddingTop, yStride, yDilation);
+    const std::vector<ValidFilterRange> xRanges =
+        GetValidFilterRanges(outputWidth, inputWidth, filterWidth, paddingLeft, xStride, xDilation);
+
+    if (dataLayout == DataLayout::NHWC)
+    {
+        // Channels are innermost in both the input and the filter, so the sums of all the output channels of
+        // an output element are accumulated together over contiguous memory.
+        std::vector<float> sums(outputChannels);
+        for (unsigned int batchIdx = 0; batchIdx < batchSize; batchIdx++)
+        {
+            for (unsigned int yOutput = 0; yOutput < outputHeight; yOutput++)
+            {
+                const ValidFilterRange& yRange = yRanges[yOutput];
+                for (unsigned int xOutput = 0; xOutput < outputWidth; xOutput++)
+                {
+                    const ValidFilterRange& xRange = xRanges[xOutput];
+                    std::fill(sums.begin(), sums.end(), 0.0f);
+
+                    for (unsigned int yFilter = yRange.m_Begin; yFilter < yRange.m_End; yFilter++)
+                    {
+                        const unsigned int yInput = yOutput * yStride + yFilter * yDilation - paddingTop;
+                        for (unsigned int xFilter = xRange.m_Begin; xFilter < xRange.m_End; xFilter++)
+                        {
+                            const unsigned int xInput = xOutput * xStride + xFilter * xDilation - paddingLeft;
+
+                            const float* input = &inputVec[((batchIdx * inputHeight + yInput) * inputWidth + xInput) *
+                                                           inputChannels];
+                            const float* filter = &filterVec[(yFilter * filterWidth + xFilter) * outputChannels];
+
+                            if (depthMultiplier == 1)
+                            {
+                                for (unsigned int c = 0; c < outputChannels; c++)
+                                {
+                                    sums[c] += filter[c] * input[c];
+                                }
+                            }
+                            else
+                            {
+                                // Output channel cOutput reads input channel cOutput / depthMultiplier.
+                                for (unsigned int cInput = 0; cInput < inputChannels; cInput++)
+                                {
+                                    float* channelSums = &sums[cInput * depthMultiplier];
+                                    const float* channelFilter = &filter[cInput * depthMultiplier];
+                                    for (unsigned int m = 0; m < depthMultiplier; m++)
+                                    {
+                                        channelSums[m] += channelFilter[m] * input[cInput];
+                                    }
+                                }
+                            }
+                        }
+                    }
+
+                    const unsigned int outIdx = ((batchIdx * outputHeight + yOutput) * outputWidth + xOutput) *
+                                                outputChannels;
+                    for (unsigned int cOutput = 0; cOutput < outputChannels; cOutput++)
+                    {
+                        float sum = sums[cOutput];
+                        if (biasEnabled)
+                        {
+                            sum += biasVec[cOutput];
+                        }
+                        rOutputEncoder[outIdx + cOutput];
+                        rOutputEncoder.Set(sum);
+                    }
+                }
+            }
+        }
+    }
+    else
+    {
+        for (unsigned int batchIdx = 0; batchIdx < batchSize; batchIdx++)
+        {
+            for (unsigned int cOutput = 0; cOutput < outputChannels; cOutput++)
+            {
+                const unsigned int cInput = cOutput / depthMultiplier;
+                const float* inputPlane = &inputVec[(batchIdx * inputChannels + cInput) * inputHeight * inputWidth];
+
+                for (unsigned int yOutput = 0; yOutput < outputHeight; yOutput++)
+                {
+                    const ValidFilterRange& yRange = yRanges[yOutput];
+                    for (unsigned int xOutput = 0; xOutput < outputWidth; xOutput++)
+                    {
+                        const ValidFilterRange& xRange = xRanges[xOutput];
+                        float sum = 0.0f;
+
+                        for (unsigned int yFilter = yRange.m_Begin; yFilter < yRange.m_End; yFilter++)
+                        {
+                            const unsigned int yInput = yOutput * yStride + yFilter * yDilation - paddingTop;
+                            const float* inputRow = &inputPlane[yInput * inputWidth];
+                            for (unsigned int xFilter = xRange.m_Begin; xFilter < xRange.m_End; xFilter++)
+                            {
+                                const unsigned int xInput = xOutput * xStride + xFilter * xDilation - paddingLeft;
+                                sum += filterVec[(yFilter * filterWidth + xFilter) * outputChannels + cOutput] *
+                                       inputRow[xInput];
+                            }
+                        }
+
+                        if (biasEnabled)
+                        {
+                            sum += biasVec[cOutput];
+                        }
+
+                        rOutputEncoder[((batchIdx * outputChannels + cOutput) * outputHeight + yOutput) * outputWidth +
+                                       xOutput];
+                        rOutputEncoder.Set(sum);
+                    }
+                }
+            }
+        }
+    }
+}
+
 } // namespace armnn
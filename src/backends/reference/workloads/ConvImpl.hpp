@@ -61,4 +61,22 @@ void Convolve(const TensorShape& rInputShape,
               unsigned int xDilation,
               unsigned int yDilation,
               bool depthwise = false);
+
+/// Depthwise convolution, with weights of shape [1,H,W,O]. Filter positions in the padding are skipped using
+/// ranges computed once per output row and column, and NHWC tensors are processed with the channels innermost.
+void DepthwiseConvolve(const TensorShape& rInputShape,
+                       Decoder<float>& rInputDecoder,
+                       const TensorShape& rOutputShape,
+                       Encoder<float>& rOutputEncoder,
+                       const TensorShape& rFilterShape,
+                       Decoder<float>& rFilterDecoder,
+                       bool biasEnabled,
+                       Decoder<float>* pBiasDecoder,
+                       DataLayout dataLayout,
+                       unsigned int paddingTop,
+                       unsigned int paddingLeft,
+                       unsigned int xStride,
+                       unsigned int yStride,
+                       unsigned int xDilation,
+                       unsigned int yDilation);
 } //namespace armnn
@@ -1,10 +1,12 @@
 //
-// Copyright © 2017-2023 Arm Ltd and Contributors. All rights reserved.
+// Copyright © 2017-2024 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 
 #include "Debug.hpp"
+#include "NpyFileWriter.hpp"
 #include <common/include/ProfilingGuid.hpp>
+#include <armnn/utility/IgnoreUnused.hpp>
 #include <armnnUtils/Filesystem.hpp>
 
 #include <BFloat16.hpp>
@@ -93,21 +95,67 @@ void PrintOutput(const TensorInfo& inputInfo,
     os << " }" << std::endl;
 }
 
+#if !defined(ARMNN_DISABLE_FILESYSTEM)
+namespace
+{
+
+/// The NumPy type of the elements of a tensor, as stored in .npy files.
+template<typename T>
+const char* GetNpyDataType();
+
+template<> const char* GetNpyDataType<float>()   { return "<f4"; }
+template<> const char* GetNpyDataType<Half>()    { return "<f2"; }
+template<> const char* GetNpyDataType<uint8_t>() { return "|u1"; }
+template<> const char* GetNpyDataType<int8_t>()  { return "|i1"; }
+template<> const char* GetNpyDataType<int16_t>() { return "<i2"; }
+template<> const char* GetNpyDataType<int32_t>() { return "<i4"; }
+template<> const char* GetNpyDataType<int64_t>() { return "<i8"; }
+
+template<typename T>
+void WriteNpyFile(const std::string& path, const TensorInfo& inputInfo, const T* inputData)
+{
+    NpyFileWriter::GetInstance().Write(path, GetNpyDataType<T>(), inputInfo.GetShape(),
+                                       inputData, inputInfo.GetNumElements() * sizeof(T));
+}
+
+// NumPy has no BFloat16 type, so those tensors are written as float.
+template<>
+void WriteNpyFile<BFloat16>(const std::string& path, const TensorInfo& inputInfo, const BFloat16* inputData)
+{
+    std::vector<float> values(inputData, inputData + inputInfo.GetNumElements());
+    WriteNpyFile<float>(path, inputInfo, values.data());
+}
+
+} // anonymous namespace
+#endif
+
 template<typename T>
 void Debug(const TensorInfo& inputInfo,
            const T* inputData,
            LayerGuid guid,
            const std::string& layerName,
            unsigned int slotIndex,
-           bool outputsToFile)
+           bool outputsToFile,
+           bool outputsToNpyFile)
 {
     if (outputsToFile)
     {
 #if !defined(ARMNN_DISABLE_FILESYSTEM)
         fs::path tmpDir = fs::temp_directory_path();
-        std::ofstream out(tmpDir.generic_string() + "/ArmNNIntermediateLayerOutputs/" + layerName + ".numpy");
-        PrintOutput<T>(inputInfo, inputData, guid, layerName, slotIndex, out);
-        out.close();
+        const std::string outputDir = tmpDir.generic_string() + "/ArmNNIntermediateLayerOutputs/";
+        if (outputsToNpyFile)
+        {
+            // Written from a background thread, so inference isn't held up by the file system
+            WriteNpyFile<T>(outputDir + layerName + "_" + std::to_string(slotIndex) + ".npy", inputInfo, inputData);
+        }
+        else
+        {
+            std::ofstream out(outputDir + layerName + ".numpy");
+            PrintOutput<T>(inputInfo, inputData, guid, layerName, slotIndex, out);
+            out.close();
+        }
+#else
+        IgnoreUnused(outputsToNpyFile);
 #endif
     }
     else
@@ -121,55 +169,63 @@ template void Debug<BFloat16>(const TensorInfo& inputInfo,
                               LayerGuid guid,
                               const std::string& layerName,
                               unsigned int slotIndex,
-                              bool outputsToFile);
+                              bool outputsToFile,
+                              bool outputsToNpyFile);
 
 template void Debug<Half>(const TensorInfo& inputInfo,
                           const Half* inputData,
                           LayerGuid guid,
                           const std::string& layerName,
                           unsigned int slotIndex,
-                          bool outputsToFile);
+                          bool outputsToFile,
+                          bool outputsToNpyFile);
 
 template void Debug<float>(const TensorInfo& inputInfo,
                            const float* inputData,
                            LayerGuid guid,
                            const std::string& layerName,
                            unsigned int slotIndex,
-                           bool outputsToFile);
+                           bool outputsToFile,
+                           bool outputsToNpyFile);
 
 template void Debug<uint8_t>(const TensorInfo& inputInfo,
                              const uint8_t* inputData,
                              LayerGuid guid,
                              const std::string& layerName,
                              unsigned int slotIndex,
-                             bool outputsToFile);
+                             bool outputsToFile,
+                             bool outputsToNpyFile);
 
 template void Debug<int8_t>(const TensorInfo& inputInfo,
                             const int8_t* inputData,
                             LayerGuid guid,
                             const std::string& layerName,
                             unsigned int slotIndex,
-                            bool outputsToFile);
+                            bool outputsToFile,
+                            bool outputsToNpyFile);
 
 template void Debug<int16_t>(const TensorInfo& inputInfo,
                              const int16_t* inputData,
                              LayerGuid guid,
                              const std::string& layerName,
                              unsigned int slotIndex,
-                             bool outputsToFile);
+                             bool outputsToFile,
+                             bool outputsToNpyFile);
 
 template void Debug<int32_t>(const TensorInfo& inputInfo,
                              const int32_t* inputData,
                              LayerGuid guid,
                              const std::string& layerName,
                              unsigned int slotIndex,
-                             bool outputsToFile);
+                             bool outputsToFile,
+                             bool outputsToNpyFile);
 
 template void Debug<int64_t>(const TensorInfo& inputInfo,
                              const int64_t* inputData,
                              LayerGuid guid,
                              const std::string& layerName,
                              unsigned int slotIndex,
-                             bool outputsToFile);
+                             bool outputsToFile,
+                             bool outputsToNpyFile);
 
 } // namespace armnn
@@ -14,6 +14,7 @@ void Debug(const TensorInfo& inputInfo,
            LayerGuid guid,
            const std::string& layerName,
            unsigned int slotIndex,
-           bool outputsToFile);
+           bool outputsToFile,
+           bool outputsToNpyFile);
 
 } //namespace armnn
@@ -1,5 +1,5 @@
 //
-// Copyright © 2017 Arm Ltd. All rights reserved.
+// Copyright © 2017, 2024 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 
@@ -28,15 +28,32 @@ void TopKSort(unsigned int k, unsigned int* indices, const float* values, unsign
                       [&values](unsigned int i, unsigned int j) { return values[i] > values[j]; });
 }
 
-float IntersectionOverUnion(const float* boxI, const float* boxJ)
+namespace
+{
+
+// Box-corner format: ymin, xmin, ymax, xmax.
+constexpr int yMin = 0;
+constexpr int xMin = 1;
+constexpr int yMax = 2;
+constexpr int xMax = 3;
+
+float BoxArea(const float* box)
+{
+    return (box[yMax] - box[yMin]) * (box[xMax] - box[xMin]);
+}
+
+std::vector<float> BoxAreas(unsigned int numBoxes, const std::vector<float>& boxCorners)
+{
+    std::vector<float> areas(numBoxes);
+    for (unsigned int i = 0; i < numBoxes; ++i)
+    {
+        areas[i] = BoxArea(&boxCorners[i * 4]);
+    }
+    return areas;
+}
+
+float IntersectionOverUnion(const float* boxI, const float* boxJ, float areaI, float areaJ)
 {
-    // Box-corner format: ymin, xmin, ymax, xmax.
-    const int yMin = 0;
-    const int xMin = 1;
-    const int yMax = 2;
-    const int xMax = 3;
-    float areaI = (boxI[yMax] - boxI[yMin]) * (boxI[xMax] - boxI[xMin]);
-    float areaJ = (boxJ[yMax] - boxJ[yMin]) * (boxJ[xMax] - boxJ[xMin]);
     float yMinIntersection = std::max(boxI[yMin], boxJ[yMin]);
     float xMinIntersection = std::max(boxI[xMin], boxJ[xMin]);
     float yMaxIntersection = std::min(boxI[yMax], boxJ[yMax]);
@@ -47,8 +64,10 @@ float IntersectionOverUnion(const float* boxI, const float* boxJ)
     return areaIntersection / areaUnion;
 }
 
+/// NMS with the areas of the boxes precomputed, so they can be shared between the classes of regular NMS.
 std::vector<unsigned int> NonMaxSuppression(unsigned int numBoxes,
                                             const std::vector<float>& boxCorners,
+                                            const std::vector<float>& boxAreas,
                                             const std::vector<float>& scores,
                                             float nmsScoreThreshold,
                                             unsigned int maxDetection,
@@ -74,32 +93,82 @@ std::vector<unsigned int> NonMaxSuppression(unsigned int numBoxes,
     // Number of output cannot be more than max detections specified in the option.
     unsigned int numOutput = std::min(maxDetection, numAboveThreshold);
     std::vector<unsigned int> outputIndices;
-    std::vector<bool> visited(numAboveThreshold, false);
+    outputIndices.reserve(numOutput);
 
-    // Prune out the boxes with high intersection over union by keeping the box with higher score.
-    for (unsigned int i = 0; i < numAboveThreshold; ++i)
+    // Prune out the boxes with high intersection over union by keeping the box with higher score. A box is only
+    // ever suppressed by a kept box with a higher score, so each candidate is compared against the boxes kept so
+    // far, which are at most numOutput, rather than every kept box marking all the boxes after it. This also stops
+    // as soon as numOutput boxes have been kept.
+    for (unsigned int i = 0; i < numAboveThreshold && outputIndices.size() < numOutput; ++i)
     {
-        if (outputIndices.size() >= numOutput)
-        {
-            break;
-        }
-        if (!visited[sortedIndices[i]])
+        const unsigned int candidate = indicesAboveThreshold[sortedIndices[i]];
+        const float* candidateBox = &boxCorners[candidate * 4];
+
+        bool suppressed = false;
+        for (unsigned int kept : outputIndices)
         {
-            outputIndices.push_back(indicesAboveThreshold[sortedIndices[i]]);
-            for (unsigned int j = i + 1; j < numAboveThreshold; ++j)
+            if (IntersectionOverUnion(&boxCorners[kept * 4], candidateBox, boxAreas[kept], boxAreas[candidate])
+                > nmsIouThreshold)
             {
-                unsigned int iIndex = indicesAboveThreshold[sortedIndices[i]] * 4;
-                unsigned int jIndex = indicesAboveThreshold[sortedIndices[j]] * 4;
-                if (IntersectionOverUnion(&boxCorners[iIndex], &boxCorners[jIndex]) > nmsIouThreshold)
-                {
-                    visited[sortedIndices[j]] = true;
-                }
+                suppressed = true;
+                break;
             }
         }
+        if (!suppressed)
+        {
+            outputIndices.push_back(candidate);
+        }
     }
     return outputIndices;
 }
 
+/// Runs the NMS of each class for regular NMS, returning the indices of the boxes selected for each class.
+std::vector<std::vector<unsigned int>> RegularNonMaxSuppression(const DetectionPostProcessDescriptor& desc,
+                                                                unsigned int numBoxes,
+                                                                const std::vector<float>& boxCorners,
+                                                                const std::vector<float>& boxAreas,
+                                                                const std::vector<float>& decodedScores)
+{
+    const unsigned int numClassesWithBg = desc.m_NumClasses + 1;
+    std::vector<std::vector<unsigned int>> selectedIndices(desc.m_NumClasses);
+
+    std::vector<float> classScores(numBoxes);
+    for (unsigned int c = 0; c < desc.m_NumClasses; ++c)
+    {
+        // For each boxes, get scores of the boxes for the class c.
+        for (unsigned int i = 0; i < numBoxes; ++i)
+        {
+            classScores[i] = decodedScores[i * numClassesWithBg + c + 1];
+        }
+        selectedIndices[c] = NonMaxSuppression(numBoxes,
+                                               boxCorners,
+                                               boxAreas,
+                                               classScores,
+                                               desc.m_NmsScoreThreshold,
+                                               desc.m_DetectionsPerClass,
+                                               desc.m_NmsIouThreshold);
+    }
+    return selectedIndices;
+}
+
+} // anonymous namespace
+
+float IntersectionOverUnion(const float* boxI, const float* boxJ)
+{
+    return IntersectionOverUnion(boxI, boxJ, BoxArea(boxI), BoxArea(boxJ));
+}
+
+std::vector<unsigned int> NonMaxSuppression(unsigned int numBoxes,
+                                            const std::vector<float>& boxCorners,
+                                            const std::vector<float>& scores,
+                                            float nmsScoreThreshold,
+                                            unsigned int maxDetection,
+                                            float nmsIouThreshold)
+{
+    return NonMaxSuppression(numBoxes, boxCorners, BoxAreas(numBoxes, boxCorners), scores,
+                             nmsScoreThreshold, maxDetection, nmsIouThreshold);
+}
+
 void AllocateOutputData(unsigned int numOutput,
                         unsigned int numSelected,
                         const std::vector<float>& boxCorners,
@@ -234,34 +303,24 @@ void DetectionPostProcess(const TensorInfo& boxEncodingsInfo,
     {
         // Perform Regular NMS.
         // For each class, perform NMS and select max detection numbers of the highest score across all classes.
-        std::vector<float> classScores(numBoxes);
+        const std::vector<float> boxAreas = BoxAreas(numBoxes, boxCorners);
+        const std::vector<std::vector<unsigned int>> selectedIndicesPerClass =
+            RegularNonMaxSuppression(desc, numBoxes, boxCorners, boxAreas, decodedScores);
 
         std::vector<unsigned int> selectedBoxesAfterNms;
         selectedBoxesAfterNms.reserve(numBoxes);
 
         std::vector<float> selectedScoresAfterNms;
-        selectedBoxesAfterNms.reserve(numScores);
+        selectedScoresAfterNms.reserve(numBoxes);
 
         std::vector<unsigned int> selectedClasses;
 
         for (unsigned int c = 0; c < desc.m_NumClasses; ++c)
         {
-            // For each boxes, get scores of the boxes for the class c.
-            for (unsigned int i = 0; i < numBoxes; ++i)
-            {
-                classScores[i] = decodedScores[i * numClassesWithBg + c + 1];
-            }
-            std::vector<unsigned int> selectedIndices = NonMaxSuppression(numBoxes,
-                                                                          boxCorners,
-                                                                          classScores,
-                                                                          desc.m_NmsScoreThreshold,
-                                                                          desc.m_DetectionsPerClass,
-                                                                          desc.m_NmsIouThreshold);
-
-            for (unsigned int i = 0; i < selectedIndices.size(); ++i)
+            for (unsigned int selectedIndex : selectedIndicesPerClass[c])
             {
-                selectedBoxesAfterNms.push_back(selectedIndices[i]);
-                selectedScoresAfterNms.push_back(classScores[selectedIndices[i]]);
+                selectedBoxesAfterNms.push_back(selectedIndex);
+                selectedScoresAfterNms.push_back(decodedScores[selectedIndex * numClassesWithBg + c + 1]);
                 selectedClasses.push_back(c);
             }
         }
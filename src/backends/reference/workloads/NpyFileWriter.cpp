@@ -0,0 +1,140 @@
+//
+// Copyright © 2024 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "NpyFileWriter.hpp"
+
+#include <armnn/Logging.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+namespace armnn
+{
+
+std::string GetNpyHeader(const std::string& dtype, const TensorShape& shape)
+{
+    std::stringstream dict;
+    dict << "{'descr': '" << dtype << "', 'fortran_order': False, 'shape': (";
+    for (unsigned int i = 0; i < shape.GetNumDimensions(); ++i)
+    {
+        dict << shape[i] << (shape.GetNumDimensions() == 1 ? "," : (i + 1 < shape.GetNumDimensions() ? ", " : ""));
+    }
+    dict << "), }";
+
+    // The magic string, version and header length take 10 bytes, and the header is padded with spaces and ended
+    // with a newline so the data starts on a 64 byte boundary.
+    const size_t preambleSize = 10;
+    std::string dictString = dict.str();
+    const size_t unpaddedSize = preambleSize + dictString.size() + 1;
+    dictString.append((64 - unpaddedSize % 64) % 64, ' ');
+    dictString.push_back('\n');
+
+    const uint16_t headerLength = static_cast<uint16_t>(dictString.size());
+    std::string header("\x93NUMPY\x01\x00", 8);
+    header.push_back(static_cast<char>(headerLength & 0xFF));
+    header.push_back(static_cast<char>(headerLength >> 8));
+    return header + dictString;
+}
+
+NpyFileWriter::NpyFileWriter(size_t maxQueuedBytes)
+    : m_MaxQueuedBytes(maxQueuedBytes)
+{
+#if !defined(ARMNN_DISABLE_THREADS)
+    m_Thread = std::thread(&NpyFileWriter::WriterLoop, this);
+#endif
+}
+
+NpyFileWriter::~NpyFileWriter()
+{
+#if !defined(ARMNN_DISABLE_THREADS)
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Stopping = true;
+    }
+    m_QueueChanged.notify_all();
+    m_Thread.join();
+#endif
+}
+
+void NpyFileWriter::Write(const std::string& path, const std::string& dtype, const TensorShape& shape,
+                          const void* data, size_t numBytes)
+{
+    PendingFile file { path, GetNpyHeader(dtype, shape), std::vector<char>(numBytes) };
+    if (numBytes > 0)
+    {
+        std::memcpy(file.m_Data.data(), data, numBytes);
+    }
+
+#if !defined(ARMNN_DISABLE_THREADS)
+    {
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        m_QueueChanged.wait(lock, [&]
+        {
+            return m_QueuedBytes == 0 || m_QueuedBytes + numBytes <= m_MaxQueuedBytes;
+        });
+        m_QueuedBytes += numBytes;
+        m_Queue.push_back(std::move(file));
+    }
+    m_QueueChanged.notify_all();
+#else
+    WriteFile(file);
+#endif
+}
+
+void NpyFileWriter::Flush()
+{
+#if !defined(ARMNN_DISABLE_THREADS)
+    std::unique_lock<std::mutex> lock(m_Mutex);
+    m_QueueChanged.wait(lock, [this] { return m_Queue.empty() && !m_Writing; });
+#endif
+}
+
+NpyFileWriter& NpyFileWriter::GetInstance()
+{
+    static NpyFileWriter instance;
+    return instance;
+}
+
+void NpyFileWriter::WriteFile(const PendingFile& file)
+{
+    std::ofstream out(file.m_Path, std::ios::binary | std::ios::trunc);
+    out.write(file.m_Header.data(), static_cast<std::streamsize>(file.m_Header.size()));
+    out.write(file.m_Data.data(), static_cast<std::streamsize>(file.m_Data.size()));
+    if (!out)
+    {
+        ARMNN_LOG(warning) << "Unable to write intermediate layer output to: " << file.m_Path;
+    }
+}
+
+#if !defined(ARMNN_DISABLE_THREADS)
+void NpyFileWriter::WriterLoop()
+{
+    std::unique_lock<std::mutex> lock(m_Mutex);
+    while (true)
+    {
+        m_QueueChanged.wait(lock, [this] { return !m_Queue.empty() || m_Stopping; });
+        if (m_Queue.empty())
+        {
+            return;
+        }
+
+        PendingFile file = std::move(m_Queue.front());
+        m_Queue.pop_front();
+        m_Writing = true;
+
+        lock.unlock();
+        WriteFile(file);
+        lock.lock();
+
+        m_QueuedBytes -= file.m_Data.size();
+        m_Writing = false;
+        m_QueueChanged.notify_all();
+    }
+}
+#endif
+
+} //namespace armnn
@@ -0,0 +1,78 @@
+//
+// Copyright © 2024 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include <armnn/Tensor.hpp>
+
+#include <cstddef>
+#include <deque>
+#include <string>
+#include <vector>
+#if !defined(ARMNN_DISABLE_THREADS)
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif
+
+namespace armnn
+{
+
+/// Returns the header of a NumPy .npy file (format version 1.0) holding a C-ordered array with the given shape and
+/// element type, e.g. "<f4" for little-endian 32-bit floats.
+std::string GetNpyHeader(const std::string& dtype, const TensorShape& shape);
+
+/// Writes tensors to NumPy .npy files from a background thread, so writing a tensor only costs the caller a copy
+/// of its data. The tensors waiting to be written are bounded by their total size: Write() blocks while that is
+/// exceeded, although a single tensor larger than the bound is always accepted.
+class NpyFileWriter
+{
+public:
+    explicit NpyFileWriter(size_t maxQueuedBytes = DefaultMaxQueuedBytes);
+
+    /// Writes the tensors still queued before returning.
+    ~NpyFileWriter();
+
+    NpyFileWriter(const NpyFileWriter&) = delete;
+    NpyFileWriter& operator=(const NpyFileWriter&) = delete;
+
+    /// Queues a tensor to be written to path, replacing any existing file.
+    void Write(const std::string& path, const std::string& dtype, const TensorShape& shape,
+               const void* data, size_t numBytes);
+
+    /// Blocks until every tensor queued so far has been written.
+    void Flush();
+
+    /// The writer shared by the debug workloads of the process.
+    static NpyFileWriter& GetInstance();
+
+    static constexpr size_t DefaultMaxQueuedBytes = 256 * 1024 * 1024;
+
+private:
+    struct PendingFile
+    {
+        std::string m_Path;
+        std::string m_Header;
+        std::vector<char> m_Data;
+    };
+
+    static void WriteFile(const PendingFile& file);
+
+    const size_t m_MaxQueuedBytes;
+
+#if !defined(ARMNN_DISABLE_THREADS)
+    void WriterLoop();
+
+    std::deque<PendingFile> m_Queue;
+    size_t m_QueuedBytes = 0;
+    /// Whether the writer thread is writing a file it has taken off the queue.
+    bool m_Writing = false;
+    bool m_Stopping = false;
+    std::mutex m_Mutex;
+    std::condition_variable m_QueueChanged;
+    std::thread m_Thread;
+#endif
+};
+
+} //namespace armnn
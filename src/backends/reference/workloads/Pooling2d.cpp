@@ -14,6 +14,7 @@
 #include <limits>
 #include <algorithm>
 #include <functional>
+#include <vector>
 
 namespace
 {
@@ -139,6 +140,164 @@ using namespace armnnUtils;
 
 namespace armnn
 {
+namespace
+{
+
+/// Combines values along the height of the pooling window, which for L2 pooling also squares them.
+float CombineRows(PoolingAlgorithm algorithm, float accu, float value)
+{
+    switch (algorithm)
+    {
+        case PoolingAlgorithm::Max:
+            return std::max(accu, value);
+        case PoolingAlgorithm::L2:
+            return accu + value * value;
+        default:
+            return accu + value;
+    }
+}
+
+/// Combines the values already reduced along the height of the pooling window, along its width.
+float CombineColumns(PoolingAlgorithm algorithm, float accu, float value)
+{
+    return algorithm == PoolingAlgorithm::Max ? std::max(accu, value) : accu + value;
+}
+
+/// Pooling2d for NHWC tensors, processed with the channels innermost. Each pooling window is reduced along its height
+/// first, into one value per input column and channel, then along its width. Input rows are only decoded while
+/// they're covered by a pooling window, rather than decoding the whole tensor up front.
+void Pooling2dNhwc(Decoder<float>& rInputDecoder,
+                   Encoder<float>& rOutputEncoder,
+                   const TensorInfo& inputInfo,
+                   const TensorInfo& outputInfo,
+                   const Pooling2dDescriptor& params)
+{
+    const int batchSize    = armnn::numeric_cast<int>(outputInfo.GetShape()[0]);
+    const int heightOutput = armnn::numeric_cast<int>(outputInfo.GetShape()[1]);
+    const int widthOutput  = armnn::numeric_cast<int>(outputInfo.GetShape()[2]);
+    const int channels     = armnn::numeric_cast<int>(outputInfo.GetShape()[3]);
+    const int heightInput  = armnn::numeric_cast<int>(inputInfo.GetShape()[1]);
+    const int widthInput   = armnn::numeric_cast<int>(inputInfo.GetShape()[2]);
+    const int padLeft      = armnn::numeric_cast<int>(params.m_PadLeft);
+    const int padRight     = armnn::numeric_cast<int>(params.m_PadRight);
+    const int padTop       = armnn::numeric_cast<int>(params.m_PadTop);
+    const int padBottom    = armnn::numeric_cast<int>(params.m_PadBottom);
+    const int strideX      = armnn::numeric_cast<int>(params.m_StrideX);
+    const int strideY      = armnn::numeric_cast<int>(params.m_StrideY);
+    const int poolHeight   = armnn::numeric_cast<int>(params.m_PoolHeight);
+    const int poolWidth    = armnn::numeric_cast<int>(params.m_PoolWidth);
+
+    const PoolingAlgorithm algorithm = params.m_PoolType;
+    const float defaultInitializer = DefaultInitializer(algorithm);
+    Executor execute = GetExecutor(algorithm);
+
+    const unsigned int rowSize = armnn::numeric_cast<unsigned int>(widthInput * channels);
+
+    // The rows covered by a pooling window are consecutive, so the decoded rows are kept in a ring buffer with a slot
+    // for each row of the window. Slots are tagged with the index of the row they hold across all the batches.
+    const unsigned int numRowSlots = armnn::numeric_cast<unsigned int>(std::max(poolHeight, 1));
+    std::vector<std::vector<float>> rowSlots(numRowSlots, std::vector<float>(rowSize));
+    std::vector<int> rowSlotTags(numRowSlots, -1);
+
+    auto getRow = [&](int n, int yInput) -> const std::vector<float>&
+    {
+        const int tag = n * heightInput + yInput;
+        const unsigned int slot = static_cast<unsigned int>(yInput) % numRowSlots;
+        std::vector<float>& row = rowSlots[slot];
+        if (rowSlotTags[slot] != tag)
+        {
+            const unsigned int rowStart = static_cast<unsigned int>(tag) * rowSize;
+            for (unsigned int i = 0; i < rowSize; ++i)
+            {
+                rInputDecoder[rowStart + i];
+                row[i] = rInputDecoder.Get();
+            }
+            rowSlotTags[slot] = tag;
+        }
+        return row;
+    };
+
+    const unsigned int numChannels = armnn::numeric_cast<unsigned int>(channels);
+    std::vector<float> columns(rowSize);
+    std::vector<float> results(numChannels);
+
+    for (int n = 0; n < batchSize; n++)
+    {
+        for (int yOutput = 0; yOutput < heightOutput; yOutput++)
+        {
+            // Calculate values independent of the x axis, clamping the pooling region as Pooling2d() does.
+            int hstart = (yOutput * strideY) - padTop;
+            int hend = std::min(hstart + poolHeight, heightInput + padBottom);
+            const int height = hend - hstart;
+            const bool hclamped = ClampRange(hstart, hend, heightInput);
+            const bool hpaddingOnly = OnPaddingOnly(hstart, hend, heightInput);
+
+            if (!hpaddingOnly)
+            {
+                std::fill(columns.begin(), columns.end(), defaultInitializer);
+                for (int yInput = hstart; yInput < hend; yInput++)
+                {
+                    const std::vector<float>& row = getRow(n, yInput);
+                    for (unsigned int i = 0; i < rowSize; ++i)
+                    {
+                        columns[i] = CombineRows(algorithm, columns[i], row[i]);
+                    }
+                }
+            }
+
+            const unsigned int outputRowStart =
+                armnn::numeric_cast<unsigned int>((n * heightOutput + yOutput) * widthOutput * channels);
+
+            for (int xOutput = 0; xOutput < widthOutput; xOutput++)
+            {
+                int wstart = (xOutput * strideX) - padLeft;
+                int wend = std::min(wstart + poolWidth, widthInput + padRight);
+
+                float poolAreaSize = armnn::numeric_cast<float>(height * (wend - wstart));
+
+                // By convention, a pooling window covering only padding produces zeros, as in Pooling2d().
+                const bool paddingOnly = hpaddingOnly || OnPaddingOnly(wstart, wend, widthInput);
+                if (paddingOnly)
+                {
+                    std::fill(results.begin(), results.end(), 0.0f);
+                }
+                else
+                {
+                    const bool clamped = ClampRange(wstart, wend, widthInput) || hclamped;
+                    if (clamped && params.m_PaddingMethod == PaddingMethod::Exclude)
+                    {
+                        poolAreaSize = armnn::numeric_cast<float>((hend - hstart) * (wend - wstart));
+                    }
+
+                    std::fill(results.begin(), results.end(), defaultInitializer);
+                    for (int xInput = wstart; xInput < wend; xInput++)
+                    {
+                        const float* column = &columns[static_cast<unsigned int>(xInput) * numChannels];
+                        for (unsigned int c = 0; c < numChannels; ++c)
+                        {
+                            results[c] = CombineColumns(algorithm, results[c], column[c]);
+                        }
+                    }
+
+                    for (float& result : results)
+                    {
+                        execute(result, poolAreaSize);
+                    }
+                }
+
+                const unsigned int outputIndex = outputRowStart + static_cast<unsigned int>(xOutput) * numChannels;
+                for (unsigned int c = 0; c < numChannels; ++c)
+                {
+                    rOutputEncoder[outputIndex + c];
+                    rOutputEncoder.Set(results[c]);
+                }
+            }
+        }
+    }
+}
+
+} // anonymous namespace
+
 void Pooling2d(Decoder<float>& rInputDecoder,
                Encoder<float>& rOutputEncoder,
                const TensorInfo& inputInfo,
@@ -178,6 +337,12 @@ void Pooling2d(Decoder<float>& rInputDecoder,
         throw armnn::InvalidArgumentException("Unsupported padding type");
     }
 
+    if (params.m_DataLayout == DataLayout::NHWC)
+    {
+        Pooling2dNhwc(rInputDecoder, rOutputEncoder, inputInfo, outputInfo, params);
+        return;
+    }
+
     const std::vector<float> decodedInputVec = rInputDecoder.DecodeTensor(inputInfo.GetShape());
 
     for (int n = 0; n < batchSize; n++)
@@ -1,5 +1,5 @@
 //
-// Copyright © 2021 Arm Ltd and Contributors. All rights reserved.
+// Copyright © 2021, 2024 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 
@@ -9,6 +9,7 @@
 
 #include <armnn/backends/WorkloadData.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <functional>
 #include <limits>
@@ -16,92 +17,147 @@
 namespace armnn
 {
 
-bool NextIndex(const unsigned int numDims, const armnn::TensorShape& dims, std::vector<unsigned int>& current)
+namespace
 {
-    unsigned int carry = 1;
 
-    for (unsigned int idx = numDims; idx-- > 0; )
+/// A reduction of a tensor viewed as [outer, reduced, inner] into [outer, inner].
+struct ReductionPass
+{
+    unsigned int m_Outer;
+    unsigned int m_Reduced;
+    unsigned int m_Inner;
+};
+
+float GetInitialValue(ReduceOperation reduceOperation)
+{
+    switch(reduceOperation)
     {
-        unsigned int current_val = current[idx] + carry;
-        if (dims[idx] == current_val)
+        case ReduceOperation::Mean:
+        case ReduceOperation::Sum:
+            return 0.0f;
+        case ReduceOperation::Prod:
+            return 1.0f;
+        case ReduceOperation::Max:
+            return -1 * std::numeric_limits<float>::max();
+        case ReduceOperation::Min:
+            return std::numeric_limits<float>::max();
+        default:
+            throw armnn::InvalidArgumentException("Unknown reduce method: " +
+                std::to_string(static_cast<int>(reduceOperation)));
+    }
+}
+
+/// Merges adjacent dimensions which are both reduced or both kept, then returns a pass for each run of reduced
+/// dimensions, starting from the innermost. Passes which would only reduce dimensions of size 1 are skipped.
+std::vector<ReductionPass> GetReductionPasses(const TensorShape& inputShape, const std::vector<unsigned int>& axis)
+{
+    // The size of each run of dimensions, and whether it is reduced.
+    std::vector<std::pair<unsigned int, bool>> runs;
+    for (unsigned int idx = 0; idx < inputShape.GetNumDimensions(); ++idx)
+    {
+        const bool isReduced = std::find(axis.begin(), axis.end(), idx) != axis.end();
+        if (!runs.empty() && runs.back().second == isReduced)
         {
-            current[idx] = 0;
+            runs.back().first *= inputShape[idx];
         }
         else
         {
-            current[idx] = current_val;
-            carry = 0;
-            break;
+            runs.emplace_back(inputShape[idx], isReduced);
+        }
+    }
+
+    std::vector<ReductionPass> passes;
+    for (size_t run = runs.size(); run-- > 0; )
+    {
+        if (!runs[run].second || runs[run].first == 1)
+        {
+            continue;
+        }
+
+        ReductionPass pass { 1, runs[run].first, 1 };
+        for (size_t idx = 0; idx < run; ++idx)
+        {
+            pass.m_Outer *= runs[idx].first;
         }
+        for (size_t idx = run + 1; idx < runs.size(); ++idx)
+        {
+            pass.m_Inner *= runs[idx].first;
+        }
+        passes.push_back(pass);
+
+        // The following passes see the reduced run as a dimension of size 1.
+        runs[run].first = 1;
     }
-    return (carry == 0);
+    return passes;
 }
 
-unsigned int ReducedOutputOffset(const unsigned int numDims,
-                                 const armnn::TensorShape& dims,
-                                 std::vector<unsigned int>& index,
-                                 const unsigned int numAxis,
-                                 const std::vector<unsigned int>& axis)
+/// Runs a reduction pass. The inner loop runs over contiguous memory so it can be vectorized.
+template <typename Combine>
+void RunReductionPass(const float* input,
+                      float* output,
+                      const ReductionPass& pass,
+                      float initialValue,
+                      Combine combine)
 {
-    unsigned int offset = 0;
-    for (unsigned int idx = 0; idx < numDims; ++idx)
+    for (unsigned int outer = 0; outer < pass.m_Outer; ++outer)
     {
-        bool isAxis = false;
-        if (!axis.empty())
+        float* outputRow = output + static_cast<size_t>(outer) * pass.m_Inner;
+        std::fill(outputRow, outputRow + pass.m_Inner, initialValue);
+
+        for (unsigned int reduced = 0; reduced < pass.m_Reduced; ++reduced)
         {
-            for (unsigned int axisIdx = 0; axisIdx < numAxis; ++axisIdx)
+            const float* inputRow = input + (static_cast<size_t>(outer) * pass.m_Reduced + reduced) * pass.m_Inner;
+            for (unsigned int inner = 0; inner < pass.m_Inner; ++inner)
             {
-                if (idx == axis[axisIdx])
-                {
-                    isAxis = true;
-                    break;
-                }
+                outputRow[inner] = combine(outputRow[inner], inputRow[inner]);
             }
         }
-        if (!isAxis)
-        {
-            offset = offset * dims[idx] + index[idx];
-        }
     }
-    return offset;
 }
 
-
-void Reduce(const TensorInfo& inputInfo,
-            const TensorInfo& outputInfo,
-            Decoder<float>& input,
-            Encoder<float>& output,
-            const std::vector<uint32_t> axis,
-            const ReduceOperation reduceOperation)
+void RunReductionPass(const float* input, float* output, const ReductionPass& pass, ReduceOperation reduceOperation)
 {
-    armnn::TensorShape inputDims = inputInfo.GetShape();
-    unsigned int inputNumDims    = inputInfo.GetNumDimensions();
-    unsigned int numOutputs      = outputInfo.GetNumElements();
-
-    // Initialise temp output
-    std::vector<float> tempOut(numOutputs);
+    const float initialValue = GetInitialValue(reduceOperation);
     switch(reduceOperation)
     {
         case ReduceOperation::Mean:
         case ReduceOperation::Sum:
-            std::fill(tempOut.begin(), tempOut.end(), 0.0f);
+            RunReductionPass(input, output, pass, initialValue,
+                             [](float accu, float value) { return accu + value; });
             break;
         case ReduceOperation::Prod:
-            std::fill(tempOut.begin(), tempOut.end(), 1.0f);
+            RunReductionPass(input, output, pass, initialValue,
+                             [](float accu, float value) { return accu * value; });
             break;
         case ReduceOperation::Max:
-            std::fill(tempOut.begin(), tempOut.end(), -1 * std::numeric_limits<float>::max());
+            RunReductionPass(input, output, pass, initialValue,
+                             [](float accu, float value) { return value > accu ? value : accu; });
             break;
         case ReduceOperation::Min:
-            std::fill(tempOut.begin(), tempOut.end(), std::numeric_limits<float>::max());
+            RunReductionPass(input, output, pass, initialValue,
+                             [](float accu, float value) { return value < accu ? value : accu; });
             break;
         default:
             throw armnn::InvalidArgumentException("Unknown reduce method: " +
                 std::to_string(static_cast<int>(reduceOperation)));
     }
+}
 
-    // Initialise temp index
-    std::vector<unsigned int> tempIndex(inputNumDims, 0);
+} // anonymous namespace
+
+void Reduce(const TensorInfo& inputInfo,
+            const TensorInfo& outputInfo,
+            Decoder<float>& input,
+            Encoder<float>& output,
+            const std::vector<uint32_t> axis,
+            const ReduceOperation reduceOperation)
+{
+    armnn::TensorShape inputDims = inputInfo.GetShape();
+    unsigned int inputNumDims    = inputInfo.GetNumDimensions();
+    unsigned int numOutputs      = outputInfo.GetNumElements();
+
+    // Validates the operation before doing any work.
+    GetInitialValue(reduceOperation);
 
     std::vector<unsigned int> resolvedAxis = axis;
     if (resolvedAxis.empty())
@@ -113,39 +169,15 @@ void Reduce(const TensorInfo& inputInfo,
     }
     auto numResolvedAxis = armnn::numeric_cast<unsigned int>(resolvedAxis.size());
 
-    // Iterates through input_data and operates over the reduced axis
-    for (bool hasNext = true; hasNext; hasNext = NextIndex(inputNumDims, inputDims, tempIndex))
+    // Adjacent reduced and kept dimensions are merged, so each pass reduces an [outer, reduced, inner] view of the
+    // tensor with strided loops, rather than walking a multi-dimensional index for every element.
+    std::vector<float> tempOut = input.DecodeTensor(inputDims);
+    std::vector<float> tempIn;
+    for (const ReductionPass& pass : GetReductionPasses(inputDims, resolvedAxis))
     {
-        unsigned int inputOffset = ReducedOutputOffset(inputNumDims, inputDims, tempIndex, 0, {});
-        unsigned int outputOffset = ReducedOutputOffset(inputNumDims, inputDims, tempIndex,
-                                                        numResolvedAxis, resolvedAxis);
-        input[inputOffset];
-        auto inputValue = input.Get();
-        switch(reduceOperation)
-        {
-            case ReduceOperation::Mean:
-            case ReduceOperation::Sum:
-                tempOut[outputOffset] += inputValue;
-                break;
-            case ReduceOperation::Prod:
-                tempOut[outputOffset] *= inputValue;
-                break;
-            case ReduceOperation::Max:
-                if (inputValue > tempOut[outputOffset])
-                {
-                    tempOut[outputOffset] = inputValue;
-                }
-                break;
-            case ReduceOperation::Min:
-                if (inputValue < tempOut[outputOffset])
-                {
-                    tempOut[outputOffset] = inputValue;
-                }
-                break;
-            default:
-                throw armnn::InvalidArgumentException("Unknown reduce method: " +
-                    std::to_string(static_cast<int>(reduceOperation)));
-        }
+        tempIn.swap(tempOut);
+        tempOut.resize(static_cast<size_t>(pass.m_Outer) * pass.m_Inner);
+        RunReductionPass(tempIn.data(), tempOut.data(), pass, reduceOperation);
     }
 
     // Takes average by num of elements added to get MEAN
@@ -175,4 +207,4 @@ void Reduce(const TensorInfo& inputInfo,
     }
 }
 
-} //namespace armnn
\ No newline at end of file
+} //namespace armnn
@@ -1,10 +1,11 @@
 //
-// Copyright © 2018-2023 Arm Ltd and Contributors. All rights reserved.
+// Copyright © 2018-2024 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 
 #include "RefDebugWorkload.hpp"
 #include "Debug.hpp"
+#include "NpyFileWriter.hpp"
 #include "RefWorkloadUtils.hpp"
 
 #include <ResolveType.hpp>
@@ -14,6 +15,15 @@
 namespace armnn
 {
 
+template<armnn::DataType DataType>
+RefDebugWorkload<DataType>::~RefDebugWorkload()
+{
+    if (m_Data.m_LayerOutputToNpyFile)
+    {
+        NpyFileWriter::GetInstance().Flush();
+    }
+}
+
 template<armnn::DataType DataType>
 void RefDebugWorkload<DataType>::Execute() const
 {
@@ -45,7 +55,8 @@ void RefDebugWorkload<DataType>::Execute(std::vector<ITensorHandle*> inputs) con
     }
     else
     {
-        Debug(inputInfo, inputData, m_Data.m_Guid, m_Data.m_LayerName, m_Data.m_SlotIndex, m_Data.m_LayerOutputToFile);
+        Debug(inputInfo, inputData, m_Data.m_Guid, m_Data.m_LayerName, m_Data.m_SlotIndex,
+              m_Data.m_LayerOutputToFile, m_Data.m_LayerOutputToNpyFile);
     }
 
     std::memcpy(outputData, inputData, inputInfo.GetNumElements()*sizeof(T));
@@ -1,5 +1,5 @@
 //
-// Copyright © 2018-2023 Arm Ltd and Contributors. All rights reserved.
+// Copyright © 2018-2024 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 
@@ -20,6 +20,10 @@ public:
     : TypedWorkload<DebugQueueDescriptor, DataType>(descriptor, info)
     , m_Callback(nullptr) {}
 
+    /// Waits for the .npy files queued by the workloads of the process to be written, so that they are all on disk
+    /// once the network is unloaded.
+    ~RefDebugWorkload() override;
+
     virtual const std::string& GetName() const override
     {
         static const std::string name = std::string("RefDebug") + GetDataTypeName(DataType) + "Workload";
@@ -59,12 +59,12 @@ void RefDepthwiseConvolution2dWorkload::Execute(std::vector<ITensorHandle*> inpu
        biasDecoder = MakeDecoder<float>(GetTensorInfo(inputs[2]), inputs[2]->Map());
     }
 
-    Convolve(inputShape, *inputDecoder, outputShape, *outputEncoder,
-             filterShape, *filterDecoder, m_Data.m_Parameters.m_BiasEnabled, biasDecoder.get(),
-             m_Data.m_Parameters.m_DataLayout, m_Data.m_Parameters.m_PadTop, m_Data.m_Parameters.m_PadLeft,
-             m_Data.m_Parameters.m_StrideX, m_Data.m_Parameters.m_StrideY,
-             m_Data.m_Parameters.m_DilationX,
-             m_Data.m_Parameters.m_DilationY, true);
+    DepthwiseConvolve(inputShape, *inputDecoder, outputShape, *outputEncoder,
+                      filterShape, *filterDecoder, m_Data.m_Parameters.m_BiasEnabled, biasDecoder.get(),
+                      m_Data.m_Parameters.m_DataLayout, m_Data.m_Parameters.m_PadTop, m_Data.m_Parameters.m_PadLeft,
+                      m_Data.m_Parameters.m_StrideX, m_Data.m_Parameters.m_StrideY,
+                      m_Data.m_Parameters.m_DilationX,
+                      m_Data.m_Parameters.m_DilationY);
 }
 
 } //namespace armnn
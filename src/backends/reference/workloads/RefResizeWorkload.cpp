@@ -17,6 +17,18 @@
 namespace armnn
 {
 
+RefResizeWorkload::RefResizeWorkload(const ResizeQueueDescriptor& descriptor, const WorkloadInfo& info)
+    : RefBaseWorkload<ResizeQueueDescriptor>(descriptor, info)
+{
+    // The sampling positions only depend on the shapes, which are known at load time
+    m_Tables = ComputeResizeTables(info.m_InputTensorInfos[0],
+                                   info.m_OutputTensorInfos[0],
+                                   m_Data.m_Parameters.m_DataLayout,
+                                   m_Data.m_Parameters.m_Method,
+                                   m_Data.m_Parameters.m_AlignCorners,
+                                   m_Data.m_Parameters.m_HalfPixelCenters);
+}
+
 void RefResizeWorkload::Execute() const
 {
     Execute(m_Data.m_Inputs, m_Data.m_Outputs);
@@ -35,6 +47,17 @@ void RefResizeWorkload::Execute(std::vector<ITensorHandle*> inputs, std::vector<
     const TensorInfo& inputInfo = GetTensorInfo(inputs[0]);
     const TensorInfo& outputInfo = GetTensorInfo(outputs[0]);
 
+    if (CanResizeBilinearQAsymmU8(inputInfo, outputInfo, m_Data.m_Parameters.m_Method))
+    {
+        ResizeBilinearQAsymmU8(static_cast<const uint8_t*>(inputs[0]->Map()),
+                               inputInfo,
+                               static_cast<uint8_t*>(outputs[0]->Map()),
+                               outputInfo,
+                               m_Tables,
+                               m_Data.m_Parameters.m_DataLayout);
+        return;
+    }
+
     std::unique_ptr<Decoder<float>> decoderPtr = MakeDecoder<float>(inputInfo, inputs[0]->Map());
     Decoder<float> &decoder = *decoderPtr;
     std::unique_ptr<Encoder<float>> encoderPtr = MakeEncoder<float>(outputInfo, outputs[0]->Map());
@@ -44,10 +67,9 @@ void RefResizeWorkload::Execute(std::vector<ITensorHandle*> inputs, std::vector<
            inputInfo,
            encoder,
            outputInfo,
+           m_Tables,
            m_Data.m_Parameters.m_DataLayout,
-           m_Data.m_Parameters.m_Method,
-           m_Data.m_Parameters.m_AlignCorners,
-           m_Data.m_Parameters.m_HalfPixelCenters);
+           m_Data.m_Parameters.m_Method);
 }
 
 } //namespace armnn
@@ -6,6 +6,7 @@
 #pragma once
 
 #include "RefBaseWorkload.hpp"
+#include "Resize.hpp"
 #include <armnn/backends/WorkloadData.hpp>
 
 namespace armnn
@@ -14,11 +15,13 @@ namespace armnn
 class RefResizeWorkload : public RefBaseWorkload<ResizeQueueDescriptor>
 {
 public:
-    using RefBaseWorkload<ResizeQueueDescriptor>::RefBaseWorkload;
+    RefResizeWorkload(const ResizeQueueDescriptor& descriptor, const WorkloadInfo& info);
     void Execute() const override;
     void ExecuteAsync(ExecutionData& executionData)  override;
 private:
     void Execute(std::vector<ITensorHandle*> inputs, std::vector<ITensorHandle*> outputs) const;
+
+    ResizeTables m_Tables;
 };
 
 } //namespace armnn
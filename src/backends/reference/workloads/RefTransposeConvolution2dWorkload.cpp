@@ -17,12 +17,13 @@ RefTransposeConvolution2dWorkload::RefTransposeConvolution2dWorkload(
     const TransposeConvolution2dQueueDescriptor& descriptor, const WorkloadInfo& info) :
     RefBaseWorkload<TransposeConvolution2dQueueDescriptor>(descriptor, info)
 {
-    // set up weights decoder
-    m_Weights = std::make_unique<ScopedTensorHandle>(*(descriptor.m_Weight));
-    const TensorInfo& weightsInfo = m_Weights->GetTensorInfo();
+    // The weights are constant, so they are packed once rather than for every inference
+    ScopedTensorHandle weights(*(descriptor.m_Weight));
+    const TensorInfo& weightsInfo = weights.GetTensorInfo();
 
-    m_WeightsDecoder = MakeDecoder<float>(weightsInfo, m_Weights->Map(true));
-    m_WeightsShape   = weightsInfo.GetShape();
+    std::unique_ptr<Decoder<float>> weightsDecoder = MakeDecoder<float>(weightsInfo, weights.Map(true));
+    m_WeightsShape  = weightsInfo.GetShape();
+    m_PackedWeights = PackTransposeConvolution2dWeights(descriptor.m_Parameters, m_WeightsShape, *weightsDecoder);
 
     // set up biases decoder
     if (descriptor.m_Parameters.m_BiasEnabled)
@@ -61,7 +62,7 @@ void RefTransposeConvolution2dWorkload::Execute(std::vector<ITensorHandle*> inpu
                                outputInfo.GetShape(),
                                *outputEncoder,
                                m_WeightsShape,
-                               *m_WeightsDecoder,
+                               m_PackedWeights,
                                m_BiasesDecoder.get());
 }
 
@@ -26,13 +26,12 @@ public:
 
 private:
     void Execute(std::vector<ITensorHandle*> inputs, std::vector<ITensorHandle*> outputs) const;
-    std::unique_ptr<ScopedTensorHandle> m_Weights;
     std::unique_ptr<ScopedTensorHandle> m_Biases;
 
-    std::unique_ptr<Decoder<float>> m_WeightsDecoder;
     std::unique_ptr<Decoder<float>> m_BiasesDecoder;
 
     TensorShape m_WeightsShape;
+    std::vector<float> m_PackedWeights;
 };
 
 } // namespace armnn
\ No newline at end of file
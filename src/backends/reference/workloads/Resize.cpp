@@ -1,12 +1,10 @@
 //
-// Copyright © 2017 Arm Ltd. All rights reserved.
+// Copyright © 2017, 2024 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 
 #include "Resize.hpp"
 
-#include "TensorBufferArrayView.hpp"
-
 #include <armnn/utility/NumericCast.hpp>
 #include <armnn/Utils.hpp>
 
@@ -23,11 +21,6 @@ inline float Lerp(float a, float b, float w)
     return w * b + (1.f - w) * a;
 }
 
-inline double EuclideanDistance(float Xa, float Ya, const unsigned int Xb, const unsigned int Yb)
-{
-    return std::sqrt(pow(Xa - armnn::numeric_cast<float>(Xb), 2) + pow(Ya - armnn::numeric_cast<float>(Yb), 2));
-}
-
 inline float CalculateResizeScale(const unsigned int& InputSize,
                                   const unsigned int& OutputSize,
                                   const bool& AlignCorners)
@@ -40,7 +33,7 @@ inline float CalculateResizeScale(const unsigned int& InputSize,
 inline float PixelScaler(const unsigned int& Pixel,
                          const float& Scale,
                          const bool& HalfPixelCenters,
-                         armnn::ResizeMethod& resizeMethod)
+                         armnn::ResizeMethod resizeMethod)
 {
     // For Half Pixel Centers the Top Left texel is assumed to be at 0.5,0.5
     if (HalfPixelCenters && resizeMethod == armnn::ResizeMethod::Bilinear)
@@ -58,160 +51,293 @@ inline float PixelScaler(const unsigned int& Pixel,
     }
 }
 
-}// anonymous namespace
-
-namespace armnn
+/// Computes where each output position along one dimension samples the input.
+armnn::ResizeAxisTable ComputeResizeAxisTable(unsigned int inputSize,
+                                              unsigned int outputSize,
+                                              armnn::ResizeMethod resizeMethod,
+                                              bool alignCorners,
+                                              bool halfPixelCenters)
 {
-void Resize(Decoder<float>&   in,
-            const TensorInfo& inputInfo,
-            Encoder<float>&   out,
-            const TensorInfo& outputInfo,
-            DataLayoutIndexed dataLayout,
-            ResizeMethod resizeMethod,
-            bool alignCorners,
-            bool halfPixelCenters)
-{
-    // alignCorners and halfPixelCenters cannot both be true
-    ARMNN_ASSERT(!(alignCorners && halfPixelCenters));
-
     // We follow the definition of TensorFlow and AndroidNN: the top-left corner of a texel in the output
     // image is projected into the input image to figure out the interpolants and weights. Note that this
     // will yield different results than if projecting the centre of output texels.
+    const float scale = CalculateResizeScale(inputSize, outputSize, alignCorners);
+
+    armnn::ResizeAxisTable table;
+    table.m_Index0.resize(outputSize);
+    table.m_Index1.resize(outputSize);
+    table.m_Weight.resize(outputSize);
+
+    for (unsigned int i = 0; i < outputSize; ++i)
+    {
+        // Corresponding real-valued coordinate in input image.
+        const float in = PixelScaler(i, scale, halfPixelCenters, resizeMethod);
+
+        // Discrete coordinate of the top-left texel (in the 2x2 texel area used for interpolation).
+        // Nearest Neighbour uses rounding to align to corners.
+        const float fin = (resizeMethod == armnn::ResizeMethod::NearestNeighbor && alignCorners) ? armnn::roundf(in)
+                                                                                               : floorf(in);
+        // Pixel scaling a value with Half Pixel Centers can be negative, if so set to 0
+        const unsigned int i0 = static_cast<unsigned int>(std::max(fin, 0.0f));
+
+        // Half Pixel Centers uses the scaling to compute a weighted parameter for nearby pixels, otherwise the
+        // next texel is below or to the right of i0.
+        const unsigned int i1 = halfPixelCenters
+                                ? std::min(static_cast<unsigned int>(std::ceil(in)), inputSize - 1u)
+                                : std::min(i0 + 1, inputSize - 1u);
+
+        if (resizeMethod == armnn::ResizeMethod::NearestNeighbor)
+        {
+            // The distance to the 2x2 neighbours is separable, so the nearest of them is the nearest along each
+            // dimension, preferring i0 on a tie.
+            const float distance0 = std::abs(fin - armnn::numeric_cast<float>(i0));
+            const float distance1 = std::abs(fin - armnn::numeric_cast<float>(i1));
+            table.m_Index0[i] = distance0 <= distance1 ? i0 : i1;
+        }
+        else
+        {
+            table.m_Index0[i] = i0;
+        }
+        table.m_Index1[i] = i1;
 
-    const unsigned int batchSize = inputInfo.GetShape()[0];
-    const unsigned int channelCount = inputInfo.GetShape()[dataLayout.GetChannelsIndex()];
+        // Interpolation weight (range [0,1]).
+        table.m_Weight[i] = in - fin;
+    }
+    return table;
+}
 
-    const unsigned int inputHeight = inputInfo.GetShape()[dataLayout.GetHeightIndex()];
-    const unsigned int inputWidth = inputInfo.GetShape()[dataLayout.GetWidthIndex()];
-    const unsigned int outputHeight = outputInfo.GetShape()[dataLayout.GetHeightIndex()];
-    const unsigned int outputWidth = outputInfo.GetShape()[dataLayout.GetWidthIndex()];
+/// Strides of the input, in elements, along each dimension.
+struct ResizeStrides
+{
+    size_t m_Batch;
+    size_t m_Channel;
+    size_t m_Row;
+    size_t m_Column;
+};
+
+ResizeStrides GetResizeStrides(const armnn::TensorShape& shape, const armnnUtils::DataLayoutIndexed& dataLayout)
+{
+    const size_t channels = shape[dataLayout.GetChannelsIndex()];
+    const size_t height   = shape[dataLayout.GetHeightIndex()];
+    const size_t width    = shape[dataLayout.GetWidthIndex()];
+    if (dataLayout.GetDataLayout() == armnn::DataLayout::NHWC)
+    {
+        return { height * width * channels, 1, width * channels, channels };
+    }
+    return { channels * height * width, height * width, width, 1 };
+}
 
-    // How much to scale pixel coordinates in the output image, to get the corresponding pixel coordinates
-    // in the input image.
-    const float scaleY = CalculateResizeScale(inputHeight, outputHeight, alignCorners);
-    const float scaleX = CalculateResizeScale(inputWidth, outputWidth, alignCorners);
+/// Visits every output element in memory order, which is channels innermost for NHWC, passing the input offset of
+/// its batch and channel, and its output row and column.
+template <typename Visit>
+void ForEachResizeOutput(const armnn::TensorShape& inputShape,
+                         const armnn::TensorShape& outputShape,
+                         const armnnUtils::DataLayoutIndexed& dataLayout,
+                         Visit visit)
+{
+    const ResizeStrides strides = GetResizeStrides(inputShape, dataLayout);
 
-    const TensorShape& inputShape =  inputInfo.GetShape();
-    const TensorShape& outputShape =  outputInfo.GetShape();
+    const unsigned int batchSize    = outputShape[0];
+    const unsigned int channelCount = outputShape[dataLayout.GetChannelsIndex()];
+    const unsigned int outputHeight = outputShape[dataLayout.GetHeightIndex()];
+    const unsigned int outputWidth  = outputShape[dataLayout.GetWidthIndex()];
 
     for (unsigned int n = 0; n < batchSize; ++n)
     {
-        for (unsigned int c = 0; c < channelCount; ++c)
+        const size_t batchOffset = n * strides.m_Batch;
+        if (dataLayout.GetDataLayout() == armnn::DataLayout::NHWC)
         {
             for (unsigned int y = 0; y < outputHeight; ++y)
             {
-                // Corresponding real-valued height coordinate in input image.
-                float iy = PixelScaler(y, scaleY, halfPixelCenters, resizeMethod);
-
-                // Discrete height coordinate of top-left texel (in the 2x2 texel area used for interpolation).
-                const float fiy = (resizeMethod == ResizeMethod::NearestNeighbor && alignCorners) ? armnn::roundf(iy)
-                                                                                                  : floorf(iy);
-                // Pixel scaling a value with Half Pixel Centers can be negative, if so set to 0
-                const unsigned int y0 = static_cast<unsigned int>(std::max(fiy, 0.0f));
-
-                // Interpolation weight (range [0,1]).
-                const float yw = iy - fiy;
-
                 for (unsigned int x = 0; x < outputWidth; ++x)
                 {
-                    // Real-valued and discrete width coordinates in input image.
-                    float ix = PixelScaler(x, scaleX, halfPixelCenters, resizeMethod);
-
-                    // Nearest Neighbour uses rounding to align to corners
-                    const float fix = resizeMethod == ResizeMethod::NearestNeighbor && alignCorners ? armnn::roundf(ix)
-                                                                                                    : floorf(ix);
-                    // Pixel scaling a value with Half Pixel Centers can be negative, if so set to 0
-                    const unsigned int x0 = static_cast<unsigned int>(std::max(fix, 0.0f));
-
-                    // Interpolation weight (range [0,1]).
-                    const float xw = ix - fix;
-
-                    unsigned int x1;
-                    unsigned int y1;
-                    // Half Pixel Centers uses the scaling to compute a weighted parameter for nearby pixels
-                    if (halfPixelCenters)
+                    for (unsigned int c = 0; c < channelCount; ++c)
                     {
-                        x1 = std::min(static_cast<unsigned int>(std::ceil(ix)), inputWidth - 1u);
-                        y1 = std::min(static_cast<unsigned int>(std::ceil(iy)), inputHeight - 1u);
+                        visit(batchOffset + c, y, x);
                     }
-                    // Discrete width/height coordinates of texels below and to the right of (x0, y0).
-                    else
-                    {
-                        x1 = std::min(x0 + 1, inputWidth - 1u);
-                        y1 = std::min(y0 + 1, inputHeight - 1u);
-                    }
-
-                    float interpolatedValue;
-                    switch (resizeMethod)
+                }
+            }
+        }
+        else
+        {
+            for (unsigned int c = 0; c < channelCount; ++c)
+            {
+                const size_t planeOffset = batchOffset + c * strides.m_Channel;
+                for (unsigned int y = 0; y < outputHeight; ++y)
+                {
+                    for (unsigned int x = 0; x < outputWidth; ++x)
                     {
-                        case ResizeMethod::Bilinear:
-                        {
-                            in[dataLayout.GetIndex(inputShape, n, c, y0, x0)];
-                            float input1 = in.Get();
-                            in[dataLayout.GetIndex(inputShape, n, c, y0, x1)];
-                            float input2 = in.Get();
-                            in[dataLayout.GetIndex(inputShape, n, c, y1, x0)];
-                            float input3 = in.Get();
-                            in[dataLayout.GetIndex(inputShape, n, c, y1, x1)];
-                            float input4 = in.Get();
-
-                            const float ly0 = Lerp(input1, input2, xw); // lerp along row y0.
-                            const float ly1 = Lerp(input3, input4, xw); // lerp along row y1.
-                            interpolatedValue = Lerp(ly0, ly1, yw);
-                            break;
-                        }
-                        case ResizeMethod::NearestNeighbor:
-                        {
-                            // calculate euclidean distance to the 4 neighbours
-                            auto distance00 = EuclideanDistance(fix, fiy, x0, y0);
-                            auto distance01 = EuclideanDistance(fix, fiy, x0, y1);
-                            auto distance10 = EuclideanDistance(fix, fiy, x1, y0);
-                            auto distance11 = EuclideanDistance(fix, fiy, x1, y1);
-
-                            auto minimum = std::min( { distance00, distance01, distance10, distance11 } );
-
-                            unsigned int xNearest = 0;
-                            unsigned int yNearest = 0;
-
-                            if (minimum == distance00)
-                            {
-                               xNearest = x0;
-                               yNearest = y0;
-                            }
-                            else if (minimum == distance01)
-                            {
-                                xNearest = x0;
-                                yNearest = y1;
-                            }
-                            else if (minimum == distance10)
-                            {
-                                xNearest = x1;
-                                yNearest = y0;
-                            }
-                            else if (minimum == distance11)
-                            {
-                                xNearest = x1;
-                                yNearest = y1;
-                            }
-                            else
-                            {
-                                throw InvalidArgumentException("Resize Nearest Neighbor failure");
-                            }
-
-                            in[dataLayout.GetIndex(inputShape, n, c, yNearest, xNearest)];
-                            interpolatedValue = in.Get();
-                            break;
-                        }
-                        default:
-                            throw InvalidArgumentException("Unknown resize method: " +
-                                                            std::to_string(static_cast<int>(resizeMethod)));
+                        visit(planeOffset, y, x);
                     }
-                    out[dataLayout.GetIndex(outputShape, n, c, y, x)];
-                    out.Set(interpolatedValue);
                 }
             }
         }
     }
 }
 
+}// anonymous namespace
+
+namespace armnn
+{
+
+ResizeTables ComputeResizeTables(const TensorInfo& inputInfo,
+                                 const TensorInfo& outputInfo,
+                                 DataLayoutIndexed dataLayout,
+                                 ResizeMethod resizeMethod,
+                                 bool alignCorners,
+                                 bool halfPixelCenters)
+{
+    // alignCorners and halfPixelCenters cannot both be true
+    ARMNN_ASSERT(!(alignCorners && halfPixelCenters));
+
+    if (resizeMethod != ResizeMethod::Bilinear && resizeMethod != ResizeMethod::NearestNeighbor)
+    {
+        throw InvalidArgumentException("Unknown resize method: " + std::to_string(static_cast<int>(resizeMethod)));
+    }
+
+    const TensorShape& inputShape  = inputInfo.GetShape();
+    const TensorShape& outputShape = outputInfo.GetShape();
+
+    ResizeTables tables;
+    tables.m_Rows = ComputeResizeAxisTable(inputShape[dataLayout.GetHeightIndex()],
+                                           outputShape[dataLayout.GetHeightIndex()],
+                                           resizeMethod, alignCorners, halfPixelCenters);
+    tables.m_Columns = ComputeResizeAxisTable(inputShape[dataLayout.GetWidthIndex()],
+                                              outputShape[dataLayout.GetWidthIndex()],
+                                              resizeMethod, alignCorners, halfPixelCenters);
+    return tables;
+}
+
+void Resize(Decoder<float>&     in,
+            const TensorInfo&   inputInfo,
+            Encoder<float>&     out,
+            const TensorInfo&   outputInfo,
+            const ResizeTables& tables,
+            DataLayoutIndexed   dataLayout,
+            ResizeMethod        resizeMethod)
+{
+    const TensorShape& inputShape  = inputInfo.GetShape();
+    const TensorShape& outputShape = outputInfo.GetShape();
+    const ResizeStrides strides = GetResizeStrides(inputShape, dataLayout);
+
+    const std::vector<float> inputVec = in.DecodeTensor(inputShape);
+    const float* input = inputVec.data();
+
+    const ResizeAxisTable& rows    = tables.m_Rows;
+    const ResizeAxisTable& columns = tables.m_Columns;
+
+    out[0];
+    switch (resizeMethod)
+    {
+        case ResizeMethod::Bilinear:
+        {
+            ForEachResizeOutput(inputShape, outputShape, dataLayout,
+                [&](size_t offset, unsigned int y, unsigned int x)
+                {
+                    const float* row0 = input + offset + rows.m_Index0[y] * strides.m_Row;
+                    const float* row1 = input + offset + rows.m_Index1[y] * strides.m_Row;
+                    const size_t x0 = columns.m_Index0[x] * strides.m_Column;
+                    const size_t x1 = columns.m_Index1[x] * strides.m_Column;
+                    const float xw = columns.m_Weight[x];
+
+                    const float ly0 = Lerp(row0[x0], row0[x1], xw); // lerp along row y0.
+                    const float ly1 = Lerp(row1[x0], row1[x1], xw); // lerp along row y1.
+                    out.Set(Lerp(ly0, ly1, rows.m_Weight[y]));
+                    ++out;
+                });
+            break;
+        }
+        case ResizeMethod::NearestNeighbor:
+        {
+            ForEachResizeOutput(inputShape, outputShape, dataLayout,
+                [&](size_t offset, unsigned int y, unsigned int x)
+                {
+                    out.Set(input[offset + rows.m_Index0[y] * strides.m_Row + columns.m_Index0[x] * strides.m_Column]);
+                    ++out;
+                });
+            break;
+        }
+        default:
+            throw InvalidArgumentException("Unknown resize method: " +
+                                            std::to_string(static_cast<int>(resizeMethod)));
+    }
+}
+
+void Resize(Decoder<float>&   in,
+            const TensorInfo& inputInfo,
+            Encoder<float>&   out,
+            const TensorInfo& outputInfo,
+            DataLayoutIndexed dataLayout,
+            ResizeMethod resizeMethod,
+            bool alignCorners,
+            bool halfPixelCenters)
+{
+    const ResizeTables tables =
+        ComputeResizeTables(inputInfo, outputInfo, dataLayout, resizeMethod, alignCorners, halfPixelCenters);
+    Resize(in, inputInfo, out, outputInfo, tables, dataLayout, resizeMethod);
+}
+
+bool CanResizeBilinearQAsymmU8(const TensorInfo& inputInfo, const TensorInfo& outputInfo, ResizeMethod resizeMethod)
+{
+    return resizeMethod == ResizeMethod::Bilinear &&
+           inputInfo.GetDataType() == DataType::QAsymmU8 &&
+           outputInfo.GetDataType() == DataType::QAsymmU8 &&
+           inputInfo.GetQuantizationScale() == outputInfo.GetQuantizationScale() &&
+           inputInfo.GetQuantizationOffset() == outputInfo.GetQuantizationOffset();
+}
+
+void ResizeBilinearQAsymmU8(const uint8_t*      in,
+                            const TensorInfo&   inputInfo,
+                            uint8_t*            out,
+                            const TensorInfo&   outputInfo,
+                            const ResizeTables& tables,
+                            DataLayoutIndexed   dataLayout)
+{
+    // The weights are fixed-point with WeightBits fractional bits. As the input and output share their quantization
+    // parameters, the interpolation is affine in the quantized values, so it is done on the values relative to the
+    // zero point, which are within [-255, 255]. The product of two weights then needs 2 * WeightBits + 9 bits.
+    constexpr int WeightBits = 11;
+    constexpr int32_t WeightOne = 1 << WeightBits;
+    constexpr int32_t Half = 1 << (2 * WeightBits - 1);
+
+    auto toFixedPoint = [](const std::vector<float>& weights)
+    {
+        std::vector<int32_t> fixedPoint(weights.size());
+        for (size_t i = 0; i < weights.size(); ++i)
+        {
+            fixedPoint[i] = static_cast<int32_t>(std::lround(weights[i] * static_cast<float>(WeightOne)));
+        }
+        return fixedPoint;
+    };
+    const std::vector<int32_t> rowWeights    = toFixedPoint(tables.m_Rows.m_Weight);
+    const std::vector<int32_t> columnWeights = toFixedPoint(tables.m_Columns.m_Weight);
+
+    const TensorShape& inputShape = inputInfo.GetShape();
+    const ResizeStrides strides = GetResizeStrides(inputShape, dataLayout);
+    const int32_t offset = inputInfo.GetQuantizationOffset();
+
+    const ResizeAxisTable& rows    = tables.m_Rows;
+    const ResizeAxisTable& columns = tables.m_Columns;
+
+    ForEachResizeOutput(inputShape, outputInfo.GetShape(), dataLayout,
+        [&](size_t planeOffset, unsigned int y, unsigned int x)
+        {
+            const uint8_t* row0 = in + planeOffset + rows.m_Index0[y] * strides.m_Row;
+            const uint8_t* row1 = in + planeOffset + rows.m_Index1[y] * strides.m_Row;
+            const size_t x0 = columns.m_Index0[x] * strides.m_Column;
+            const size_t x1 = columns.m_Index1[x] * strides.m_Column;
+            const int32_t xw = columnWeights[x];
+            const int32_t yw = rowWeights[y];
+
+            const int32_t ly0 = (row0[x0] - offset) * (WeightOne - xw) + (row0[x1] - offset) * xw;
+            const int32_t ly1 = (row1[x0] - offset) * (WeightOne - xw) + (row1[x1] - offset) * xw;
+            const int32_t value = ly0 * (WeightOne - yw) + ly1 * yw;
+
+            // Rounds half away from zero, like Quantize().
+            const int32_t rounded = value >= 0 ? (value + Half) >> (2 * WeightBits)
+                                               : -((Half - value) >> (2 * WeightBits));
+            *out++ = static_cast<uint8_t>(std::min(std::max(rounded + offset, 0), 255));
+        });
+}
+
 } //namespace armnn
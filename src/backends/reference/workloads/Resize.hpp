@@ -1,5 +1,5 @@
 //
-// Copyright © 2017 Arm Ltd. All rights reserved.
+// Copyright © 2017, 2024 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 
@@ -11,9 +11,43 @@
 
 #include <armnnUtils/DataLayoutIndexed.hpp>
 
+#include <vector>
+
 namespace armnn
 {
 
+/// Where each output row or column of a resize samples the input. For bilinear resizes the value is interpolated
+/// between m_Index0 and m_Index1 with m_Weight. For nearest neighbour resizes only m_Index0 is used.
+struct ResizeAxisTable
+{
+    std::vector<unsigned int> m_Index0;
+    std::vector<unsigned int> m_Index1;
+    std::vector<float>        m_Weight;
+};
+
+/// The sampling tables of a resize. They only depend on the tensor shapes and the descriptor, so they can be
+/// computed once and reused for every inference.
+struct ResizeTables
+{
+    ResizeAxisTable m_Rows;
+    ResizeAxisTable m_Columns;
+};
+
+ResizeTables ComputeResizeTables(const TensorInfo&             inputInfo,
+                                 const TensorInfo&             outputInfo,
+                                 armnnUtils::DataLayoutIndexed dataLayout,
+                                 ResizeMethod                  resizeMethod,
+                                 bool                          alignCorners,
+                                 bool                          halfPixelCenters);
+
+void Resize(Decoder<float>&               in,
+            const TensorInfo&             inputInfo,
+            Encoder<float>&               out,
+            const TensorInfo&             outputInfo,
+            const ResizeTables&           tables,
+            armnnUtils::DataLayoutIndexed dataLayout,
+            ResizeMethod                  resizeMethod);
+
 void Resize(Decoder<float>&               in,
             const TensorInfo&             inputInfo,
             Encoder<float>&               out,
@@ -23,4 +57,16 @@ void Resize(Decoder<float>&               in,
             bool                          alignCorners = false,
             bool                          halfPixelCenters = false);
 
+/// Returns whether ResizeBilinearQAsymmU8() can be used: a bilinear resize of QAsymmU8 data where the input and
+/// output share their quantization parameters.
+bool CanResizeBilinearQAsymmU8(const TensorInfo& inputInfo, const TensorInfo& outputInfo, ResizeMethod resizeMethod);
+
+/// A bilinear resize on the quantized values directly, in fixed-point arithmetic.
+void ResizeBilinearQAsymmU8(const uint8_t*                in,
+                            const TensorInfo&             inputInfo,
+                            uint8_t*                      out,
+                            const TensorInfo&             outputInfo,
+                            const ResizeTables&           tables,
+                            armnnUtils::DataLayoutIndexed dataLayout);
+
 } // namespace armnn
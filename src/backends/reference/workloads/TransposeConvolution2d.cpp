@@ -7,18 +7,64 @@
 
 #include <armnnUtils/DataLayoutIndexed.hpp>
 
+#include <algorithm>
+
 namespace armnn
 {
 
 using namespace armnnUtils;
 
+namespace
+{
+
+/// Upper bound on the number of elements in the column buffer, which holds the GEMM results of a block of input
+/// elements before they are scattered into the output.
+constexpr size_t MaxColumnBufferSize = 1 << 20;
+
+} // anonymous namespace
+
+std::vector<float> PackTransposeConvolution2dWeights(const TransposeConvolution2dDescriptor& descriptor,
+                                                     const TensorShape& weightsShape,
+                                                     Decoder<float>& weightsDecoder)
+{
+    const DataLayoutIndexed dataLayoutIndexed(descriptor.m_DataLayout);
+
+    const unsigned int outputDepth   = weightsShape[0];
+    const unsigned int weightsHeight = weightsShape[dataLayoutIndexed.GetHeightIndex()];
+    const unsigned int weightsWidth  = weightsShape[dataLayoutIndexed.GetWidthIndex()];
+    const unsigned int inputDepth    = weightsShape[dataLayoutIndexed.GetChannelsIndex()];
+
+    const std::vector<float> filterVec = weightsDecoder.DecodeTensor(weightsShape);
+
+    // Packed as [inputDepth, weightsHeight, weightsWidth, outputDepth], so each input channel has a row of the
+    // right-hand GEMM operand, with the output channels of every filter position contiguous.
+    std::vector<float> packedWeights(filterVec.size());
+    for (unsigned int dInput = 0u; dInput < inputDepth; ++dInput)
+    {
+        for (unsigned int yWeights = 0u; yWeights < weightsHeight; ++yWeights)
+        {
+            for (unsigned int xWeights = 0u; xWeights < weightsWidth; ++xWeights)
+            {
+                for (unsigned int dOutput = 0u; dOutput < outputDepth; ++dOutput)
+                {
+                    const unsigned int packedIndex =
+                        ((dInput * weightsHeight + yWeights) * weightsWidth + xWeights) * outputDepth + dOutput;
+                    packedWeights[packedIndex] =
+                        filterVec[dataLayoutIndexed.GetIndex(weightsShape, dOutput, dInput, yWeights, xWeights)];
+                }
+            }
+        }
+    }
+    return packedWeights;
+}
+
 void TransposeConvolution2dImpl(const TransposeConvolution2dDescriptor& descriptor,
                                 const TensorShape& inputShape,
                                 Decoder<float>& inputDecoder,
                                 const TensorShape& outputShape,
                                 Encoder<float>& outputEncoder,
                                 const TensorShape& weightsShape,
-                                Decoder<float>& weightsDecoder,
+                                const std::vector<float>& packedWeights,
                                 Decoder<float>* biasesDecoder)
 {
     if (descriptor.m_BiasEnabled && !biasesDecoder)
@@ -29,6 +75,7 @@ void TransposeConvolution2dImpl(const TransposeConvolution2dDescriptor& descript
     const unsigned int channelsIndex = dataLayoutIndexed.GetChannelsIndex();
     const unsigned int heightIndex   = dataLayoutIndexed.GetHeightIndex();
     const unsigned int widthIndex    = dataLayoutIndexed.GetWidthIndex();
+    const bool isNhwc = descriptor.m_DataLayout == armnn::DataLayout::NHWC;
 
     const unsigned int numBatches = inputShape[0];
 
@@ -38,7 +85,6 @@ void TransposeConvolution2dImpl(const TransposeConvolution2dDescriptor& descript
 
     const unsigned int weightsHeight = weightsShape[heightIndex];
     const unsigned int weightsWidth  = weightsShape[widthIndex];
-    const unsigned int weightsDepth  = weightsShape[channelsIndex];
 
     const unsigned int outputHeight = outputShape[heightIndex];
     const unsigned int outputWidth  = outputShape[widthIndex];
@@ -53,75 +99,87 @@ void TransposeConvolution2dImpl(const TransposeConvolution2dDescriptor& descript
     std::vector<float> outputBuffer(outputShape.GetNumElements(), 0);
 
     const std::vector<float> inputVec = inputDecoder.DecodeTensor(inputShape);
-    const std::vector<float> filterVec = weightsDecoder.DecodeTensor(weightsShape);
+
+    // Deconvolution as a GEMM followed by col2im: the GEMM multiplies each input element, a row of inputDepth
+    // values, by the packed weights, giving its contribution to every filter position and output channel. col2im
+    // then adds those contributions to the output elements they land on. Input elements are processed in blocks,
+    // to bound the size of the column buffer.
+    const unsigned int numInputElements = inputHeight * inputWidth;
+    const size_t columnSize = static_cast<size_t>(weightsHeight) * weightsWidth * outputDepth;
+    const unsigned int blockSize = static_cast<unsigned int>(
+        std::max<size_t>(1, std::min<size_t>(numInputElements, MaxColumnBufferSize / std::max<size_t>(columnSize, 1))));
+    std::vector<float> columns(blockSize * columnSize);
 
     for (unsigned int batch = 0u; batch < numBatches; ++batch)
     {
-        for (unsigned int yInput = 0u; yInput < inputHeight; ++yInput)
+        const float* batchInput = &inputVec[static_cast<size_t>(batch) * numInputElements * inputDepth];
+        float* batchOutput = &outputBuffer[static_cast<size_t>(batch) * outputHeight * outputWidth * outputDepth];
+
+        for (unsigned int blockStart = 0u; blockStart < numInputElements; blockStart += blockSize)
         {
-            for (unsigned int xInput = 0u; xInput < inputWidth; ++xInput)
+            const unsigned int blockEnd = std::min(blockStart + blockSize, numInputElements);
+
+            // GEMM: columns[element, :] = input[element, :] * packedWeights
+            for (unsigned int element = blockStart; element < blockEnd; ++element)
+            {
+                float* column = &columns[(element - blockStart) * columnSize];
+                std::fill(column, column + columnSize, 0.0f);
+
+                for (unsigned int dInput = 0u; dInput < inputDepth; ++dInput)
+                {
+                    const float inputValue = isNhwc ? batchInput[element * inputDepth + dInput]
+                                                    : batchInput[dInput * numInputElements + element];
+                    const float* weightsRow = &packedWeights[dInput * columnSize];
+                    for (size_t i = 0; i < columnSize; ++i)
+                    {
+                        column[i] += inputValue * weightsRow[i];
+                    }
+                }
+            }
+
+            // col2im: scatters the contributions of each input element into the output
+            for (unsigned int element = blockStart; element < blockEnd; ++element)
             {
+                const unsigned int yInput = element / inputWidth;
+                const unsigned int xInput = element % inputWidth;
+
                 unsigned int xOutputOrigin = xInput * strideX - paddingLeft;
                 unsigned int yOutputOrigin = yInput * strideY - paddingTop;
 
-                for (unsigned int dOutput = 0u; dOutput < outputDepth; ++dOutput)
+                const float* column = &columns[(element - blockStart) * columnSize];
+                for (unsigned int yWeights = 0u; yWeights < weightsHeight; ++yWeights)
                 {
-                    for (unsigned int yWeights = 0u; yWeights < weightsHeight; ++yWeights)
+                    const unsigned int yOutput = yOutputOrigin + yWeights;
+                    if (yOutput >= outputHeight)
+                    {
+                        continue;
+                    }
+                    for (unsigned int xWeights = 0u; xWeights < weightsWidth; ++xWeights)
                     {
-                        for (unsigned int xWeights = 0u; xWeights < weightsWidth; ++xWeights)
+                        const unsigned int xOutput = xOutputOrigin + xWeights;
+                        if (xOutput >= outputWidth)
                         {
-                            unsigned int yOutput = yOutputOrigin + yWeights;
-                            unsigned int xOutput = xOutputOrigin + xWeights;
+                            continue;
+                        }
 
-                            if (yOutput < outputHeight && xOutput< outputWidth)
+                        const float* contributions = &column[(yWeights * weightsWidth + xWeights) * outputDepth];
+                        if (isNhwc)
+                        {
+                            float* output = &batchOutput[(yOutput * outputWidth + xOutput) * outputDepth];
+                            for (unsigned int dOutput = 0u; dOutput < outputDepth; ++dOutput)
                             {
-                                for (unsigned int dInput = 0u; dInput < inputDepth; dInput++)
-                                {
-                                    unsigned int inputIndex;
-                                    unsigned int outputIndex;
-                                    unsigned int weightsIndex;
-
-                                    if(descriptor.m_DataLayout == armnn::DataLayout::NHWC)
-                                    {
-                                        inputIndex   = batch  * inputHeight * inputWidth * inputDepth +
-                                                       yInput * inputWidth * inputDepth +
-                                                       xInput * inputDepth +
-                                                       dInput;
-
-                                        weightsIndex = dOutput  * weightsHeight * weightsWidth * weightsDepth +
-                                                       yWeights * weightsWidth * weightsDepth +
-                                                       xWeights * weightsDepth +
-                                                       dInput;
-
-                                        outputIndex  = batch   * outputHeight * outputWidth * outputDepth +
-                                                       yOutput * outputWidth * outputDepth +
-                                                       xOutput * outputDepth +
-                                                       dOutput;
-                                    }
-                                    else
-                                    {
-                                        inputIndex   = batch  * inputDepth * inputHeight * inputWidth +
-                                                       dInput * inputHeight * inputWidth +
-                                                       yInput * inputWidth +
-                                                       xInput;
-
-                                        weightsIndex = dOutput  * weightsDepth * weightsHeight * weightsWidth +
-                                                       dInput   * weightsHeight * weightsWidth +
-                                                       yWeights * weightsWidth +
-                                                       xWeights;
-
-                                        outputIndex  = batch   * outputDepth * outputHeight * outputWidth +
-                                                       dOutput * outputHeight * outputWidth +
-                                                       yOutput * outputWidth +
-                                                       xOutput;
-                                    }
-
-                                    outputBuffer[outputIndex] += inputVec[inputIndex] * filterVec[weightsIndex];
-                                }
+                                output[dOutput] += contributions[dOutput];
+                            }
+                        }
+                        else
+                        {
+                            float* output = &batchOutput[yOutput * outputWidth + xOutput];
+                            for (unsigned int dOutput = 0u; dOutput < outputDepth; ++dOutput)
+                            {
+                                output[dOutput * outputHeight * outputWidth] += contributions[dOutput];
                             }
                         }
                     }
-
                 }
             }
         }
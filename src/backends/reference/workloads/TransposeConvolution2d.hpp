@@ -11,16 +11,24 @@
 #include <armnn/Descriptors.hpp>
 #include <armnn/Tensor.hpp>
 
+#include <vector>
+
 namespace armnn
 {
 
+/// Decodes and rearranges the weights for TransposeConvolution2dImpl(). This only depends on the weights, so it can
+/// be done once and reused for every inference.
+std::vector<float> PackTransposeConvolution2dWeights(const TransposeConvolution2dDescriptor& descriptor,
+                                                     const TensorShape& weightsShape,
+                                                     Decoder<float>& weightsDecoder);
+
 void TransposeConvolution2dImpl(const TransposeConvolution2dDescriptor& descriptor,
                                 const TensorShape& inputShape,
                                 Decoder<float>& inputDecoder,
                                 const TensorShape& outputShape,
                                 Encoder<float>& outputEncoder,
                                 const TensorShape& weightsShape,
-                                Decoder<float>& weightsDecoder,
+                                const std::vector<float>& packedWeights,
                                 Decoder<float>* biasesDecoder);
 
 } // namespace armnn
\ No newline at end of file
@@ -426,4 +426,44 @@ TEST_CASE("TosaRefTransposeEndtoEndTestFloat32")
     TransposeEndToEnd<armnn::DataType::Float32>(tosaDefaultBackends);
 }
 
-}
\ No newline at end of file
+// The pre-compiled workload keeps its model runner for the next inference
+TEST_CASE("TosaRefPreCompiledWorkloadRunsTwice")
+{
+    IRuntimePtr runtime(IRuntime::Create(IRuntime::CreationOptions()));
+
+    const TensorInfo info({ 1, 2, 2, 1 }, DataType::Float32);
+    INetworkPtr net(INetwork::Create());
+    IConnectableLayer* input0 = net->AddInputLayer(0);
+    IConnectableLayer* input1 = net->AddInputLayer(1);
+    IConnectableLayer* add = net->AddElementwiseBinaryLayer(BinaryOperation::Add);
+    IConnectableLayer* output = net->AddOutputLayer(0);
+    input0->GetOutputSlot(0).Connect(add->GetInputSlot(0));
+    input1->GetOutputSlot(0).Connect(add->GetInputSlot(1));
+    add->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+    input0->GetOutputSlot(0).SetTensorInfo(info);
+    input1->GetOutputSlot(0).SetTensorInfo(info);
+    add->GetOutputSlot(0).SetTensorInfo(info);
+
+    NetworkId netId;
+    REQUIRE(runtime->LoadNetwork(netId, Optimize(*net, tosaDefaultBackends, runtime->GetDeviceSpec())) ==
+            Status::Success);
+
+    TensorInfo inputInfo = info;
+    inputInfo.SetConstant(true);
+    auto run = [&](std::vector<float> input0Data, std::vector<float> input1Data)
+    {
+        std::vector<float> outputData(info.GetNumElements(), 0.0f);
+        InputTensors inputTensors{ { 0, ConstTensor(inputInfo, input0Data.data()) },
+                                   { 1, ConstTensor(inputInfo, input1Data.data()) } };
+        OutputTensors outputTensors{ { 0, Tensor(info, outputData.data()) } };
+        REQUIRE(runtime->EnqueueWorkload(netId, inputTensors, outputTensors) == Status::Success);
+        return outputData;
+    };
+
+    CHECK(run({ 1.0f, 2.0f, 3.0f, 4.0f }, { 10.0f, 20.0f, 30.0f, 40.0f }) ==
+          std::vector<float>({ 11.0f, 22.0f, 33.0f, 44.0f }));
+    CHECK(run({ -1.0f, 0.5f, 2.0f, 8.0f }, { 1.0f, 1.5f, -4.0f, 0.0f }) ==
+          std::vector<float>({ 0.0f, 2.0f, -2.0f, 8.0f }));
+}
+
+}
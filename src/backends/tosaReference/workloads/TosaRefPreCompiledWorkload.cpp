@@ -1,10 +1,12 @@
 //
-// Copyright © 2022-2023 Arm Ltd and Contributors. All rights reserved.
+// Copyright © 2022-2024 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 
 #include "TosaRefPreCompiledWorkload.hpp"
 
+#include <algorithm>
+
 namespace armnn
 {
 
@@ -19,54 +21,97 @@ TosaRefPreCompiledWorkload::TosaRefPreCompiledWorkload(const PreCompiledQueueDes
         throw InvalidArgumentException(
                 "TosaRefPreCompiledWorkload requires a valid pre-compiled object (TosaSerializationHandler).");
     }
+
+    tosa::TosaSerializationHandler* handler = static_cast<tosa::TosaSerializationHandler*>(m_Data.m_PreCompiledObject);
+    m_InputNames = handler->GetMainRegion()->GetBlocks()[0]->GetInputs();
+    m_OutputNames = handler->GetMainRegion()->GetBlocks()[0]->GetOutputs();
+
+    // Initialise a runner up front so that the first inference doesn't pay for it.
+    ReleaseRunner(AcquireRunner());
 }
+
 void TosaRefPreCompiledWorkload::Execute() const
 {
-    tosa::TosaSerializationHandler* handler = static_cast<tosa::TosaSerializationHandler*>(m_Data.m_PreCompiledObject);
+    Execute(m_Data.m_Inputs, m_Data.m_Outputs);
+}
 
-    std::vector<std::string> inputNames = handler->GetMainRegion()->GetBlocks()[0]->GetInputs();
-    std::vector<std::string> outputNames = handler->GetMainRegion()->GetBlocks()[0]->GetOutputs();
+void TosaRefPreCompiledWorkload::ExecuteAsync(ExecutionData& executionData)
+{
+    // Each concurrent execution takes a runner of its own, so unlike the default there is no need to serialize them.
+    WorkingMemDescriptor* workingMemDescriptor = static_cast<WorkingMemDescriptor*>(executionData.m_Data);
+    Execute(workingMemDescriptor->m_Inputs, workingMemDescriptor->m_Outputs);
+}
 
-    TosaReference::IModelRunner runner;
-    GraphStatus status;
+std::unique_ptr<TosaRefPreCompiledWorkload::Runner> TosaRefPreCompiledWorkload::AcquireRunner() const
+{
+    {
+#if !defined(ARMNN_DISABLE_THREADS)
+        std::lock_guard<std::mutex> lock(m_RunnersMutex);
+#endif
+        if (!m_IdleRunners.empty())
+        {
+            std::unique_ptr<Runner> runner = std::move(m_IdleRunners.back());
+            m_IdleRunners.pop_back();
+            return runner;
+        }
+    }
 
     // Initialise the model runner with the TosaSerializationHandler
-    status = runner.initialize(*handler);
-    if(status != GraphStatus::TOSA_VALID)
+    tosa::TosaSerializationHandler* handler = static_cast<tosa::TosaSerializationHandler*>(m_Data.m_PreCompiledObject);
+    auto runner = std::make_unique<Runner>();
+    if (runner->m_Runner.initialize(*handler) != GraphStatus::TOSA_VALID)
     {
         throw armnn::Exception("An error has occurred while initialising the TOSA Reference Model.");
     }
+    return runner;
+}
+
+void TosaRefPreCompiledWorkload::ReleaseRunner(std::unique_ptr<Runner> runner) const
+{
+#if !defined(ARMNN_DISABLE_THREADS)
+    std::lock_guard<std::mutex> lock(m_RunnersMutex);
+#endif
+    m_IdleRunners.push_back(std::move(runner));
+}
+
+void TosaRefPreCompiledWorkload::Execute(const std::vector<ITensorHandle*>& inputs,
+                                         const std::vector<ITensorHandle*>& outputs) const
+{
+    // A runner which fails is dropped rather than released, as its state is unknown.
+    std::unique_ptr<Runner> runner = AcquireRunner();
 
     // Set the inputs
-    for (uint32_t inputSlotIdx = 0; inputSlotIdx < inputNames.size(); ++inputSlotIdx)
+    for (uint32_t inputSlotIdx = 0; inputSlotIdx < m_InputNames.size(); ++inputSlotIdx)
     {
+        const std::string& inputName = m_InputNames[inputSlotIdx];
+        ITensorHandle* input = inputs[inputSlotIdx];
         DataType dataType = m_workloadInfo.m_InputTensorInfos[inputSlotIdx].GetDataType();
         switch (dataType)
         {
             case DataType::Float16:
-                SetInput<half_float::half>(runner, inputNames[inputSlotIdx], inputSlotIdx);
+                SetInput<half_float::half>(*runner, inputName, input);
                 break;
             case DataType::Float32:
-                SetInput<float>(runner, inputNames[inputSlotIdx], inputSlotIdx);
+                SetInput<float>(*runner, inputName, input);
                 break;
             case DataType::QAsymmU8:
-                SetInput<uint8_t, int32_t>(runner, inputNames[inputSlotIdx], inputSlotIdx);
+                SetInput<uint8_t, int32_t>(*runner, inputName, input);
                 break;
             case DataType::QAsymmS8:
             case DataType::QSymmS8:
-                SetInput<int8_t, int32_t>(runner, inputNames[inputSlotIdx], inputSlotIdx);
+                SetInput<int8_t, int32_t>(*runner, inputName, input);
                 break;
             case DataType::QSymmS16:
-                SetInput<int16_t, int32_t>(runner, inputNames[inputSlotIdx], inputSlotIdx);
+                SetInput<int16_t, int32_t>(*runner, inputName, input);
                 break;
             case DataType::Signed32:
-                SetInput<int32_t>(runner, inputNames[inputSlotIdx], inputSlotIdx);
+                SetInput<int32_t>(*runner, inputName, input);
                 break;
             case DataType::Signed64:
-                SetInput<int64_t>(runner, inputNames[inputSlotIdx], inputSlotIdx);
+                SetInput<int64_t>(*runner, inputName, input);
                 break;
             case DataType::Boolean:
-                SetInput<unsigned char>(runner, inputNames[inputSlotIdx], inputSlotIdx);
+                SetInput<unsigned char>(*runner, inputName, input);
                 break;
             default:
                 throw armnn::Exception("Input data type is unsupported in TOSA Reference Backend.");
@@ -74,93 +119,98 @@ void TosaRefPreCompiledWorkload::Execute() const
     }
 
     // Run the TOSA Reference Model
-    status = runner.run();
-    if(status != GraphStatus::TOSA_VALID)
+    if (runner->m_Runner.run() != GraphStatus::TOSA_VALID)
     {
         throw armnn::Exception("An error has occurred while running the TOSA Reference Model.");
     }
 
     // Gets the outputs
-    for (uint32_t outputSlotIdx = 0; outputSlotIdx < outputNames.size(); ++outputSlotIdx)
+    for (uint32_t outputSlotIdx = 0; outputSlotIdx < m_OutputNames.size(); ++outputSlotIdx)
     {
+        const std::string& outputName = m_OutputNames[outputSlotIdx];
+        ITensorHandle* output = outputs[outputSlotIdx];
         DataType dataType = m_workloadInfo.m_OutputTensorInfos[outputSlotIdx].GetDataType();
         switch (dataType)
         {
             case DataType::Float16:
-                GetOutput<half_float::half>(runner, outputNames[outputSlotIdx], outputSlotIdx);
+                GetOutput<half_float::half>(*runner, outputName, output);
                 break;
             case DataType::Float32:
-                GetOutput<float>(runner, outputNames[outputSlotIdx], outputSlotIdx);
+                GetOutput<float>(*runner, outputName, output);
                 break;
             case DataType::QAsymmU8:
-                GetOutput<uint8_t, int32_t>(runner, outputNames[outputSlotIdx], outputSlotIdx);
+                GetOutput<uint8_t, int32_t>(*runner, outputName, output);
                 break;
             case DataType::QAsymmS8:
             case DataType::QSymmS8:
-                GetOutput<int8_t, int32_t>(runner, outputNames[outputSlotIdx], outputSlotIdx);
+                GetOutput<int8_t, int32_t>(*runner, outputName, output);
                 break;
             case DataType::QSymmS16:
-                GetOutput<int16_t, int32_t>(runner, outputNames[outputSlotIdx], outputSlotIdx);
+                GetOutput<int16_t, int32_t>(*runner, outputName, output);
                 break;
             case DataType::Signed32:
-                GetOutput<int32_t>(runner, outputNames[outputSlotIdx], outputSlotIdx);
+                GetOutput<int32_t>(*runner, outputName, output);
                 break;
             case DataType::Signed64:
-                GetOutput<int64_t>(runner, outputNames[outputSlotIdx], outputSlotIdx);
+                GetOutput<int64_t>(*runner, outputName, output);
                 break;
             case DataType::Boolean:
-                GetOutput<unsigned char>(runner, outputNames[outputSlotIdx], outputSlotIdx);
+                GetOutput<unsigned char>(*runner, outputName, output);
                 break;
             default:
                 throw armnn::Exception("Output data type is unsupported in TOSA Reference Backend.");
         }
     }
+
+    ReleaseRunner(std::move(runner));
 }
 
 template <typename T>
-void TosaRefPreCompiledWorkload::SetInput(TosaReference::IModelRunner& runner,
-                                          std::string inputName,
-                                          uint32_t inputIndex) const
+void TosaRefPreCompiledWorkload::SetInput(Runner& runner,
+                                          const std::string& inputName,
+                                          ITensorHandle* input) const
 {
-    SetInput<T, T>(runner, inputName, inputIndex);
+    SetInput<T, T>(runner, inputName, input);
 }
 
 template <typename T, typename Trunner>
-void TosaRefPreCompiledWorkload::SetInput(TosaReference::IModelRunner& runner,
-                                          std::string inputName,
-                                          uint32_t inputIndex) const
+void TosaRefPreCompiledWorkload::SetInput(Runner& runner,
+                                          const std::string& inputName,
+                                          ITensorHandle* input) const
 {
-    std::vector<T> inputData(m_Data.m_Inputs[inputIndex]->GetShape().GetNumElements());
-    std::vector<Trunner> inputDataRunner(m_Data.m_Inputs[inputIndex]->GetShape().GetNumElements());
-
-    m_Data.m_Inputs[inputIndex]->CopyOutTo(inputData.data());
+    const unsigned int numElements = input->GetShape().GetNumElements();
+    std::vector<Trunner>& inputDataRunner = std::get<std::vector<Trunner>>(runner.m_InputBuffers);
+    inputDataRunner.resize(numElements);
 
-    std::transform(inputData.begin(), inputData.end(),
+    // Converted straight from the tensor memory into the buffer passed to the runner.
+    const T* inputData = reinterpret_cast<const T*>(input->Map());
+    std::transform(inputData, inputData + numElements,
                    inputDataRunner.begin(), [](T x) { return static_cast<Trunner>(x);});
+    input->Unmap();
 
-    runner.setInput<Trunner>(inputName, inputDataRunner);
+    runner.m_Runner.setInput<Trunner>(inputName, inputDataRunner);
 }
 
 template <typename T>
-void TosaRefPreCompiledWorkload::GetOutput(TosaReference::IModelRunner& runner,
-                                           std::string outputName,
-                                           uint32_t outputIndex) const
+void TosaRefPreCompiledWorkload::GetOutput(Runner& runner,
+                                           const std::string& outputName,
+                                           ITensorHandle* output) const
 {
-    GetOutput<T, T>(runner, outputName, outputIndex);
+    GetOutput<T, T>(runner, outputName, output);
 }
 
 template <typename T, typename Trunner>
-void TosaRefPreCompiledWorkload::GetOutput(TosaReference::IModelRunner& runner,
-                                           std::string outputName,
-                                           uint32_t outputIndex) const
+void TosaRefPreCompiledWorkload::GetOutput(Runner& runner,
+                                           const std::string& outputName,
+                                           ITensorHandle* output) const
 {
-    std::vector<Trunner> actualOutputsRunner = runner.getOutput<Trunner>(outputName);
-    std::vector<T> actualOutputs (actualOutputsRunner.size());
+    std::vector<Trunner> actualOutputsRunner = runner.m_Runner.getOutput<Trunner>(outputName);
 
+    // Converted straight into the tensor memory.
+    T* outputData = reinterpret_cast<T*>(output->Map());
     std::transform(actualOutputsRunner.begin(), actualOutputsRunner.end(),
-                   actualOutputs.begin(), [](Trunner x) { return static_cast<T>(x);});
-
-    m_Data.m_Outputs[outputIndex]->CopyInFrom(actualOutputs.data());
+                   outputData, [](Trunner x) { return static_cast<T>(x);});
+    output->Unmap();
 }
 
 bool TosaRefPreCompiledWorkloadValidate(std::string*)
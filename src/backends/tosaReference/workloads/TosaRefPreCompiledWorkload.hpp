@@ -1,5 +1,5 @@
 //
-// Copyright © 2022-2023 Arm Ltd and Contributors. All rights reserved.
+// Copyright © 2022-2024 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 
@@ -12,8 +12,13 @@
 
 #include <memory>
 #include <string>
+#include <tuple>
 #include <vector>
 
+#if !defined(ARMNN_DISABLE_THREADS)
+#include <mutex>
+#endif
+
 namespace armnn
 {
 
@@ -25,8 +30,21 @@ public:
     TosaRefPreCompiledWorkload(const PreCompiledQueueDescriptor& descriptor,
                                const WorkloadInfo& info);
     void Execute() const override;
+    void ExecuteAsync(ExecutionData& executionData) override;
 
 private:
+    /// An initialized model runner along with the buffers used to pass tensors to it, reused from one inference to
+    /// the next. Inputs are copied into the runner when set, so one buffer per runner data type is enough.
+    struct Runner
+    {
+        TosaReference::IModelRunner m_Runner;
+        std::tuple<std::vector<half_float::half>,
+                   std::vector<float>,
+                   std::vector<int32_t>,
+                   std::vector<int64_t>,
+                   std::vector<unsigned char>> m_InputBuffers;
+    };
+
     bool SupportsTensorHandleReplacement() const override
     {
         return true;
@@ -42,19 +60,32 @@ private:
         this->m_Data.m_Outputs[slot] = tensorHandle;
     }
 
+    void Execute(const std::vector<ITensorHandle*>& inputs, const std::vector<ITensorHandle*>& outputs) const;
+
+    /// Takes an idle runner, or initializes a new one when they are all in use by other executions.
+    std::unique_ptr<Runner> AcquireRunner() const;
+    void ReleaseRunner(std::unique_ptr<Runner> runner) const;
+
     template <typename T, typename Trunner>
-    void SetInput(TosaReference::IModelRunner& runner, std::string inputName, uint32_t inputIndex) const;
+    void SetInput(Runner& runner, const std::string& inputName, ITensorHandle* input) const;
 
     template <typename T>
-    void SetInput(TosaReference::IModelRunner& runner, std::string inputName, uint32_t inputIndex) const;
+    void SetInput(Runner& runner, const std::string& inputName, ITensorHandle* input) const;
 
     template <typename T, typename Trunner>
-    void GetOutput(TosaReference::IModelRunner& runner, std::string outputName, uint32_t outputIndex) const;
+    void GetOutput(Runner& runner, const std::string& outputName, ITensorHandle* output) const;
 
     template <typename T>
-    void GetOutput(TosaReference::IModelRunner& runner, std::string outputName, uint32_t outputIndex) const;
+    void GetOutput(Runner& runner, const std::string& outputName, ITensorHandle* output) const;
 
     WorkloadInfo m_workloadInfo;
+    std::vector<std::string> m_InputNames;
+    std::vector<std::string> m_OutputNames;
+
+    mutable std::vector<std::unique_ptr<Runner>> m_IdleRunners;
+#if !defined(ARMNN_DISABLE_THREADS)
+    mutable std::mutex m_RunnersMutex;
+#endif
 };
 
 }    //namespace armnn
@@ -11,6 +11,13 @@
 
 #include <doctest/doctest.h>
 
+#include <atomic>
+#include <chrono>
+#if !defined(ARMNN_DISABLE_THREADS)
+#include <thread>
+#endif
+#include <vector>
+
 using namespace arm::pipe;
 
 TEST_SUITE("BufferTests")
@@ -408,4 +415,80 @@ TEST_CASE("ReadSwTraceMessageExceptionTest1")
 
 }
 
+#if !defined(ARMNN_DISABLE_THREADS)
+TEST_CASE("BufferConcurrentCommitBenchmark")
+{
+    // Inference threads each reporting events while the send thread reads them, as with timeline reporting on.
+    const unsigned int numberOfThreads = 4;
+    const unsigned int eventsPerThread = 20000;
+    const unsigned int eventSize = 16;
+
+    BufferManager bufferManager;
+    std::atomic<unsigned int> numberOfProducersRunning(numberOfThreads);
+    unsigned int eventsRead = 0;
+    unsigned int eventsOfWrongSize = 0;
+    uint64_t valuesRead = 0;
+
+    const auto start = std::chrono::steady_clock::now();
+
+    std::thread consumer([&]()
+    {
+        while (true)
+        {
+            const bool producersDone = numberOfProducersRunning.load() == 0;
+            IPacketBufferPtr packetBuffer = bufferManager.GetReadableBuffer();
+            if (packetBuffer == nullptr)
+            {
+                if (producersDone)
+                {
+                    break;
+                }
+                std::this_thread::yield();
+                continue;
+            }
+            eventsOfWrongSize += packetBuffer->GetSize() != eventSize;
+            valuesRead += ReadUint32(packetBuffer, 0);
+            ++eventsRead;
+            bufferManager.MarkRead(packetBuffer);
+        }
+    });
+
+    std::vector<std::thread> producers;
+    for (unsigned int t = 0; t < numberOfThreads; ++t)
+    {
+        producers.emplace_back([&, t]()
+        {
+            for (unsigned int i = 0; i < eventsPerThread; ++i)
+            {
+                unsigned int reservedSize = 0;
+                IPacketBufferPtr packetBuffer = bufferManager.Reserve(eventSize, reservedSize);
+                while (packetBuffer == nullptr)
+                {
+                    // All the buffers are waiting to be read
+                    std::this_thread::yield();
+                    packetBuffer = bufferManager.Reserve(eventSize, reservedSize);
+                }
+                WriteUint32(packetBuffer, 0, t + 1);
+                bufferManager.Commit(packetBuffer, eventSize, false);
+            }
+            --numberOfProducersRunning;
+        });
+    }
+    for (std::thread& producer : producers)
+    {
+        producer.join();
+    }
+    consumer.join();
+
+    const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+    const unsigned int numberOfEvents = numberOfThreads * eventsPerThread;
+    MESSAGE("Reserve and commit of an event with " << numberOfThreads << " threads: "
+            << elapsed.count() / numberOfEvents << " ns");
+
+    CHECK(eventsRead == numberOfEvents);
+    CHECK(eventsOfWrongSize == 0);
+    CHECK(valuesRead == uint64_t(eventsPerThread) * numberOfThreads * (numberOfThreads + 1) / 2);
+}
+#endif
+
 }
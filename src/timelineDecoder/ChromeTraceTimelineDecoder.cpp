@@ -0,0 +1,267 @@
+//
+// Copyright © 2024 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "ChromeTraceTimelineDecoder.hpp"
+
+#include <client/src/ProfilingUtils.hpp>
+
+#include <common/include/LabelsAndEventClasses.hpp>
+#include <common/include/ProfilingException.hpp>
+#include <common/include/Processes.hpp>
+
+#include <sstream>
+
+namespace armnn
+{
+namespace timelinedecoder
+{
+
+using arm::pipe::LabelsAndEventClasses;
+
+namespace
+{
+
+double ToMicroseconds(uint64_t timestampNs)
+{
+    return static_cast<double>(timestampNs) / 1000.0;
+}
+
+std::string ToString(uint64_t guid)
+{
+    return std::to_string(guid);
+}
+
+} // anonymous namespace
+
+ChromeTraceTimelineDecoder::ChromeTraceTimelineDecoder(std::ostream& stream)
+    : m_Writer(stream)
+    , m_ProcessId(arm::pipe::GetCurrentProcessId())
+{
+    m_Writer.WriteProcessName(m_ProcessId, "Arm NN");
+}
+
+ChromeTraceTimelineDecoder::TimelineStatus ChromeTraceTimelineDecoder::CreateEntity(const Entity& entity)
+{
+    m_Entities[entity.m_Guid];
+    return TimelineStatus::TimelineStatus_Success;
+}
+
+ChromeTraceTimelineDecoder::TimelineStatus ChromeTraceTimelineDecoder::CreateEventClass(const EventClass&)
+{
+    return TimelineStatus::TimelineStatus_Success;
+}
+
+ChromeTraceTimelineDecoder::TimelineStatus ChromeTraceTimelineDecoder::CreateEvent(const Event& event)
+{
+    m_Events[event.m_Guid] = event;
+    return TimelineStatus::TimelineStatus_Success;
+}
+
+ChromeTraceTimelineDecoder::TimelineStatus ChromeTraceTimelineDecoder::CreateLabel(const Label& label)
+{
+    m_Labels[label.m_Guid] = label.m_Name;
+    return TimelineStatus::TimelineStatus_Success;
+}
+
+ChromeTraceTimelineDecoder::TimelineStatus ChromeTraceTimelineDecoder::CreateRelationship(
+    const Relationship& relationship)
+{
+    switch (relationship.m_RelationshipType)
+    {
+        case RelationshipType::RetentionLink:
+        {
+            auto it = m_Entities.find(relationship.m_TailGuid);
+            if (it != m_Entities.end())
+            {
+                it->second.m_Owners.push_back(relationship.m_HeadGuid);
+            }
+            break;
+        }
+        case RelationshipType::LabelLink:
+            HandleLabelLink(relationship);
+            break;
+        case RelationshipType::ExecutionLink:
+            HandleExecutionLink(relationship);
+            break;
+        default:
+            break;
+    }
+    return TimelineStatus::TimelineStatus_Success;
+}
+
+void ChromeTraceTimelineDecoder::HandleLabelLink(const Relationship& relationship)
+{
+    auto entity = m_Entities.find(relationship.m_HeadGuid);
+    if (entity == m_Entities.end())
+    {
+        return;
+    }
+    if (relationship.m_AttributeGuid == LabelsAndEventClasses::TYPE_GUID)
+    {
+        // The type is the label itself
+        entity->second.m_Type = relationship.m_TailGuid;
+        return;
+    }
+
+    auto label = m_Labels.find(relationship.m_TailGuid);
+    if (label == m_Labels.end())
+    {
+        return;
+    }
+    if (relationship.m_AttributeGuid == LabelsAndEventClasses::NAME_GUID)
+    {
+        entity->second.m_Name = label->second;
+    }
+    else if (relationship.m_AttributeGuid == LabelsAndEventClasses::BACKENDID_GUID)
+    {
+        entity->second.m_BackendId = label->second;
+    }
+}
+
+void ChromeTraceTimelineDecoder::HandleExecutionLink(const Relationship& relationship)
+{
+    auto event = m_Events.find(relationship.m_TailGuid);
+    auto entity = m_Entities.find(relationship.m_HeadGuid);
+    if (event == m_Events.end() || entity == m_Entities.end())
+    {
+        return;
+    }
+    const Event recorded = event->second;
+    m_Events.erase(event);
+
+    const uint64_t guid = entity->first;
+    const bool isInference = entity->second.m_Type == LabelsAndEventClasses::INFERENCE_GUID;
+    const bool isWorkloadExecution = entity->second.m_Type == LabelsAndEventClasses::WORKLOAD_EXECUTION_GUID;
+
+    if (relationship.m_AttributeGuid == LabelsAndEventClasses::ARMNN_PROFILING_SOL_EVENT_CLASS)
+    {
+        if (isInference)
+        {
+            m_Writer.WriteAsyncBeginEvent("Inference", "inference", guid, m_ProcessId,
+                                          static_cast<int>(recorded.m_ThreadId), ToMicroseconds(recorded.m_TimeStamp),
+                                          { { "guid", ToString(guid) } });
+        }
+        else if (isWorkloadExecution)
+        {
+            m_StartEvents[guid] = recorded;
+        }
+    }
+    else if (relationship.m_AttributeGuid == LabelsAndEventClasses::ARMNN_PROFILING_EOL_EVENT_CLASS)
+    {
+        if (isInference)
+        {
+            m_Writer.WriteAsyncEndEvent("Inference", "inference", guid, m_ProcessId,
+                                        static_cast<int>(recorded.m_ThreadId), ToMicroseconds(recorded.m_TimeStamp));
+        }
+        else if (isWorkloadExecution)
+        {
+            auto start = m_StartEvents.find(guid);
+            if (start != m_StartEvents.end())
+            {
+                WriteWorkloadExecution(guid, entity->second, start->second, recorded);
+                m_StartEvents.erase(start);
+            }
+        }
+
+        // Nothing refers to the entity once its life is over
+        if (isInference || isWorkloadExecution)
+        {
+            m_Entities.erase(entity);
+        }
+    }
+}
+
+void ChromeTraceTimelineDecoder::WriteWorkloadExecution(uint64_t guid,
+                                                        const EntityInfo& execution,
+                                                        const Event& start,
+                                                        const Event& end)
+{
+    uint64_t workloadGuid  = 0;
+    uint64_t inferenceGuid = 0;
+    const EntityInfo* workload = FindOwner(execution, LabelsAndEventClasses::WORKLOAD_GUID, &workloadGuid);
+    FindOwner(execution, LabelsAndEventClasses::INFERENCE_GUID, &inferenceGuid);
+    const EntityInfo* layer = workload ? FindOwner(*workload, LabelsAndEventClasses::LAYER_GUID) : nullptr;
+
+    const std::string name = layer && !layer->m_Name.empty() ? layer->m_Name : "Workload";
+    const std::string backendId = workload ? workload->m_BackendId : "";
+
+    armnnUtils::ChromeTraceWriter::Args args;
+    args.emplace_back("backend", backendId);
+    args.emplace_back("workload", ToString(workloadGuid));
+    args.emplace_back("inference", ToString(inferenceGuid));
+    args.emplace_back("execution", ToString(guid));
+
+    const uint64_t durationNs = end.m_TimeStamp >= start.m_TimeStamp ? end.m_TimeStamp - start.m_TimeStamp : 0;
+    m_Writer.WriteCompleteEvent(name,
+                                backendId,
+                                m_ProcessId,
+                                static_cast<int>(start.m_ThreadId),
+                                ToMicroseconds(start.m_TimeStamp),
+                                ToMicroseconds(durationNs),
+                                args);
+}
+
+const ChromeTraceTimelineDecoder::EntityInfo* ChromeTraceTimelineDecoder::FindOwner(const EntityInfo& entity,
+                                                                                    uint64_t type,
+                                                                                    uint64_t* outGuid) const
+{
+    for (uint64_t owner : entity.m_Owners)
+    {
+        auto it = m_Entities.find(owner);
+        if (it != m_Entities.end() && it->second.m_Type == type)
+        {
+            if (outGuid)
+            {
+                *outGuid = owner;
+            }
+            return &it->second;
+        }
+    }
+    return nullptr;
+}
+
+void ChromeTraceTimelineDecoder::Close()
+{
+    m_Writer.Close();
+}
+
+ChromeTracePacketHandler::ChromeTracePacketHandler(std::ostream& stream)
+    : m_DirectoryHeader(arm::pipe::CreateTimelinePacketHeader(1, 0, 0, 0, 0, 0).first)
+    , m_MessageHeader(arm::pipe::CreateTimelinePacketHeader(1, 0, 1, 0, 0, 0).first)
+    , m_Decoder(stream)
+    , m_CaptureHandler(1, 1, 0, m_Decoder)
+    , m_DirectoryHandler(1, 0, 0, m_CaptureHandler, true)
+{}
+
+std::vector<uint32_t> ChromeTracePacketHandler::GetHeadersAccepted()
+{
+    return { m_DirectoryHeader, m_MessageHeader };
+}
+
+void ChromeTracePacketHandler::HandlePacket(const arm::pipe::Packet& packet)
+{
+    if (packet.GetHeader() == m_DirectoryHeader)
+    {
+        m_DirectoryHandler(packet);
+    }
+    else if (packet.GetHeader() == m_MessageHeader)
+    {
+        m_CaptureHandler(packet);
+    }
+    else
+    {
+        std::stringstream ss;
+        ss << "Received a packet with unknown header [" << packet.GetHeader() << "]";
+        throw arm::pipe::ProfilingException(ss.str());
+    }
+}
+
+void ChromeTracePacketHandler::Close()
+{
+    m_Decoder.Close();
+}
+
+}
+}
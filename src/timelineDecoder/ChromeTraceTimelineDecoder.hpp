@@ -0,0 +1,97 @@
+//
+// Copyright © 2024 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include <ChromeTraceWriter.hpp>
+
+#include <client/include/ILocalPacketHandler.hpp>
+
+#include <common/include/Packet.hpp>
+
+#include <server/include/timelineDecoder/ITimelineDecoder.hpp>
+#include <server/include/timelineDecoder/TimelineCaptureCommandHandler.hpp>
+#include <server/include/timelineDecoder/TimelineDirectoryCaptureCommandHandler.hpp>
+
+#include <map>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace armnn
+{
+namespace timelinedecoder
+{
+
+/// Writes the timeline of the inferences run, in the Chrome Trace Event format, as the timeline is decoded.
+/// Each workload execution is written once it ends, on the track of the thread which ran it, and is named after its
+/// layer, along with its backend and GUIDs. Each inference is an async span, so that overlapping inferences can be
+/// told apart.
+class ChromeTraceTimelineDecoder : public arm::pipe::ITimelineDecoder
+{
+public:
+    explicit ChromeTraceTimelineDecoder(std::ostream& stream);
+
+    TimelineStatus CreateEntity(const Entity&) override;
+    TimelineStatus CreateEventClass(const EventClass&) override;
+    TimelineStatus CreateEvent(const Event&) override;
+    TimelineStatus CreateLabel(const Label&) override;
+    TimelineStatus CreateRelationship(const Relationship&) override;
+
+    /// Ends the trace.
+    void Close();
+
+private:
+    struct EntityInfo
+    {
+        uint64_t m_Type = 0;
+        std::string m_Name;
+        std::string m_BackendId;
+        /// The entities retaining this one, e.g. the layer of a workload, or the workload and inference of a
+        /// workload execution.
+        std::vector<uint64_t> m_Owners;
+    };
+
+    void HandleLabelLink(const Relationship& relationship);
+    void HandleExecutionLink(const Relationship& relationship);
+    void WriteWorkloadExecution(uint64_t guid, const EntityInfo& execution, const Event& start, const Event& end);
+
+    /// The first entity of the given type retaining the entity, or nullptr.
+    const EntityInfo* FindOwner(const EntityInfo& entity, uint64_t type, uint64_t* outGuid = nullptr) const;
+
+    armnnUtils::ChromeTraceWriter m_Writer;
+    std::map<uint64_t, std::string> m_Labels;
+    std::map<uint64_t, EntityInfo> m_Entities;
+    /// Events until their execution link tells which entity they belong to.
+    std::map<uint64_t, Event> m_Events;
+    /// The start of life events of the entities which haven't ended yet.
+    std::map<uint64_t, Event> m_StartEvents;
+    int m_ProcessId;
+};
+
+/// Decodes the timeline packets sent to a local packet handler, e.g. by the FileOnlyProfilingConnection, into a
+/// Chrome trace. Add it to ProfilingOptions::m_LocalPacketHandlers along with timeline reporting.
+class ChromeTracePacketHandler : public arm::pipe::ILocalPacketHandler
+{
+public:
+    explicit ChromeTracePacketHandler(std::ostream& stream);
+
+    std::vector<uint32_t> GetHeadersAccepted() override;
+
+    void HandlePacket(const arm::pipe::Packet& packet) override;
+
+    /// Ends the trace, once the connection is closed.
+    void Close();
+
+private:
+    uint32_t m_DirectoryHeader;
+    uint32_t m_MessageHeader;
+    ChromeTraceTimelineDecoder m_Decoder;
+    arm::pipe::TimelineCaptureCommandHandler m_CaptureHandler;
+    arm::pipe::TimelineDirectoryCaptureCommandHandler m_DirectoryHandler;
+};
+
+}
+}
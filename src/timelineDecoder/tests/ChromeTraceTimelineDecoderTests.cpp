@@ -0,0 +1,143 @@
+//
+// Copyright © 2024 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include <ChromeTraceTimelineDecoder.hpp>
+
+#include <common/include/LabelsAndEventClasses.hpp>
+
+#include <doctest/doctest.h>
+
+#include <sstream>
+#include <string>
+
+TEST_SUITE("ChromeTraceTimelineDecoderTests")
+{
+using namespace armnn;
+using namespace timelinedecoder;
+using arm::pipe::ITimelineDecoder;
+using arm::pipe::LabelsAndEventClasses;
+
+namespace
+{
+
+void CreateLabel(ChromeTraceTimelineDecoder& decoder, uint64_t guid, const std::string& name)
+{
+    ITimelineDecoder::Label label;
+    label.m_Guid = guid;
+    label.m_Name = name;
+    decoder.CreateLabel(label);
+}
+
+void CreateEntity(ChromeTraceTimelineDecoder& decoder, uint64_t guid)
+{
+    ITimelineDecoder::Entity entity;
+    entity.m_Guid = guid;
+    decoder.CreateEntity(entity);
+}
+
+void CreateRelationship(ChromeTraceTimelineDecoder& decoder,
+                        ITimelineDecoder::RelationshipType type,
+                        uint64_t head,
+                        uint64_t tail,
+                        uint64_t attribute)
+{
+    static uint64_t nextGuid = 1000;
+    ITimelineDecoder::Relationship relationship;
+    relationship.m_RelationshipType = type;
+    relationship.m_Guid             = nextGuid++;
+    relationship.m_HeadGuid         = head;
+    relationship.m_TailGuid         = tail;
+    relationship.m_AttributeGuid    = attribute;
+    decoder.CreateRelationship(relationship);
+}
+
+void MarkEntity(ChromeTraceTimelineDecoder& decoder, uint64_t entity, uint64_t label, uint64_t attribute)
+{
+    CreateRelationship(decoder, ITimelineDecoder::RelationshipType::LabelLink, entity, label, attribute);
+}
+
+void RecordEvent(ChromeTraceTimelineDecoder& decoder,
+                 uint64_t entity,
+                 uint64_t event,
+                 uint64_t eventClass,
+                 uint64_t timestampNs,
+                 uint64_t threadId)
+{
+    ITimelineDecoder::Event recorded;
+    recorded.m_Guid      = event;
+    recorded.m_TimeStamp = timestampNs;
+    recorded.m_ThreadId  = threadId;
+    decoder.CreateEvent(recorded);
+    CreateRelationship(decoder, ITimelineDecoder::RelationshipType::ExecutionLink, entity, event, eventClass);
+}
+
+} // anonymous namespace
+
+TEST_CASE("ChromeTraceTimelineDecoderWritesWorkloadExecutions")
+{
+    const uint64_t layerGuid        = 1;
+    const uint64_t layerNameGuid    = 2;
+    const uint64_t workloadGuid     = 3;
+    const uint64_t backendIdGuid    = 4;
+    const uint64_t inferenceGuid    = 5;
+    const uint64_t executionGuid    = 6;
+
+    std::stringstream trace;
+    {
+        ChromeTraceTimelineDecoder decoder(trace);
+
+        CreateLabel(decoder, LabelsAndEventClasses::LAYER_GUID, "layer");
+        CreateLabel(decoder, LabelsAndEventClasses::WORKLOAD_GUID, "workload");
+        CreateLabel(decoder, LabelsAndEventClasses::INFERENCE_GUID, "inference");
+        CreateLabel(decoder, LabelsAndEventClasses::WORKLOAD_EXECUTION_GUID, "workload_execution");
+        CreateLabel(decoder, layerNameGuid, "Rsqrt");
+        CreateLabel(decoder, backendIdGuid, "CpuRef");
+
+        // The structure of the network, as sent when it is loaded
+        CreateEntity(decoder, layerGuid);
+        MarkEntity(decoder, layerGuid, layerNameGuid, LabelsAndEventClasses::NAME_GUID);
+        MarkEntity(decoder, layerGuid, LabelsAndEventClasses::LAYER_GUID, LabelsAndEventClasses::TYPE_GUID);
+        CreateEntity(decoder, workloadGuid);
+        MarkEntity(decoder, workloadGuid, LabelsAndEventClasses::WORKLOAD_GUID, LabelsAndEventClasses::TYPE_GUID);
+        MarkEntity(decoder, workloadGuid, backendIdGuid, LabelsAndEventClasses::BACKENDID_GUID);
+        CreateRelationship(decoder, ITimelineDecoder::RelationshipType::RetentionLink,
+                           layerGuid, workloadGuid, LabelsAndEventClasses::CHILD_GUID);
+
+        // An inference running the workload
+        CreateEntity(decoder, inferenceGuid);
+        MarkEntity(decoder, inferenceGuid, LabelsAndEventClasses::INFERENCE_GUID, LabelsAndEventClasses::TYPE_GUID);
+        RecordEvent(decoder, inferenceGuid, 10, LabelsAndEventClasses::ARMNN_PROFILING_SOL_EVENT_CLASS, 1000000, 7);
+
+        CreateEntity(decoder, executionGuid);
+        MarkEntity(decoder, executionGuid, LabelsAndEventClasses::WORKLOAD_EXECUTION_GUID,
+                   LabelsAndEventClasses::TYPE_GUID);
+        CreateRelationship(decoder, ITimelineDecoder::RelationshipType::RetentionLink,
+                           inferenceGuid, executionGuid, LabelsAndEventClasses::CHILD_GUID);
+        CreateRelationship(decoder, ITimelineDecoder::RelationshipType::RetentionLink,
+                           workloadGuid, executionGuid, LabelsAndEventClasses::EXECUTION_OF_GUID);
+        RecordEvent(decoder, executionGuid, 11, LabelsAndEventClasses::ARMNN_PROFILING_SOL_EVENT_CLASS, 1001000, 7);
+
+        // Nothing is written for the execution until it ends
+        CHECK(trace.str().find("\"ph\":\"X\"") == std::string::npos);
+
+        RecordEvent(decoder, executionGuid, 12, LabelsAndEventClasses::ARMNN_PROFILING_EOL_EVENT_CLASS, 1003500, 7);
+        RecordEvent(decoder, inferenceGuid, 13, LabelsAndEventClasses::ARMNN_PROFILING_EOL_EVENT_CLASS, 1004000, 7);
+    }
+
+    const std::string result = trace.str();
+    CHECK(result.front() == '[');
+    CHECK(result.find("]\n") == result.size() - 2);
+
+    CHECK(result.find("{\"ph\":\"X\",\"name\":\"Rsqrt\",\"pid\":") != std::string::npos);
+    CHECK(result.find(",\"tid\":7,\"cat\":\"CpuRef\",\"ts\":1001.000,\"dur\":2.500,\"args\":{\"backend\":\"CpuRef\","
+                      "\"workload\":\"3\",\"inference\":\"5\",\"execution\":\"6\"}}") != std::string::npos);
+
+    CHECK(result.find("{\"ph\":\"b\",\"name\":\"Inference\"") != std::string::npos);
+    CHECK(result.find(",\"tid\":7,\"cat\":\"inference\",\"id\":\"5\",\"ts\":1000.000") != std::string::npos);
+    CHECK(result.find("{\"ph\":\"e\",\"name\":\"Inference\"") != std::string::npos);
+    CHECK(result.find(",\"tid\":7,\"cat\":\"inference\",\"id\":\"5\",\"ts\":1004.000}") != std::string::npos);
+}
+
+}
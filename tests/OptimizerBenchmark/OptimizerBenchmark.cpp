@@ -0,0 +1,251 @@
+//
+// Copyright © 2024 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include <armnn/ArmNN.hpp>
+
+#include <cxxopts.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+const armnn::TensorInfo tensorInfo({ 1, 16 }, armnn::DataType::Float32);
+
+/// Builds a synthetic network of roughly numLayers layers.
+using NetworkBuilder = std::function<armnn::INetworkPtr(unsigned int numLayers)>;
+
+struct TestModel
+{
+    std::string m_Name;
+    std::string m_Description;
+    NetworkBuilder m_Builder;
+};
+
+armnn::IConnectableLayer* Connect(armnn::IConnectableLayer* from, armnn::IConnectableLayer* to, unsigned int slot = 0)
+{
+    from->GetOutputSlot(0).Connect(to->GetInputSlot(slot));
+    return to;
+}
+
+armnn::INetworkPtr BuildNetwork(unsigned int numLayers,
+                                unsigned int layersPerStep,
+                                const std::function<armnn::IConnectableLayer*(armnn::INetwork&,
+                                                                              armnn::IConnectableLayer*,
+                                                                              unsigned int)>& addStep)
+{
+    armnn::INetworkPtr network = armnn::INetwork::Create();
+
+    armnn::IConnectableLayer* current = network->AddInputLayer(0, "input");
+    current->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+
+    for (unsigned int step = 0; step < numLayers / layersPerStep; ++step)
+    {
+        current = addStep(*network, current, step);
+    }
+
+    Connect(current, network->AddOutputLayer(0, "output"));
+    return network;
+}
+
+/// A long chain of activations and additions of a constant bias.
+armnn::INetworkPtr BuildChain(unsigned int numLayers)
+{
+    const std::vector<float> bias(tensorInfo.GetNumElements(), 1.0f);
+    armnn::TensorInfo biasInfo = tensorInfo;
+    biasInfo.SetConstant(true);
+
+    return BuildNetwork(numLayers, 3, [&](armnn::INetwork& network, armnn::IConnectableLayer* current, unsigned int)
+    {
+        armnn::ActivationDescriptor activationDescriptor;
+        activationDescriptor.m_Function = armnn::ActivationFunction::ReLu;
+        auto activation = Connect(current, network.AddActivationLayer(activationDescriptor));
+        activation->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+
+        auto constant = network.AddConstantLayer(armnn::ConstTensor(biasInfo, bias));
+        constant->GetOutputSlot(0).SetTensorInfo(biasInfo);
+
+        auto add = network.AddElementwiseBinaryLayer(armnn::BinaryOperation::Add);
+        Connect(activation, add, 0);
+        Connect(constant, add, 1);
+        add->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+        return add;
+    });
+}
+
+/// Duplicated branches, which are merged by common subexpression elimination.
+armnn::INetworkPtr BuildBranches(unsigned int numLayers)
+{
+    return BuildNetwork(numLayers, 3, [](armnn::INetwork& network, armnn::IConnectableLayer* current, unsigned int)
+    {
+        auto abs0 = Connect(current, network.AddElementwiseUnaryLayer(armnn::UnaryOperation::Abs));
+        abs0->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+        auto abs1 = Connect(current, network.AddElementwiseUnaryLayer(armnn::UnaryOperation::Abs));
+        abs1->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+
+        auto add = network.AddElementwiseBinaryLayer(armnn::BinaryOperation::Add);
+        Connect(abs0, add, 0);
+        Connect(abs1, add, 1);
+        add->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+        return add;
+    });
+}
+
+/// Reshaped constants, which are folded into new constant layers while the graph is optimized.
+armnn::INetworkPtr BuildConstants(unsigned int numLayers)
+{
+    armnn::TensorInfo constantInfo({ tensorInfo.GetNumElements() }, armnn::DataType::Float32, 0.0f, 0, true);
+    const std::vector<float> values(constantInfo.GetNumElements(), 1.0f);
+
+    return BuildNetwork(numLayers, 3, [&](armnn::INetwork& network, armnn::IConnectableLayer* current, unsigned int)
+    {
+        auto constant = network.AddConstantLayer(armnn::ConstTensor(constantInfo, values));
+        constant->GetOutputSlot(0).SetTensorInfo(constantInfo);
+
+        armnn::ReshapeDescriptor reshapeDescriptor;
+        reshapeDescriptor.m_TargetShape = tensorInfo.GetShape();
+        auto reshape = Connect(constant, network.AddReshapeLayer(reshapeDescriptor));
+        armnn::TensorInfo reshapedInfo = tensorInfo;
+        reshapedInfo.SetConstant(true);
+        reshape->GetOutputSlot(0).SetTensorInfo(reshapedInfo);
+
+        auto add = network.AddElementwiseBinaryLayer(armnn::BinaryOperation::Add);
+        Connect(current, add, 0);
+        Connect(reshape, add, 1);
+        add->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+        return add;
+    });
+}
+
+std::vector<TestModel> testModels
+{
+    {"chain", "Activations and constant additions in sequence", BuildChain},
+    {"branches", "Duplicated branches merged by common subexpression elimination", BuildBranches},
+    {"constants", "Constant subgraphs folded during optimization", BuildConstants}
+};
+
+void PrintModels()
+{
+    std::cout << "Available models:\n";
+    for (const auto& model : testModels)
+    {
+        std::cout << model.m_Name << ": " << model.m_Description << "\n";
+    }
+    std::cout << "\n";
+}
+
+struct BenchmarkOptions
+{
+    std::string m_ModelName;
+    std::string m_Backend = "CpuRef";
+    unsigned int m_NumLayers = 10000;
+    unsigned int m_Iterations = 3;
+};
+
+void RunBenchmark(const BenchmarkOptions& benchmarkOptions, const std::vector<TestModel>& models)
+{
+    using Clock = std::chrono::high_resolution_clock;
+
+    armnn::IRuntime::CreationOptions runtimeOptions;
+    armnn::IRuntimePtr runtime = armnn::IRuntime::Create(runtimeOptions);
+    const std::vector<armnn::BackendId> backends = { benchmarkOptions.m_Backend };
+
+    std::cout << "\nOptimizer benchmark on " << benchmarkOptions.m_Backend << "\n";
+    std::cout << "===============================================\n";
+    for (auto& model : models)
+    {
+        armnn::INetworkPtr network = model.m_Builder(benchmarkOptions.m_NumLayers);
+
+        std::chrono::duration<double, std::milli> totalDuration{};
+        std::chrono::duration<double, std::milli> minDuration = std::chrono::duration<double, std::milli>::max();
+        for (unsigned int i = 0; i < benchmarkOptions.m_Iterations; ++i)
+        {
+            auto now = Clock::now();
+            armnn::IOptimizedNetworkPtr optimizedNetwork = armnn::Optimize(*network, backends,
+                                                                           runtime->GetDeviceSpec());
+            auto duration = std::chrono::duration<double, std::milli>(Clock::now() - now);
+
+            if (!optimizedNetwork)
+            {
+                std::cout << "Failed to optimize model " << model.m_Name << "\n";
+                return;
+            }
+            totalDuration += duration;
+            minDuration = std::min(minDuration, duration);
+        }
+
+        std::cout << "\nModel: " << model.m_Name << " (" << benchmarkOptions.m_NumLayers << " layers)\n";
+        std::cout << "Average Optimize() time: " << std::setprecision(4)
+                  << totalDuration.count() / benchmarkOptions.m_Iterations << " milliseconds\n";
+        std::cout << "Fastest Optimize() time: " << std::setprecision(4) << minDuration.count() << " milliseconds\n";
+    }
+}
+
+BenchmarkOptions ParseOptions(int argc, char* argv[])
+{
+    cxxopts::Options options("Optimizer Benchmark", "Times the optimization of large synthetic networks");
+
+    options.add_options()
+        ("m, model", "Model name, do not specify to run all the models", cxxopts::value<std::string>())
+        ("l, layers", "Approximate number of layers in each model",
+         cxxopts::value<unsigned int>()->default_value("10000"))
+        ("i, iterations", "Number of times each model is optimized",
+         cxxopts::value<unsigned int>()->default_value("3"))
+        ("b, backend", "Backend to optimize for", cxxopts::value<std::string>()->default_value("CpuRef"))
+        ("h,help", "Display usage information");
+
+    auto result = options.parse(argc, argv);
+    if (result.count("help"))
+    {
+        std::cout << options.help() << std::endl;
+        PrintModels();
+        exit(EXIT_SUCCESS);
+    }
+
+    BenchmarkOptions benchmarkOptions;
+    if (result.count("model"))
+    {
+        benchmarkOptions.m_ModelName = result["model"].as<std::string>();
+    }
+    benchmarkOptions.m_NumLayers = result["layers"].as<unsigned int>();
+    benchmarkOptions.m_Iterations = std::max(1u, result["iterations"].as<unsigned int>());
+    benchmarkOptions.m_Backend = result["backend"].as<std::string>();
+
+    return benchmarkOptions;
+}
+
+} // anonymous namespace
+
+int main(int argc, char* argv[])
+{
+    BenchmarkOptions benchmarkOptions = ParseOptions(argc, argv);
+
+    armnn::ConfigureLogging(true, true, armnn::LogSeverity::Warning);
+
+    std::vector<TestModel> modelsToTest = testModels;
+    if (!benchmarkOptions.m_ModelName.empty())
+    {
+        auto it = std::find_if(testModels.cbegin(), testModels.cend(), [&](const TestModel& testModel)
+        {
+            return testModel.m_Name == benchmarkOptions.m_ModelName;
+        });
+
+        if (it == testModels.end())
+        {
+            std::cout << "Model name not found\n";
+            return 0;
+        }
+        modelsToTest = { *it };
+    }
+
+    RunBenchmark(benchmarkOptions, modelsToTest);
+    return 0;
+}